@@ -0,0 +1,336 @@
+#include "DetourManager.h"
+#include "Detours.h"
+#include "obse64_common/BranchTrampoline.h"
+#include "obse64_common/Errors.h"
+#include "obse64_common/PatchRegistry.h"
+#include "obse64_common/SafeWrite.h"
+#include "obse64_common/Log.h"
+#include "xbyak/xbyak.h"
+#include <algorithm>
+#include <atomic>
+#include <climits>
+#include <cstddef>
+#include <cstring>
+
+DetourManager g_detourManager;
+
+static const u8 kFarJmp[6] = { 0xFF, 0x25, 0x02, 0x00, 0x00, 0x00 };	// jmp [rip+2]
+
+void DetourManager::JumpCell::init(uintptr_t dst)
+{
+	STATIC_ASSERT(sizeof(JumpCell) == 24);
+
+	{
+		BranchTrampoline::WriteWindow window(g_branchTrampoline, this, sizeof(*this));
+
+		memset(pad, 0xCC, sizeof(pad));
+		jmp = 0xE9;
+		memcpy(farJmp, kFarJmp, sizeof(farJmp));
+		memset(pad2, 0xCC, sizeof(pad2));
+	}
+
+	setTarget(dst);
+}
+
+void DetourManager::JumpCell::setTarget(uintptr_t dst)
+{
+	BranchTrampoline::WriteWindow window(g_branchTrampoline, this, sizeof(*this));
+
+	// aligned 4 and 8 byte stores are atomic, callers see either the old or the new target
+	ptrdiff_t delta = dst - (entry() + 5);
+	if((delta < INT_MIN) || (delta > INT_MAX))
+	{
+		reinterpret_cast <std::atomic <u64> *>(&farTarget)->store(dst, std::memory_order_release);
+
+		delta = uintptr_t(farJmp) - (entry() + 5);
+	}
+
+	reinterpret_cast <std::atomic <s32> *>(&rel)->store(s32(delta), std::memory_order_release);
+}
+
+DetourManager::DetourManager()
+	:m_nextOrder(0)
+	,m_countCalls(false)
+{
+	//
+}
+
+DetourManager::~DetourManager()
+{
+	//
+}
+
+DetourManager::Site * DetourManager::createSite(uintptr_t target)
+{
+	const size_t kOriginalSize = 128;
+	const size_t kEntrySize = 64;
+
+	// relocated prologue, must be able to reach the rest of the function
+	void * originalBuf = g_branchTrampoline.allocate(kOriginalSize, target);
+	if(!originalBuf)
+		return nullptr;
+
+	size_t len = 0;
+
+	{
+		BranchTrampoline::WriteWindow window(g_branchTrampoline, originalBuf, kOriginalSize);
+		Xbyak::CodeGenerator originalCode(kOriginalSize, originalBuf);
+
+		len = RelocateInstructions(originalCode, target, 5);
+	}
+
+	if(!len)
+	{
+		g_branchTrampoline.release(originalBuf, kOriginalSize);
+		return nullptr;
+	}
+
+	// entry stub
+	void * entryBuf = g_branchTrampoline.allocate(kEntrySize, target);
+	if(!entryBuf)
+	{
+		g_branchTrampoline.release(originalBuf, kOriginalSize);
+		return nullptr;
+	}
+
+	// nodes don't move, so the counter can live in the site
+	Site & site = m_sites[target];
+
+	site.original = uintptr_t(originalBuf);
+	site.calls = 0;
+
+	{
+		BranchTrampoline::WriteWindow window(g_branchTrampoline, entryBuf, kEntrySize);
+		Xbyak::CodeGenerator entry(kEntrySize, entryBuf);
+
+		if(m_countCalls)
+		{
+			// the counter is outside of the trampoline, which may not be writable. rax is free at function entry
+			entry.push(entry.rax);
+			entry.mov(entry.rax, uintptr_t(&site.calls));
+			entry.lock();
+			entry.inc(entry.qword[entry.rax]);
+			entry.pop(entry.rax);
+		}
+
+		// falls through in to a jump cell. its int3 padding overlaps the code above, only rel and farTarget
+		// are written after this
+		while((uintptr_t(entry.getCurr()) & 7) != 3)
+			entry.db(0x90);
+
+		site.head = (JumpCell *)(entry.getCurr() - offsetof(JumpCell, jmp));
+
+		entry.db(0xE9);
+		entry.dd(0);
+		for(u8 data : kFarJmp)
+			entry.db(data);
+		entry.dw(0xCCCC);
+		entry.dq(0);
+	}
+
+	site.head->setTarget(uintptr_t(originalBuf));
+
+	// the entry stub is in range of the target, so no trampoline hop is needed
+	if(!safeWriteJump(target, uintptr_t(entryBuf)))
+	{
+		_ERROR("DetourManager: entry stub for %016I64X out of range", target);
+
+		m_sites.erase(target);
+		g_branchTrampoline.release(entryBuf, kEntrySize);
+		g_branchTrampoline.release(originalBuf, kOriginalSize);
+
+		return nullptr;
+	}
+
+	_MESSAGE("DetourManager: hooked %016I64X (%d bytes relocated)", target, u32(len));
+
+	return &site;
+}
+
+void DetourManager::rechain(Site & site)
+{
+	std::stable_sort(site.links.begin(), site.links.end(), [](const Link & lhs, const Link & rhs)
+	{
+		if(lhs.priority != rhs.priority)
+			return lhs.priority > rhs.priority;
+
+		return lhs.order < rhs.order;
+	});
+
+	// back to front, so every target is in place before anything can jump to it
+	uintptr_t next = site.original;
+
+	for(auto iter = site.links.rbegin(); iter != site.links.rend(); ++iter)
+	{
+		iter->continuation->setTarget(next);
+		next = iter->handler;
+	}
+
+	site.head->setTarget(next);
+}
+
+bool DetourManager::attach(PluginHandle owner, uintptr_t target, uintptr_t handler, s32 priority, uintptr_t * original, u64 * originalSlot)
+{
+	std::lock_guard <std::mutex> lock(m_lock);
+
+	PatchRegistry::OwnerScope patchOwner(owner);
+	PatchRegistry::KindScope patchKind("detour");
+
+	// every page touched below changes protection once
+	BranchTrampoline::WriteBatch batch(g_branchTrampoline);
+
+	Site * site = nullptr;
+
+	auto iter = m_sites.find(target);
+	if(iter != m_sites.end())
+	{
+		site = &iter->second;
+
+		for(auto & link : site->links)
+		{
+			if(link.handler == handler)
+			{
+				_WARNING("DetourManager: %016I64X already has handler %016I64X", target, handler);
+				return false;
+			}
+		}
+	}
+	else
+	{
+		site = createSite(target);
+		if(!site)
+		{
+			_ERROR("DetourManager: couldn't hook %016I64X", target);
+			return false;
+		}
+	}
+
+	// near the target, so the jump to the relocated original is direct
+	auto * continuation = (JumpCell *)g_branchTrampoline.allocate(sizeof(JumpCell), target);
+	if(!continuation)
+		return false;
+
+	continuation->init(site->original);
+
+	if(originalSlot)
+	{
+		BranchTrampoline::WriteWindow window(g_branchTrampoline, originalSlot, sizeof(*originalSlot));
+
+		*originalSlot = continuation->entry();
+	}
+
+	Link link;
+
+	link.owner = owner;
+	link.handler = handler;
+	link.priority = priority;
+	link.order = m_nextOrder++;
+	link.continuation = continuation;
+
+	site->links.push_back(link);
+
+	rechain(*site);
+
+	*original = continuation->entry();
+
+	return true;
+}
+
+bool DetourManager::detach(PluginHandle owner, uintptr_t target, uintptr_t handler)
+{
+	std::lock_guard <std::mutex> lock(m_lock);
+
+	auto iter = m_sites.find(target);
+	if(iter == m_sites.end())
+		return false;
+
+	Site & site = iter->second;
+
+	BranchTrampoline::WriteBatch batch(g_branchTrampoline);
+
+	for(size_t i = 0; i < site.links.size(); i++)
+	{
+		Link & link = site.links[i];
+
+		if((link.owner == owner) && (link.handler == handler))
+		{
+			// the continuation is left in place, a call in progress may still return through it
+			JumpCell * continuation = link.continuation;
+
+			site.links.erase(site.links.begin() + i);
+			rechain(site);
+
+			// keep it pointing at the rest of the chain, which now starts at the same index
+			continuation->setTarget((i < site.links.size()) ? site.links[i].handler : site.original);
+
+			return true;
+		}
+	}
+
+	return false;
+}
+
+uintptr_t DetourManager::attachThunk(PluginHandle owner, uintptr_t target, const HookThunkDesc & desc, s32 priority)
+{
+	u64 * origSlot = nullptr;
+
+	uintptr_t thunk = CreateHookThunk(desc, &origSlot);
+	if(!thunk)
+		return 0;
+
+	uintptr_t original = 0;
+	if(!attach(owner, target, thunk, priority, &original, origSlot))
+	{
+		ReleaseHookThunk(thunk);
+		return 0;
+	}
+
+	return thunk;
+}
+
+u64 DetourManager::callCount(uintptr_t target)
+{
+	std::lock_guard <std::mutex> lock(m_lock);
+
+	auto iter = m_sites.find(target);
+	if(iter == m_sites.end())
+		return 0;
+
+	return reinterpret_cast <std::atomic <u64> *>(&iter->second.calls)->load(std::memory_order_relaxed);
+}
+
+bool AttachOBSEDetour(PluginHandle plugin, void * target, void * handler, std::int32_t priority, void ** original)
+{
+	uintptr_t result = 0;
+
+	if(!g_detourManager.attach(plugin, uintptr_t(target), uintptr_t(handler), priority, &result))
+		return false;
+
+	*original = (void *)result;
+
+	return true;
+}
+
+bool DetachOBSEDetour(PluginHandle plugin, void * target, void * handler)
+{
+	return g_detourManager.detach(plugin, uintptr_t(target), uintptr_t(handler));
+}
+
+std::uint64_t GetOBSEDetourCallCount(void * target)
+{
+	return g_detourManager.callCount(uintptr_t(target));
+}
+
+void * AttachOBSEHookThunk(PluginHandle plugin, void * target, std::uint32_t numArgs, std::uint32_t floatArgs, bool floatReturn,
+	void * pre, void * post, std::int32_t priority)
+{
+	HookThunkDesc desc;
+
+	desc.numArgs = numArgs;
+	desc.floatArgs = floatArgs;
+	desc.floatReturn = floatReturn;
+	desc.pre = uintptr_t(pre);
+	desc.post = uintptr_t(post);
+
+	return (void *)g_detourManager.attachThunk(plugin, uintptr_t(target), desc, priority);
+}
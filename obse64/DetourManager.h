@@ -0,0 +1,87 @@
+#pragma once
+
+#include "obse64/PluginAPI.h"
+#include "obse64/HookThunks.h"
+#include "obse64_common/Types.h"
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+// lets several plugins detour the same function without overwriting each other
+// the patched function has a jmp rel32 to a per-site entry stub, which jumps to the first handler (and counts the
+// call first if that's turned on)
+// each handler gets its own continuation, which jumps to the next handler in priority order and finally to the
+// relocated original. every hop is a direct jmp rel32 unless the destination is out of range, and changing the
+// chain only rewrites aligned displacements, so it's safe while the function runs
+class DetourManager
+{
+public:
+	DetourManager();
+	~DetourManager();
+
+	// higher priority handlers run first, ties run in the order they were attached
+	// *original is what the handler calls to continue, it stays valid after detach
+	// originalSlot is optional, the continuation is also written there before the handler can be reached
+	bool	attach(PluginHandle owner, uintptr_t target, uintptr_t handler, s32 priority, uintptr_t * original, u64 * originalSlot = nullptr);
+	bool	detach(PluginHandle owner, uintptr_t target, uintptr_t handler);
+
+	// generates a pre/post thunk and attaches it, returns the thunk (pass it to detach) or 0
+	uintptr_t	attachThunk(PluginHandle owner, uintptr_t target, const HookThunkDesc & desc, s32 priority);
+
+	// off by default, a locked increment on every call to a hot function is a contended cache line
+	// only affects sites hooked after it's set
+	void	setCountCalls(bool countCalls) { m_countCalls = countCalls; }
+	u64		callCount(uintptr_t target);
+
+private:
+	// jmp rel32 with the displacement 4 byte aligned, so it can be retargeted with one store while in use
+	// destinations out of rel32 range go through the jmp [rip+2] behind it, which is otherwise never run
+	struct JumpCell
+	{
+		u8		pad[3];		// int3
+		u8		jmp;		// E9, jumps enter here
+		s32		rel;
+		u8		farJmp[6];	// FF 25 02 00 00 00
+		u8		pad2[2];
+		u64		farTarget;
+
+		void		init(uintptr_t dst);
+		void		setTarget(uintptr_t dst);
+		uintptr_t	entry() const { return uintptr_t(&jmp); }
+	};
+
+	struct Link
+	{
+		PluginHandle	owner;
+		uintptr_t		handler;
+		s32				priority;
+		u32				order;
+		JumpCell		* continuation;
+	};
+
+	struct Site
+	{
+		uintptr_t	original;	// relocated prologue
+		u64			calls;		// incremented by the entry stub if call counting is on
+		JumpCell	* head;		// end of the entry stub
+
+		std::vector <Link>	links;
+	};
+
+	Site	* createSite(uintptr_t target);
+	void	rechain(Site & site);
+
+	std::mutex	m_lock;
+	u32			m_nextOrder;
+	bool		m_countCalls;
+
+	std::unordered_map <uintptr_t, Site>	m_sites;
+};
+
+extern DetourManager g_detourManager;
+
+bool AttachOBSEDetour(PluginHandle plugin, void * target, void * handler, std::int32_t priority, void ** original);
+bool DetachOBSEDetour(PluginHandle plugin, void * target, void * handler);
+std::uint64_t GetOBSEDetourCallCount(void * target);
+void * AttachOBSEHookThunk(PluginHandle plugin, void * target, std::uint32_t numArgs, std::uint32_t floatArgs, bool floatReturn,
+	void * pre, void * post, std::int32_t priority);
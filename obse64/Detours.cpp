@@ -0,0 +1,242 @@
+#include "Detours.h"
+#include "obse64_common/BranchTrampoline.h"
+#include "obse64_common/InstructionDecoder.h"
+#include "obse64_common/SafeWrite.h"
+#include "obse64_common/Log.h"
+#include "xbyak/xbyak.h"
+#include <climits>
+#include <cstring>
+
+// jmp [rip] followed by the absolute target
+static void EmitAbsoluteJump(Xbyak::CodeGenerator & code, uintptr_t target)
+{
+	code.jmp(code.ptr[code.rip]);
+	code.dq(target);
+}
+
+static bool IsUnconditionalExit(const DecodedInstruction & instr)
+{
+	if(instr.map != DecodedInstruction::kMap_Legacy)
+		return false;
+
+	switch(instr.opcode)
+	{
+		case 0xC2:	// ret
+		case 0xC3:
+		case 0xCA:
+		case 0xCB:
+		case 0xCC:	// int3, usually padding
+		case 0xE9:	// jmp
+		case 0xEB:
+			return true;
+
+		case 0xFF:	// jmp r/m
+			return ((instr.modrm >> 3) & 7) == 4;
+	}
+
+	return false;
+}
+
+static bool RelocateBranch(Xbyak::CodeGenerator & code, const u8 * src, const DecodedInstruction & instr, uintptr_t target)
+{
+	if(instr.map == DecodedInstruction::kMap_0F)
+	{
+		// jcc rel32, becomes an inverted short jcc over an absolute jump
+		code.db(0x70 | ((instr.opcode & 0x0F) ^ 1));
+		code.db(14);
+		EmitAbsoluteJump(code, target);
+
+		return true;
+	}
+
+	if(instr.map != DecodedInstruction::kMap_Legacy)
+		return false;
+
+	u8 opcode = instr.opcode;
+
+	if((opcode >= 0x70) && (opcode <= 0x7F))
+	{
+		// jcc rel8
+		code.db(opcode ^ 1);
+		code.db(14);
+		EmitAbsoluteJump(code, target);
+	}
+	else if((opcode >= 0xE0) && (opcode <= 0xE3))
+	{
+		// loop/jrcxz only exist as rel8, so branch to a local absolute jump instead
+		// keep the prefixes, 67 changes the counter register
+		code.db(src, instr.opcodeOffset);
+		code.db(opcode);
+		code.db(2);
+		code.db(0xEB);	// jmp over the absolute jump when not taken
+		code.db(14);
+		EmitAbsoluteJump(code, target);
+	}
+	else if((opcode == 0xE9) || (opcode == 0xEB))
+	{
+		EmitAbsoluteJump(code, target);
+	}
+	else if(opcode == 0xE8)
+	{
+		// call [rip+2], jmp over the target address
+		Xbyak::Label addr, done;
+
+		code.call(code.ptr[code.rip + addr]);
+		code.jmp(done, Xbyak::CodeGenerator::T_SHORT);
+		code.L(addr);
+		code.dq(target);
+		code.L(done);
+	}
+	else
+	{
+		// xbegin
+		return false;
+	}
+
+	return true;
+}
+
+static size_t RelocateInstructions_Internal(Xbyak::CodeGenerator & code, uintptr_t src, size_t minLen)
+{
+	const u8 * start = (const u8 *)src;
+
+	// decode everything first so nothing is emitted for code we can't move
+	DecodedInstruction instrs[16];
+	u32 numInstrs = 0;
+	size_t len = 0;
+
+	while(len < minLen)
+	{
+		if(numInstrs >= sizeof(instrs) / sizeof(instrs[0]))
+			return 0;
+
+		DecodedInstruction & instr = instrs[numInstrs++];
+
+		if(!decodeInstruction(start + len, &instr))
+		{
+			_ERROR("RelocateInstructions: couldn't decode %016I64X", src + len);
+			return 0;
+		}
+
+		len += instr.len;
+
+		// the function ends before there's enough room for the patch
+		if(IsUnconditionalExit(instr) && (len < minLen))
+		{
+			_ERROR("RelocateInstructions: %016I64X is too short", src);
+			return 0;
+		}
+	}
+
+	size_t offset = 0;
+
+	for(u32 i = 0; i < numInstrs; i++)
+	{
+		const DecodedInstruction & instr = instrs[i];
+		const u8 * instrStart = start + offset;
+		uintptr_t next = uintptr_t(instrStart) + instr.len;
+
+		if(instr.hasFlag(DecodedInstruction::kFlag_RelBranch))
+		{
+			intptr_t displ = (instr.immSize == 1) ? s8(instrStart[instr.immOffset]) : *(const s32 *)(instrStart + instr.immOffset);
+			uintptr_t target = next + displ;
+
+			// branches back in to the code being moved would need to be remapped, not worth it for a prologue
+			// that includes src itself, which will hold the detour jmp
+			if((target >= src) && (target < src + len))
+			{
+				_ERROR("RelocateInstructions: %016I64X branches inside the relocated range", uintptr_t(instrStart));
+				return 0;
+			}
+
+			if(!RelocateBranch(code, instrStart, instr, target))
+			{
+				_ERROR("RelocateInstructions: can't relocate branch at %016I64X", uintptr_t(instrStart));
+				return 0;
+			}
+		}
+		else if(instr.hasFlag(DecodedInstruction::kFlag_RIPRelative))
+		{
+			uintptr_t target = next + *(const s32 *)(instrStart + instr.dispOffset);
+			uintptr_t newNext = uintptr_t(code.getCurr()) + instr.len;
+			intptr_t newDispl = intptr_t(target - newNext);
+
+			if((newDispl < INT_MIN) || (newDispl > INT_MAX))
+			{
+				_ERROR("RelocateInstructions: %016I64X references %016I64X, out of range of the new location", uintptr_t(instrStart), target);
+				return 0;
+			}
+
+			u8 buf[16];
+			memcpy(buf, instrStart, instr.len);
+			*(s32 *)(buf + instr.dispOffset) = s32(newDispl);
+
+			code.db(buf, instr.len);
+		}
+		else
+		{
+			code.db(instrStart, instr.len);
+		}
+
+		offset += instr.len;
+	}
+
+	EmitAbsoluteJump(code, src + len);
+
+	return len;
+}
+
+size_t RelocateInstructions(Xbyak::CodeGenerator & code, uintptr_t src, size_t minLen)
+{
+	try
+	{
+		return RelocateInstructions_Internal(code, src, minLen);
+	}
+	catch(const Xbyak::Error & err)
+	{
+		_ERROR("RelocateInstructions: %s", err.what());
+	}
+
+	return 0;
+}
+
+uintptr_t WriteDetour(BranchTrampoline & trampoline, uintptr_t src, uintptr_t dst)
+{
+	const size_t kBufSize = 128;	// enough for any prologue that fits the 5 byte jmp
+
+	void * buf = trampoline.allocate(kBufSize, src);
+	if(!buf)
+		return 0;
+
+	size_t len = 0;
+
+	{
+		BranchTrampoline::WriteWindow window(trampoline, buf, kBufSize);
+		Xbyak::CodeGenerator code(kBufSize, buf);
+
+		len = RelocateInstructions(code, src, 5);
+	}
+
+	if(!len)
+	{
+		trampoline.release(buf, kBufSize);
+		return 0;
+	}
+
+	if(!trampoline.write5Branch(src, dst))
+	{
+		trampoline.release(buf, kBufSize);
+		return 0;
+	}
+
+	// the rest of the moved instructions should never run
+	if(len > 5)
+	{
+		u8 pad[16];
+		memset(pad, 0xCC, sizeof(pad));
+
+		safeWriteBuf(src + 5, pad, len - 5);
+	}
+
+	return uintptr_t(buf);
+}
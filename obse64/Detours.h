@@ -0,0 +1,20 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+class BranchTrampoline;
+
+namespace Xbyak
+{
+	class CodeGenerator;
+}
+
+// copies whole instructions starting at src in to code until at least minLen bytes are covered, then jumps back to
+// the rest of the original function. RIP-relative operands and relative branches are rewritten for the new location
+// returns the number of bytes taken from src, or 0 if something there can't be moved
+size_t RelocateInstructions(Xbyak::CodeGenerator & code, uintptr_t src, size_t minLen);
+
+// redirects the function starting at src to dst with a 5-byte jmp
+// returns the address to call to run the original function, or 0 if nothing was written
+uintptr_t WriteDetour(BranchTrampoline & trampoline, uintptr_t src, uintptr_t dst);
@@ -1 +1,3 @@
 #include "obse64/GameConsole.h"
+
+RELOC_STATIC StaticRelocPtr <std::uintptr_t> _Console_Print(0x06593FA0);
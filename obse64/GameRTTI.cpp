@@ -0,0 +1,113 @@
+#include "GameRTTI.h"
+#include "obse64_common/Types.h"
+#include "obse64_common/LockFreeCache.h"
+#include <climits>
+#include <Windows.h>
+
+// type descriptor table, fixed up by RelocationManager
+#include "GameRTTI.inl"
+
+// vcruntime
+extern "C" void * __RTDynamicCast(void * inptr, long vfDelta, void * srcType, void * targetType, int isReference);
+
+// (vtable, from, to) -> pointer adjustment
+// the result of a cast only depends on the layout of the most derived class, which is identified by the vtable
+// of the subobject being cast, so it's safe to remember. everything is stored as RVAs so an entry fits in 16 bytes
+// the key is (vtable, from), the same key appears once per target type
+enum
+{
+	kDynamicCastCache_Failed = 0x80000000,	// adjustment value for failed casts
+};
+
+// key is vtable RVA | from RVA << 32, value is to RVA | adjustment << 32
+static LockFreeCache <u64, u64, 14> s_dynamicCastCache;
+
+static uintptr_t GetImageSize()
+{
+	static const uintptr_t s_imageSize = []()
+	{
+		auto * base = (const u8 *)RelocationManager::s_baseAddr;
+		auto * dosHeader = (const IMAGE_DOS_HEADER *)base;
+		auto * ntHeader = (const IMAGE_NT_HEADERS *)(base + dosHeader->e_lfanew);
+
+		return uintptr_t(ntHeader->OptionalHeader.SizeOfImage);
+	}();
+
+	return s_imageSize;
+}
+
+static u64 DynamicCastCache_Hash(u64 key, u32 toRVA)
+{
+	return (key ^ (u64(toRVA) * 0xC2B2AE3D27D4EB4F)) * 0x9E3779B97F4A7C15;
+}
+
+static bool DynamicCastCache_Lookup(u64 key, u32 toRVA, s32 * adjustOut)
+{
+	u64 value;
+	if(!s_dynamicCastCache.lookup(DynamicCastCache_Hash(key, toRVA), key, [toRVA](u64 entry) { return u32(entry) == toRVA; }, &value))
+		return false;
+
+	*adjustOut = s32(value >> 32);
+
+	return true;
+}
+
+static void DynamicCastCache_Insert(u64 key, u32 toRVA, s32 adjust)
+{
+	// if the neighborhood is full this cast will always take the slow path
+	s_dynamicCastCache.insert(DynamicCastCache_Hash(key, toRVA), key, u64(toRVA) | (u64(u32(adjust)) << 32));
+}
+
+void * Runtime_DynamicCast(void * srcObj, const void * fromType, const void * toType)
+{
+	if(!srcObj)
+		return nullptr;
+
+	uintptr_t base = RelocationManager::s_baseAddr;
+	uintptr_t imageSize = GetImageSize();
+
+	uintptr_t vtbl = *(uintptr_t *)srcObj;
+	uintptr_t vtblRVA = vtbl - base;
+	uintptr_t fromRVA = uintptr_t(fromType) - base;
+	uintptr_t toRVA = uintptr_t(toType) - base;
+
+	// classes defined outside of the executable (plugins) don't get cached
+	// rva zero is never a vtable or type descriptor, so a zero key always means an empty slot
+	bool cacheable = vtblRVA && (vtblRVA < imageSize) && (fromRVA < imageSize) && toRVA && (toRVA < imageSize);
+
+	u64 key = u64(vtblRVA) | (u64(fromRVA) << 32);
+
+	if(cacheable)
+	{
+		s32 adjust;
+		if(DynamicCastCache_Lookup(key, u32(toRVA), &adjust))
+		{
+			if(adjust == s32(kDynamicCastCache_Failed))
+				return nullptr;
+
+			return (u8 *)srcObj + adjust;
+		}
+	}
+
+	void * result = __RTDynamicCast(srcObj, 0, (void *)fromType, (void *)toType, 0);
+
+	if(cacheable)
+	{
+		s32 adjust = s32(kDynamicCastCache_Failed);
+
+		if(result)
+		{
+			intptr_t delta = intptr_t(result) - intptr_t(srcObj);
+
+			// should never happen, but don't cache something that doesn't fit
+			if((delta <= INT_MIN) || (delta > INT_MAX))
+				return result;
+
+			adjust = s32(delta);
+		}
+
+		DynamicCastCache_Insert(key, u32(toRVA), adjust);
+	}
+
+	return result;
+}
@@ -1,1374 +1,1376 @@
 #pragma once
 
+#include "obse64_common/Relocation.h"
+
 void * Runtime_DynamicCast(void * srcObj, const void * fromType, const void * toType);
 
 #define DYNAMIC_CAST(obj, from, to) ( ## to *) Runtime_DynamicCast((void*)(obj), RTTI_ ## from, RTTI_ ## to)
 
-extern const void * RTTI_AStarNodeList;
-extern const void * RTTI_AStarWorldNodeList;
-extern const void * RTTI_AbsorbEffect;
-extern const void * RTTI_ActiveEffect;
-extern const void * RTTI_Actor;
-extern const void * RTTI_AlarmPackage;
-extern const void * RTTI_AlchemyItem;
-extern const void * RTTI_AlchemyMenu;
-extern const void * RTTI_AnimSequenceBase;
-extern const void * RTTI_AnimSequenceMultiple;
-extern const void * RTTI_AnimSequenceSingle;
-extern const void * RTTI_Archive;
-extern const void * RTTI_ArchiveFile;
-extern const void * RTTI_ArrowProjectile;
-extern const void * RTTI_AssociatedItemEffect;
-extern const void * RTTI_Atmosphere;
-extern const void * RTTI_AttachDistant3DTask;
-extern const void * RTTI_AudioMenu;
-extern const void * RTTI_BSAnimGroupSequence;
-extern const void * RTTI_BSBound;
-extern const void * RTTI_BSClearZNode;
-extern const void * RTTI_BSCullingProcess;
-extern const void * RTTI_BSDoorHavokController;
-extern const void * RTTI_BSExtraData;
-extern const void * RTTI_BSFaceGenAnimationData;
-extern const void * RTTI_BSFaceGenBaseMorphExtraData;
-extern const void * RTTI_BSFaceGenBinaryFile;
-extern const void * RTTI_BSFaceGenKeyframe;
-extern const void * RTTI_BSFaceGenKeyframeMultiple;
-extern const void * RTTI_BSFaceGenModel;
-extern const void * RTTI_BSFaceGenModelExtraData;
-extern const void * RTTI_BSFaceGenModelMap;
-extern const void * RTTI_BSFaceGenModelMap__Entry;
-extern const void * RTTI_BSFaceGenMorph;
-extern const void * RTTI_BSFaceGenMorphDataHair;
-extern const void * RTTI_BSFaceGenMorphDataHead;
-extern const void * RTTI_BSFaceGenMorphDifferential;
-extern const void * RTTI_BSFaceGenMorphStatistical;
-extern const void * RTTI_BSFaceGenNiNode;
-extern const void * RTTI_BSFadeNode;
-extern const void * RTTI_BSFile;
-extern const void * RTTI_BSFogProperty;
-extern const void * RTTI_BSFurnitureMarker;
-extern const void * RTTI_BSNodeReferences;
-extern const void * RTTI_BSPSysArrayEmitter;
-extern const void * RTTI_BSPackedAdditionalGeometryData;
-extern const void * RTTI_BSPackedAdditionalGeometryData__NiBSPackedAGDDataBlock;
-extern const void * RTTI_BSParentVelocityModifier;
-extern const void * RTTI_BSPlayerDistanceCheckController;
-extern const void * RTTI_BSReference;
-extern const void * RTTI_BSScissorNode;
-extern const void * RTTI_BSScissorTriShape;
-extern const void * RTTI_BSSearchPath;
-extern const void * RTTI_BSShaderAccumulator;
-extern const void * RTTI_BSStream;
-extern const void * RTTI_BSTaskThread;
-extern const void * RTTI_BSTempEffect;
-extern const void * RTTI_BSTempEffectDecal;
-extern const void * RTTI_BSTempEffectGeometryDecal;
-extern const void * RTTI_BSTempEffectParticle;
-extern const void * RTTI_BSTempNode;
-extern const void * RTTI_BSTempNodeManager;
-extern const void * RTTI_BSTexturePalette;
-extern const void * RTTI_BSThread;
-extern const void * RTTI_BSTreeModel;
-extern const void * RTTI_BSTreeNode;
-extern const void * RTTI_BSWindModifier;
-extern const void * RTTI_BSXFlags;
-extern const void * RTTI_BackgroundCloneThread;
-extern const void * RTTI_BackgroundLoader;
-extern const void * RTTI_BackgroundLoaderThread;
-extern const void * RTTI_BaseExtraList;
-extern const void * RTTI_BaseProcess;
-extern const void * RTTI_BirthSign;
-extern const void * RTTI_BlendSettingCollection;
-extern const void * RTTI_BoltShaderProperty;
-extern const void * RTTI_BookMenu;
-extern const void * RTTI_BoundItemEffect;
-extern const void * RTTI_BreathMenu;
-extern const void * RTTI_CBillboardLeaf;
-extern const void * RTTI_CIdvCamera;
-extern const void * RTTI_CSingletonCriticalSection;
-extern const void * RTTI_CTreeEngine;
-extern const void * RTTI_CalmEffect;
-extern const void * RTTI_CellMopp;
-extern const void * RTTI_ChameleonEffect;
-extern const void * RTTI_ChangesMap;
-extern const void * RTTI_Character;
-extern const void * RTTI_ClassMenu;
-extern const void * RTTI_Clouds;
-extern const void * RTTI_CombatController;
-extern const void * RTTI_CommandCreatureEffect;
-extern const void * RTTI_CommandEffect;
-extern const void * RTTI_CommandHumanoidEffect;
-extern const void * RTTI_CompressedArchiveFile;
-extern const void * RTTI_ContainerMenu;
-extern const void * RTTI_Controls;
-extern const void * RTTI_ControlsMenu;
-extern const void * RTTI_Creature;
-extern const void * RTTI_CreditsMenu;
-extern const void * RTTI_CureEffect;
-extern const void * RTTI_DarknessEffect;
-extern const void * RTTI_DebugTextExtraData;
-extern const void * RTTI_DefaultCombatStyle;
-extern const void * RTTI_DemoralizeEffect;
-extern const void * RTTI_DetectLifeEffect;
-extern const void * RTTI_DialogMenu;
-extern const void * RTTI_DialoguePackage;
-extern const void * RTTI_DisintegrateArmorEffect;
-extern const void * RTTI_DisintegrateWeaponEffect;
-extern const void * RTTI_DispelEffect;
-extern const void * RTTI_DistantLODLoaderTask;
-extern const void * RTTI_EffectItem;
-extern const void * RTTI_EffectItemList;
-extern const void * RTTI_EffectSetting;
-extern const void * RTTI_EffectSettingCollection;
-extern const void * RTTI_EffectSettingMenu;
-extern const void * RTTI_EnchantmentItem;
-extern const void * RTTI_EnchantmentMenu;
-extern const void * RTTI_ExportAlchemyItem;
-extern const void * RTTI_ExportBaseFormComponent;
-extern const void * RTTI_ExportEffectItem;
-extern const void * RTTI_ExportMagicItem;
-extern const void * RTTI_ExportMagicItemObject;
-extern const void * RTTI_ExportTESActorBase;
-extern const void * RTTI_ExportTESActorBaseData;
-extern const void * RTTI_ExportTESAmmo;
-extern const void * RTTI_ExportTESAnimation;
-extern const void * RTTI_ExportTESAttributes;
-extern const void * RTTI_ExportTESContainer;
-extern const void * RTTI_ExportTESCreature;
-extern const void * RTTI_ExportTESForm;
-extern const void * RTTI_ExportTESIcon;
-extern const void * RTTI_ExportTESModel;
-extern const void * RTTI_ExportTESModelList;
-extern const void * RTTI_ExportTESNPC;
-extern const void * RTTI_ExportTESObjectARMO;
-extern const void * RTTI_ExportTESObjectBOOK;
-extern const void * RTTI_ExportTESObjectCLOT;
-extern const void * RTTI_ExportTESObjectREFR;
-extern const void * RTTI_ExportTESObjectWEAP;
-extern const void * RTTI_ExportTESRace;
-extern const void * RTTI_ExportTESReactionForm;
-extern const void * RTTI_ExportTESSpellList;
-extern const void * RTTI_ExportTESTexture;
-extern const void * RTTI_ExteriorCellNewReferencesMap;
-extern const void * RTTI_ExtraAction;
-extern const void * RTTI_ExtraAltarActorGUID;
-extern const void * RTTI_ExtraAltarBPVariant;
-extern const void * RTTI_ExtraAltarData;
-extern const void * RTTI_ExtraAnim;
-extern const void * RTTI_ExtraBoundArmor;
-extern const void * RTTI_ExtraCannotWear;
-extern const void * RTTI_ExtraCell3D;
-extern const void * RTTI_ExtraCellCanopyShadowMask;
-extern const void * RTTI_ExtraCellClimate;
-extern const void * RTTI_ExtraCellMusicType;
-extern const void * RTTI_ExtraCellWaterType;
-extern const void * RTTI_ExtraCharge;
-extern const void * RTTI_ExtraContainerChanges;
-extern const void * RTTI_ExtraCount;
-extern const void * RTTI_ExtraCrimeGold;
-extern const void * RTTI_ExtraDataList;
-extern const void * RTTI_ExtraDetachTime;
-extern const void * RTTI_ExtraDistantData;
-extern const void * RTTI_ExtraDroppedItemList;
-extern const void * RTTI_ExtraEditorID;
-extern const void * RTTI_ExtraEditorRefMoveData;
-extern const void * RTTI_ExtraEnableStateChildren;
-extern const void * RTTI_ExtraEnableStateParent;
-extern const void * RTTI_ExtraFollower;
-extern const void * RTTI_ExtraFriendHitList;
-extern const void * RTTI_ExtraGhost;
-extern const void * RTTI_ExtraGlobal;
-extern const void * RTTI_ExtraHaggleAmount;
-extern const void * RTTI_ExtraHasNoRumors;
-extern const void * RTTI_ExtraHavok;
-extern const void * RTTI_ExtraHeadingTarget;
-extern const void * RTTI_ExtraHealth;
-extern const void * RTTI_ExtraInfoGeneralTopic;
-extern const void * RTTI_ExtraInvestmentGold;
-extern const void * RTTI_ExtraItemDropper;
-extern const void * RTTI_ExtraLastFinishedSequence;
-extern const void * RTTI_ExtraLevCreaModifier;
-extern const void * RTTI_ExtraLeveledCreature;
-extern const void * RTTI_ExtraLeveledItem;
-extern const void * RTTI_ExtraLight;
-extern const void * RTTI_ExtraLock;
-extern const void * RTTI_ExtraMapMarker;
-extern const void * RTTI_ExtraMerchantContainer;
-extern const void * RTTI_ExtraNorthRotation;
-extern const void * RTTI_ExtraOblivionEntry;
-extern const void * RTTI_ExtraOriginalReference;
-extern const void * RTTI_ExtraOwnership;
-extern const void * RTTI_ExtraPackage;
-extern const void * RTTI_ExtraPackageStartLocation;
-extern const void * RTTI_ExtraPersistentCell;
-extern const void * RTTI_ExtraPersuasionPercent;
-extern const void * RTTI_ExtraPoison;
-extern const void * RTTI_ExtraProcessMiddleLow;
-extern const void * RTTI_ExtraQuickKey;
-extern const void * RTTI_ExtraRagDollData;
-extern const void * RTTI_ExtraRandomTeleportMarker;
-extern const void * RTTI_ExtraRank;
-extern const void * RTTI_ExtraReferencePointer;
-extern const void * RTTI_ExtraRefractionProperty;
-extern const void * RTTI_ExtraRegionList;
-extern const void * RTTI_ExtraRunOncePacks;
-extern const void * RTTI_ExtraSavedMovementData;
-extern const void * RTTI_ExtraScale;
-extern const void * RTTI_ExtraScript;
-extern const void * RTTI_ExtraSeed;
-extern const void * RTTI_ExtraSeenData;
-extern const void * RTTI_ExtraSoul;
-extern const void * RTTI_ExtraSound;
-extern const void * RTTI_ExtraStartingPosition;
-extern const void * RTTI_ExtraStartingWorldOrCell;
-extern const void * RTTI_ExtraTeleport;
-extern const void * RTTI_ExtraTimeLeft;
-extern const void * RTTI_ExtraTravelHorse;
-extern const void * RTTI_ExtraTresPassPackage;
-extern const void * RTTI_ExtraUsedMarkers;
-extern const void * RTTI_ExtraUses;
-extern const void * RTTI_ExtraWaterHeight;
-extern const void * RTTI_ExtraWorn;
-extern const void * RTTI_ExtraWornLeft;
-extern const void * RTTI_ExtraXTarget;
-extern const void * RTTI_FAutoConsoleObject;
-extern const void * RTTI_FDefaultModuleImpl;
-extern const void * RTTI_FExrReaderGpuModule;
-extern const void * RTTI_FGlobalShaderType;
-extern const void * RTTI_FOpenExrRTTIModule;
-extern const void * RTTI_FadeNodeMaxAlphaExtraData;
-extern const void * RTTI_FileFinder;
-extern const void * RTTI_FleePackage;
-extern const void * RTTI_FrenzyEffect;
-extern const void * RTTI_FutBinaryFileC;
-extern const void * RTTI_GameSettingCollection;
-extern const void * RTTI_GameplayMenu;
-extern const void * RTTI_GenericMenu;
-extern const void * RTTI_GridArray;
-extern const void * RTTI_GridCellArray;
-extern const void * RTTI_GridDistantArray;
-extern const void * RTTI_HUDInfoMenu;
-extern const void * RTTI_HUDMainMenu;
-extern const void * RTTI_HUDReticle;
-extern const void * RTTI_HUDSubtitleMenu;
-extern const void * RTTI_HavokError;
-extern const void * RTTI_HavokFileStreambufReader;
-extern const void * RTTI_HavokFileStreambufWriter;
-extern const void * RTTI_HavokStreambufFactory;
-extern const void * RTTI_HavokStreambufWriter;
-extern const void * RTTI_HighProcess;
-extern const void * RTTI_IModuleInterface;
-extern const void * RTTI_INISettingCollection;
-extern const void * RTTI_IOManager;
-extern const void * RTTI_IVPairableItem;
-extern const void * RTTI_IconArray;
-extern const void * RTTI_IdvFileError;
-extern const void * RTTI_Iex_3_1__ArgExc;
-extern const void * RTTI_Iex_3_1__BaseExc;
-extern const void * RTTI_Iex_3_1__E2bigExc;
-extern const void * RTTI_Iex_3_1__EaccesExc;
-extern const void * RTTI_Iex_3_1__EaddrinuseExc;
-extern const void * RTTI_Iex_3_1__EaddrnotavailExc;
-extern const void * RTTI_Iex_3_1__EafnosupportExc;
-extern const void * RTTI_Iex_3_1__EagainExc;
-extern const void * RTTI_Iex_3_1__EalreadyExc;
-extern const void * RTTI_Iex_3_1__EbadfExc;
-extern const void * RTTI_Iex_3_1__EbadmsgExc;
-extern const void * RTTI_Iex_3_1__EbusyExc;
-extern const void * RTTI_Iex_3_1__EcanceledExc;
-extern const void * RTTI_Iex_3_1__EchildExc;
-extern const void * RTTI_Iex_3_1__EconnabortedExc;
-extern const void * RTTI_Iex_3_1__EconnrefusedExc;
-extern const void * RTTI_Iex_3_1__EconnresetExc;
-extern const void * RTTI_Iex_3_1__EdeadlkExc;
-extern const void * RTTI_Iex_3_1__EdestaddrreqExc;
-extern const void * RTTI_Iex_3_1__EdomExc;
-extern const void * RTTI_Iex_3_1__EexistExc;
-extern const void * RTTI_Iex_3_1__EfaultExc;
-extern const void * RTTI_Iex_3_1__EfbigExc;
-extern const void * RTTI_Iex_3_1__EhostunreachExc;
-extern const void * RTTI_Iex_3_1__EidrmExc;
-extern const void * RTTI_Iex_3_1__EilseqExc;
-extern const void * RTTI_Iex_3_1__EinprogressExc;
-extern const void * RTTI_Iex_3_1__EintrExc;
-extern const void * RTTI_Iex_3_1__EinvalExc;
-extern const void * RTTI_Iex_3_1__EioExc;
-extern const void * RTTI_Iex_3_1__EisconnExc;
-extern const void * RTTI_Iex_3_1__EisdirExc;
-extern const void * RTTI_Iex_3_1__EloopExc;
-extern const void * RTTI_Iex_3_1__EmfileExc;
-extern const void * RTTI_Iex_3_1__EmlinkExc;
-extern const void * RTTI_Iex_3_1__EmsgsizeExc;
-extern const void * RTTI_Iex_3_1__EnametoolongExc;
-extern const void * RTTI_Iex_3_1__EnetdownExc;
-extern const void * RTTI_Iex_3_1__EnetresetExc;
-extern const void * RTTI_Iex_3_1__EnetunreachExc;
-extern const void * RTTI_Iex_3_1__EnfileExc;
-extern const void * RTTI_Iex_3_1__EnobufsExc;
-extern const void * RTTI_Iex_3_1__EnodataExc;
-extern const void * RTTI_Iex_3_1__EnodevExc;
-extern const void * RTTI_Iex_3_1__EnoentExc;
-extern const void * RTTI_Iex_3_1__EnoexecExc;
-extern const void * RTTI_Iex_3_1__EnolckExc;
-extern const void * RTTI_Iex_3_1__EnolinkExc;
-extern const void * RTTI_Iex_3_1__EnomemExc;
-extern const void * RTTI_Iex_3_1__EnomsgExc;
-extern const void * RTTI_Iex_3_1__EnoprotooptExc;
-extern const void * RTTI_Iex_3_1__EnospcExc;
-extern const void * RTTI_Iex_3_1__EnosrExc;
-extern const void * RTTI_Iex_3_1__EnostrExc;
-extern const void * RTTI_Iex_3_1__EnosysExc;
-extern const void * RTTI_Iex_3_1__EnotconnExc;
-extern const void * RTTI_Iex_3_1__EnotdirExc;
-extern const void * RTTI_Iex_3_1__EnotemptyExc;
-extern const void * RTTI_Iex_3_1__EnotsockExc;
-extern const void * RTTI_Iex_3_1__EnotsupExc;
-extern const void * RTTI_Iex_3_1__EnottyExc;
-extern const void * RTTI_Iex_3_1__EnxioExc;
-extern const void * RTTI_Iex_3_1__EopnotsuppExc;
-extern const void * RTTI_Iex_3_1__EoverflowExc;
-extern const void * RTTI_Iex_3_1__EpermExc;
-extern const void * RTTI_Iex_3_1__EpipeExc;
-extern const void * RTTI_Iex_3_1__EprotoExc;
-extern const void * RTTI_Iex_3_1__EprotonosupportExc;
-extern const void * RTTI_Iex_3_1__EprototypeExc;
-extern const void * RTTI_Iex_3_1__ErangeExc;
-extern const void * RTTI_Iex_3_1__ErofsExc;
-extern const void * RTTI_Iex_3_1__ErrnoExc;
-extern const void * RTTI_Iex_3_1__EspipeExc;
-extern const void * RTTI_Iex_3_1__EsrchExc;
-extern const void * RTTI_Iex_3_1__EtimeExc;
-extern const void * RTTI_Iex_3_1__EtimedoutExc;
-extern const void * RTTI_Iex_3_1__EtxtbsyExc;
-extern const void * RTTI_Iex_3_1__ExdevExc;
-extern const void * RTTI_Iex_3_1__InputExc;
-extern const void * RTTI_Iex_3_1__IoExc;
-extern const void * RTTI_Iex_3_1__LogicExc;
-extern const void * RTTI_Iex_3_1__MathExc;
-extern const void * RTTI_Iex_3_1__NoImplExc;
-extern const void * RTTI_Iex_3_1__OverflowExc;
-extern const void * RTTI_Iex_3_1__TypeExc;
-extern const void * RTTI_IlmThread_3_1__Semaphore;
-extern const void * RTTI_IlmThread_3_1__Task;
-extern const void * RTTI_IlmThread_3_1__Thread;
-extern const void * RTTI_IlmThread_3_1__ThreadPool;
-extern const void * RTTI_IlmThread_3_1__ThreadPoolProvider;
-extern const void * RTTI_Imf_3_1__Attribute;
-extern const void * RTTI_Imf_3_1__B44Compressor;
-extern const void * RTTI_Imf_3_1__CompositeDeepScanLine;
-extern const void * RTTI_Imf_3_1__Compressor;
-extern const void * RTTI_Imf_3_1__DeepCompositing;
-extern const void * RTTI_Imf_3_1__DeepScanLineInputFile;
-extern const void * RTTI_Imf_3_1__DwaCompressor;
-extern const void * RTTI_Imf_3_1__DwaCompressor__LossyDctDecoder;
-extern const void * RTTI_Imf_3_1__DwaCompressor__LossyDctDecoderBase;
-extern const void * RTTI_Imf_3_1__DwaCompressor__LossyDctDecoderCsc;
-extern const void * RTTI_Imf_3_1__DwaCompressor__LossyDctEncoder;
-extern const void * RTTI_Imf_3_1__DwaCompressor__LossyDctEncoderBase;
-extern const void * RTTI_Imf_3_1__DwaCompressor__LossyDctEncoderCsc;
-extern const void * RTTI_Imf_3_1__GenericInputFile;
-extern const void * RTTI_Imf_3_1__GenericOutputFile;
-extern const void * RTTI_Imf_3_1__IStream;
-extern const void * RTTI_Imf_3_1__InputFile;
-extern const void * RTTI_Imf_3_1__MultiPartInputFile;
-extern const void * RTTI_Imf_3_1__OStream;
-extern const void * RTTI_Imf_3_1__OpaqueAttribute;
-extern const void * RTTI_Imf_3_1__OutputFile;
-extern const void * RTTI_Imf_3_1__PizCompressor;
-extern const void * RTTI_Imf_3_1__Pxr24Compressor;
-extern const void * RTTI_Imf_3_1__RgbaInputFile;
-extern const void * RTTI_Imf_3_1__RleCompressor;
-extern const void * RTTI_Imf_3_1__ScanLineInputFile;
-extern const void * RTTI_Imf_3_1__StdIFStream;
-extern const void * RTTI_Imf_3_1__StdOSStream;
-extern const void * RTTI_Imf_3_1__TiledInputFile;
-extern const void * RTTI_Imf_3_1__ZipCompressor;
-extern const void * RTTI_IngredientItem;
-extern const void * RTTI_IntSeenData;
-extern const void * RTTI_InterfacedClass;
-extern const void * RTTI_InteriorCellNewReferencesMap;
-extern const void * RTTI_InventoryMenu;
-extern const void * RTTI_InvisibilityEffect;
-extern const void * RTTI_LevelUpMenu;
-extern const void * RTTI_LightEffect;
-extern const void * RTTI_LipSynchroSettingCollection;
-extern const void * RTTI_LipTask;
-extern const void * RTTI_LoadgameMenu;
-extern const void * RTTI_LoadingMenu;
-extern const void * RTTI_LockEffect;
-extern const void * RTTI_LockPickMenu;
-extern const void * RTTI_LowProcess;
-extern const void * RTTI_MagicBallProjectile;
-extern const void * RTTI_MagicBoltProjectile;
-extern const void * RTTI_MagicCaster;
-extern const void * RTTI_MagicFogProjectile;
-extern const void * RTTI_MagicHitEffect;
-extern const void * RTTI_MagicItem;
-extern const void * RTTI_MagicItemObject;
-extern const void * RTTI_MagicMenu;
-extern const void * RTTI_MagicModelHitEffect;
-extern const void * RTTI_MagicPopupMenu;
-extern const void * RTTI_MagicProjectile;
-extern const void * RTTI_MagicShaderHitEffect;
-extern const void * RTTI_MagicSprayProjectile;
-extern const void * RTTI_MagicTarget;
-extern const void * RTTI_MainMenu;
-extern const void * RTTI_MapMenu;
-extern const void * RTTI_Menu;
-extern const void * RTTI_MessageHandler;
-extern const void * RTTI_MessageMenu;
-extern const void * RTTI_MiddleHighProcess;
-extern const void * RTTI_MiddleLowProcess;
-extern const void * RTTI_MobileObject;
-extern const void * RTTI_Moon;
-extern const void * RTTI_NegotiateMenu;
-extern const void * RTTI_NiAVObject;
-extern const void * RTTI_NiAVObjectPalette;
-extern const void * RTTI_NiAccumulator;
-extern const void * RTTI_NiAdditionalGeometryData;
-extern const void * RTTI_NiAdditionalGeometryData__NiAGDDataBlock;
-extern const void * RTTI_NiAlphaAccumulator;
-extern const void * RTTI_NiAlphaController;
-extern const void * RTTI_NiAlphaProperty;
-extern const void * RTTI_NiAmbientLight;
-extern const void * RTTI_NiBSBoneLODController;
-extern const void * RTTI_NiBSPNode;
-extern const void * RTTI_NiBSplineBasisData;
-extern const void * RTTI_NiBSplineColorInterpolator;
-extern const void * RTTI_NiBSplineCompColorInterpolator;
-extern const void * RTTI_NiBSplineCompFloatInterpolator;
-extern const void * RTTI_NiBSplineCompPoint3Interpolator;
-extern const void * RTTI_NiBSplineCompTransformInterpolator;
-extern const void * RTTI_NiBSplineData;
-extern const void * RTTI_NiBSplineFloatInterpolator;
-extern const void * RTTI_NiBSplineInterpolator;
-extern const void * RTTI_NiBSplinePoint3Interpolator;
-extern const void * RTTI_NiBSplineTransformInterpolator;
-extern const void * RTTI_NiBackToFrontAccumulator;
-extern const void * RTTI_NiBillboardNode;
-extern const void * RTTI_NiBinaryExtraData;
-extern const void * RTTI_NiBinaryStream;
-extern const void * RTTI_NiBlendAccumTransformInterpolator;
-extern const void * RTTI_NiBlendBoolInterpolator;
-extern const void * RTTI_NiBlendColorInterpolator;
-extern const void * RTTI_NiBlendFloatInterpolator;
-extern const void * RTTI_NiBlendInterpolator;
-extern const void * RTTI_NiBlendPoint3Interpolator;
-extern const void * RTTI_NiBlendQuaternionInterpolator;
-extern const void * RTTI_NiBlendTransformInterpolator;
-extern const void * RTTI_NiBoneLODController;
-extern const void * RTTI_NiBoolData;
-extern const void * RTTI_NiBoolInterpController;
-extern const void * RTTI_NiBoolInterpolator;
-extern const void * RTTI_NiBoolTimelineInterpolator;
-extern const void * RTTI_NiBooleanExtraData;
-extern const void * RTTI_NiBoundingVolume;
-extern const void * RTTI_NiBoxBV;
-extern const void * RTTI_NiBoxCapsuleIntersector;
-extern const void * RTTI_NiBoxSphereIntersector;
-extern const void * RTTI_NiCamera;
-extern const void * RTTI_NiCapsuleBV;
-extern const void * RTTI_NiCapsuleCapsuleIntersector;
-extern const void * RTTI_NiCapsuleSphereIntersector;
-extern const void * RTTI_NiCapsuleTriIntersector;
-extern const void * RTTI_NiCollisionData;
-extern const void * RTTI_NiCollisionObject;
-extern const void * RTTI_NiColorData;
-extern const void * RTTI_NiColorExtraData;
-extern const void * RTTI_NiColorExtraDataController;
-extern const void * RTTI_NiColorInterpolator;
-extern const void * RTTI_NiControllerManager;
-extern const void * RTTI_NiControllerSequence;
-extern const void * RTTI_NiCullingProcess;
-extern const void * RTTI_NiDX9Renderer;
-extern const void * RTTI_NiDefaultAVObjectPalette;
-extern const void * RTTI_NiDirectionalLight;
-extern const void * RTTI_NiDitherProperty;
-extern const void * RTTI_NiDynamicEffect;
-extern const void * RTTI_NiDynamicEffectState;
-extern const void * RTTI_NiExtraData;
-extern const void * RTTI_NiExtraDataController;
-extern const void * RTTI_NiFile;
-extern const void * RTTI_NiFlipController;
-extern const void * RTTI_NiFloatController;
-extern const void * RTTI_NiFloatData;
-extern const void * RTTI_NiFloatExtraData;
-extern const void * RTTI_NiFloatExtraDataController;
-extern const void * RTTI_NiFloatInterpController;
-extern const void * RTTI_NiFloatInterpolator;
-extern const void * RTTI_NiFloatsExtraData;
-extern const void * RTTI_NiFloatsExtraDataController;
-extern const void * RTTI_NiFloatsExtraDataPoint3Controller;
-extern const void * RTTI_NiFogProperty;
-extern const void * RTTI_NiFormArray;
-extern const void * RTTI_NiGeomMorpherController;
-extern const void * RTTI_NiGeomMorpherUpdateTask;
-extern const void * RTTI_NiGeometry;
-extern const void * RTTI_NiGeometryData;
-extern const void * RTTI_NiHalfSpaceBV;
-extern const void * RTTI_NiImageConverter;
-extern const void * RTTI_NiImageReader;
-extern const void * RTTI_NiIntegerExtraData;
-extern const void * RTTI_NiIntegersExtraData;
-extern const void * RTTI_NiInterpController;
-extern const void * RTTI_NiInterpolator;
-extern const void * RTTI_NiIntersector;
-extern const void * RTTI_NiKeyBasedInterpolator;
-extern const void * RTTI_NiKeyframeManager;
-extern const void * RTTI_NiLODData;
-extern const void * RTTI_NiLODNode;
-extern const void * RTTI_NiLight;
-extern const void * RTTI_NiLightColorController;
-extern const void * RTTI_NiLightDimmerController;
-extern const void * RTTI_NiLines;
-extern const void * RTTI_NiLinesData;
-extern const void * RTTI_NiLogBehavior;
-extern const void * RTTI_NiLookAtController;
-extern const void * RTTI_NiLookAtInterpolator;
-extern const void * RTTI_NiMaterialColorController;
-extern const void * RTTI_NiMaterialProperty;
-extern const void * RTTI_NiMemStream;
-extern const void * RTTI_NiMemoryLogBehavior;
-extern const void * RTTI_NiMeshPSysData;
-extern const void * RTTI_NiMeshParticleSystem;
-extern const void * RTTI_NiMorphData;
-extern const void * RTTI_NiMultiTargetTransformController;
-extern const void * RTTI_NiNIFImageReader;
-extern const void * RTTI_NiNode;
-extern const void * RTTI_NiOBBLeaf;
-extern const void * RTTI_NiOBBNode;
-extern const void * RTTI_NiOBBRoot;
-extern const void * RTTI_NiObject;
-extern const void * RTTI_NiObjectNET;
-extern const void * RTTI_NiPSysAgeDeathModifier;
-extern const void * RTTI_NiPSysAirFieldAirFrictionCtlr;
-extern const void * RTTI_NiPSysAirFieldInheritVelocityCtlr;
-extern const void * RTTI_NiPSysAirFieldModifier;
-extern const void * RTTI_NiPSysAirFieldSpreadCtlr;
-extern const void * RTTI_NiPSysBombModifier;
-extern const void * RTTI_NiPSysBoundUpdateModifier;
-extern const void * RTTI_NiPSysBoxEmitter;
-extern const void * RTTI_NiPSysCollider;
-extern const void * RTTI_NiPSysColliderManager;
-extern const void * RTTI_NiPSysColorModifier;
-extern const void * RTTI_NiPSysCylinderEmitter;
-extern const void * RTTI_NiPSysData;
-extern const void * RTTI_NiPSysDragFieldModifier;
-extern const void * RTTI_NiPSysDragModifier;
-extern const void * RTTI_NiPSysEmitter;
-extern const void * RTTI_NiPSysEmitterCtlr;
-extern const void * RTTI_NiPSysEmitterCtlrData;
-extern const void * RTTI_NiPSysEmitterDeclinationCtlr;
-extern const void * RTTI_NiPSysEmitterDeclinationVarCtlr;
-extern const void * RTTI_NiPSysEmitterInitialRadiusCtlr;
-extern const void * RTTI_NiPSysEmitterLifeSpanCtlr;
-extern const void * RTTI_NiPSysEmitterPlanarAngleCtlr;
-extern const void * RTTI_NiPSysEmitterPlanarAngleVarCtlr;
-extern const void * RTTI_NiPSysEmitterSpeedCtlr;
-extern const void * RTTI_NiPSysFieldAttenuationCtlr;
-extern const void * RTTI_NiPSysFieldMagnitudeCtlr;
-extern const void * RTTI_NiPSysFieldMaxDistanceCtlr;
-extern const void * RTTI_NiPSysFieldModifier;
-extern const void * RTTI_NiPSysGravityFieldModifier;
-extern const void * RTTI_NiPSysGravityModifier;
-extern const void * RTTI_NiPSysGravityStrengthCtlr;
-extern const void * RTTI_NiPSysGrowFadeModifier;
-extern const void * RTTI_NiPSysInitialRotAngleCtlr;
-extern const void * RTTI_NiPSysInitialRotAngleVarCtlr;
-extern const void * RTTI_NiPSysInitialRotSpeedCtlr;
-extern const void * RTTI_NiPSysInitialRotSpeedVarCtlr;
-extern const void * RTTI_NiPSysMeshEmitter;
-extern const void * RTTI_NiPSysMeshEmitter__NiSkinnedEmitterData;
-extern const void * RTTI_NiPSysMeshUpdateModifier;
-extern const void * RTTI_NiPSysModifier;
-extern const void * RTTI_NiPSysModifierActiveCtlr;
-extern const void * RTTI_NiPSysModifierBoolCtlr;
-extern const void * RTTI_NiPSysModifierCtlr;
-extern const void * RTTI_NiPSysModifierFloatCtlr;
-extern const void * RTTI_NiPSysPlanarCollider;
-extern const void * RTTI_NiPSysPositionModifier;
-extern const void * RTTI_NiPSysRadialFieldModifier;
-extern const void * RTTI_NiPSysResetOnLoopCtlr;
-extern const void * RTTI_NiPSysRotationModifier;
-extern const void * RTTI_NiPSysSpawnModifier;
-extern const void * RTTI_NiPSysSphereEmitter;
-extern const void * RTTI_NiPSysSphericalCollider;
-extern const void * RTTI_NiPSysTurbulenceFieldModifier;
-extern const void * RTTI_NiPSysUpdateCtlr;
-extern const void * RTTI_NiPSysUpdateTask;
-extern const void * RTTI_NiPSysVolumeEmitter;
-extern const void * RTTI_NiPSysVortexFieldModifier;
-extern const void * RTTI_NiPalette;
-extern const void * RTTI_NiParticleMeshes;
-extern const void * RTTI_NiParticleMeshesData;
-extern const void * RTTI_NiParticleSystem;
-extern const void * RTTI_NiParticles;
-extern const void * RTTI_NiParticlesData;
-extern const void * RTTI_NiPathController;
-extern const void * RTTI_NiPathInterpolator;
-extern const void * RTTI_NiPixelData;
-extern const void * RTTI_NiPoint3InterpController;
-extern const void * RTTI_NiPoint3Interpolator;
-extern const void * RTTI_NiPointLight;
-extern const void * RTTI_NiPosData;
-extern const void * RTTI_NiProfileLogBehavior;
-extern const void * RTTI_NiProfiler__CriticalSection;
-extern const void * RTTI_NiProfiler__FileInformation;
-extern const void * RTTI_NiProfiler__Profile;
-extern const void * RTTI_NiProfiler__String;
-extern const void * RTTI_NiPropertyState;
-extern const void * RTTI_NiQuaternionInterpolator;
-extern const void * RTTI_NiRangeLODData;
-extern const void * RTTI_NiRefObject;
-extern const void * RTTI_NiRenderTargetGroup;
-extern const void * RTTI_NiRenderer;
-extern const void * RTTI_NiRendererSpecificProperty;
-extern const void * RTTI_NiRollController;
-extern const void * RTTI_NiRotData;
-extern const void * RTTI_NiScreenElements;
-extern const void * RTTI_NiScreenElementsData;
-extern const void * RTTI_NiScreenGeometry;
-extern const void * RTTI_NiScreenGeometryData;
-extern const void * RTTI_NiScreenGeometryData__ScreenElement;
-extern const void * RTTI_NiScreenLODData;
-extern const void * RTTI_NiScreenPolygon;
-extern const void * RTTI_NiScreenSpaceCamera;
-extern const void * RTTI_NiScreenTexture;
-extern const void * RTTI_NiSearchPath;
-extern const void * RTTI_NiSequence;
-extern const void * RTTI_NiSequenceStreamHelper;
-extern const void * RTTI_NiShadeProperty;
-extern const void * RTTI_NiShader;
-extern const void * RTTI_NiSingleInterpController;
-extern const void * RTTI_NiSkinData;
-extern const void * RTTI_NiSkinInstance;
-extern const void * RTTI_NiSkinPartition;
-extern const void * RTTI_NiSkinPartition__Partition;
-extern const void * RTTI_NiSortAdjustNode;
-extern const void * RTTI_NiSourceCubeMap;
-extern const void * RTTI_NiSourceTexture;
-extern const void * RTTI_NiSpecularProperty;
-extern const void * RTTI_NiSphereBV;
-extern const void * RTTI_NiSphereTriIntersector;
-extern const void * RTTI_NiSpotLight;
-extern const void * RTTI_NiStencilProperty;
-extern const void * RTTI_NiStream;
-extern const void * RTTI_NiStringExtraData;
-extern const void * RTTI_NiStringPalette;
-extern const void * RTTI_NiStringsExtraData;
-extern const void * RTTI_NiSwitchNode;
-extern const void * RTTI_NiSwitchStringExtraData;
-extern const void * RTTI_NiTask;
-extern const void * RTTI_NiTextKeyExtraData;
-extern const void * RTTI_NiTexture;
-extern const void * RTTI_NiTextureEffect;
-extern const void * RTTI_NiTextureTransformController;
-extern const void * RTTI_NiTexturingProperty;
-extern const void * RTTI_NiTexturingProperty__BumpMap;
-extern const void * RTTI_NiTexturingProperty__Map;
-extern const void * RTTI_NiTexturingProperty__ShaderMap;
-extern const void * RTTI_NiTimeController;
-extern const void * RTTI_NiTransformController;
-extern const void * RTTI_NiTransformData;
-extern const void * RTTI_NiTransformInterpolator;
-extern const void * RTTI_NiTriBasedGeom;
-extern const void * RTTI_NiTriBasedGeomData;
-extern const void * RTTI_NiTriShape;
-extern const void * RTTI_NiTriShapeData;
-extern const void * RTTI_NiTriShapeDynamicData;
-extern const void * RTTI_NiTriStrips;
-extern const void * RTTI_NiTriStripsData;
-extern const void * RTTI_NiTriStripsDynamicData;
-extern const void * RTTI_NiUVController;
-extern const void * RTTI_NiUVData;
-extern const void * RTTI_NiUnionBV;
-extern const void * RTTI_NiVectorExtraData;
-extern const void * RTTI_NiVertWeightsExtraData;
-extern const void * RTTI_NiVertexColorProperty;
-extern const void * RTTI_NiVisController;
-extern const void * RTTI_NiWireframeProperty;
-extern const void * RTTI_NiZBufferProperty;
-extern const void * RTTI_NightEyeEffect;
-extern const void * RTTI_NonActorMagicCaster;
-extern const void * RTTI_NonActorMagicTarget;
-extern const void * RTTI_Normal;
-extern const void * RTTI_NumericIDBufferMap;
-extern const void * RTTI_OpenEffect;
-extern const void * RTTI_OptionsMenu;
-extern const void * RTTI_PArrayPoint;
-extern const void * RTTI_ParalysisEffect;
-extern const void * RTTI_PathBuilder;
-extern const void * RTTI_PathHigh;
-extern const void * RTTI_PathLow;
-extern const void * RTTI_PathMiddleHigh;
-extern const void * RTTI_PauseMenu;
-extern const void * RTTI_PersuasionMenu;
-extern const void * RTTI_PlayerCharacter;
-extern const void * RTTI_PosGen;
-extern const void * RTTI_Precipitation;
-extern const void * RTTI_QuantityMenu;
-extern const void * RTTI_QueuedAnimIdle;
-extern const void * RTTI_QueuedCharacter;
-extern const void * RTTI_QueuedChildren;
-extern const void * RTTI_QueuedCreature;
-extern const void * RTTI_QueuedDistantLOD;
-extern const void * RTTI_QueuedFile;
-extern const void * RTTI_QueuedFileEntry;
-extern const void * RTTI_QueuedHead;
-extern const void * RTTI_QueuedHelmet;
-extern const void * RTTI_QueuedKF;
-extern const void * RTTI_QueuedMagicItem;
-extern const void * RTTI_QueuedModel;
-extern const void * RTTI_QueuedPlayer;
-extern const void * RTTI_QueuedReference;
-extern const void * RTTI_QueuedTree;
-extern const void * RTTI_QueuedTreeModel;
-extern const void * RTTI_QuickKeysMenu;
-extern const void * RTTI_RaceSexMenu;
-extern const void * RTTI_Random;
-extern const void * RTTI_ReanimateEffect;
-extern const void * RTTI_RechargeMenu;
-extern const void * RTTI_RepairMenu;
-extern const void * RTTI_RepairMenu__RepairMenuList;
-extern const void * RTTI_SaveGameFile;
-extern const void * RTTI_SaveMenu;
-extern const void * RTTI_SceneGraph;
-extern const void * RTTI_Script;
-extern const void * RTTI_ScriptEffect;
-extern const void * RTTI_SeenData;
-extern const void * RTTI_ShadowSceneLight;
-extern const void * RTTI_ShadowSceneNode;
-extern const void * RTTI_ShieldEffect;
-extern const void * RTTI_SigilStoneMenu;
-extern const void * RTTI_SkillsMenu;
-extern const void * RTTI_Sky;
-extern const void * RTTI_SkyObject;
-extern const void * RTTI_SkyTask;
-extern const void * RTTI_SleepWaitMenu;
-extern const void * RTTI_SoulTrapEffect;
-extern const void * RTTI_SoundCollisionListener;
-extern const void * RTTI_SpecificItemCollector;
-extern const void * RTTI_SpectatorPackage;
-extern const void * RTTI_SpellItem;
-extern const void * RTTI_SpellMakingMenu;
-extern const void * RTTI_SpellPurchaseMenu;
-extern const void * RTTI_Stars;
-extern const void * RTTI_StatsMenu;
-extern const void * RTTI_SummonCreatureEffect;
-extern const void * RTTI_Sun;
-extern const void * RTTI_SunDamageEffect;
-extern const void * RTTI_TESAIForm;
-extern const void * RTTI_TESActorBase;
-extern const void * RTTI_TESActorBaseData;
-extern const void * RTTI_TESAmmo;
-extern const void * RTTI_TESAnimGroup;
-extern const void * RTTI_TESAnimation;
-extern const void * RTTI_TESArrowTargetListener;
-extern const void * RTTI_TESAttackDamageForm;
-extern const void * RTTI_TESAttributes;
-extern const void * RTTI_TESBipedModelForm;
-extern const void * RTTI_TESBoundAnimObject;
-extern const void * RTTI_TESBoundObject;
-extern const void * RTTI_TESBoundTreeObject;
-extern const void * RTTI_TESClass;
-extern const void * RTTI_TESClimate;
-extern const void * RTTI_TESCombatStyle;
-extern const void * RTTI_TESContainer;
-extern const void * RTTI_TESCreature;
-extern const void * RTTI_TESDescription;
-extern const void * RTTI_TESEffectShader;
-extern const void * RTTI_TESEnchantableForm;
-extern const void * RTTI_TESEyes;
-extern const void * RTTI_TESFaction;
-extern const void * RTTI_TESFlora;
-extern const void * RTTI_TESForm;
-extern const void * RTTI_TESFullName;
-extern const void * RTTI_TESFurniture;
-extern const void * RTTI_TESGlobal;
-extern const void * RTTI_TESGrass;
-extern const void * RTTI_TESHair;
-extern const void * RTTI_TESHealthForm;
-extern const void * RTTI_TESIcon;
-extern const void * RTTI_TESIdleForm;
-extern const void * RTTI_TESKey;
-extern const void * RTTI_TESLandTexture;
-extern const void * RTTI_TESLevCreature;
-extern const void * RTTI_TESLevItem;
-extern const void * RTTI_TESLevSpell;
-extern const void * RTTI_TESLeveledList;
-extern const void * RTTI_TESLoadScreen;
-extern const void * RTTI_TESModel;
-extern const void * RTTI_TESModelList;
-extern const void * RTTI_TESModelTree;
-extern const void * RTTI_TESNPC;
-extern const void * RTTI_TESObject;
-extern const void * RTTI_TESObjectACTI;
-extern const void * RTTI_TESObjectANIO;
-extern const void * RTTI_TESObjectAPPA;
-extern const void * RTTI_TESObjectARMO;
-extern const void * RTTI_TESObjectBOOK;
-extern const void * RTTI_TESObjectCELL;
-extern const void * RTTI_TESObjectCLOT;
-extern const void * RTTI_TESObjectCONT;
-extern const void * RTTI_TESObjectDOOR;
-extern const void * RTTI_TESObjectExtraData;
-extern const void * RTTI_TESObjectLAND;
-extern const void * RTTI_TESObjectLIGH;
-extern const void * RTTI_TESObjectMISC;
-extern const void * RTTI_TESObjectREFR;
-extern const void * RTTI_TESObjectSTAT;
-extern const void * RTTI_TESObjectTREE;
-extern const void * RTTI_TESObjectWEAP;
-extern const void * RTTI_TESPackage;
-extern const void * RTTI_TESPathGrid;
-extern const void * RTTI_TESProduceForm;
-extern const void * RTTI_TESQualityForm;
-extern const void * RTTI_TESQuest;
-extern const void * RTTI_TESRace;
-extern const void * RTTI_TESRaceForm;
-extern const void * RTTI_TESReactionForm;
-extern const void * RTTI_TESRegion;
-extern const void * RTTI_TESRegionData;
-extern const void * RTTI_TESRegionDataGrass;
-extern const void * RTTI_TESRegionDataLandscape;
-extern const void * RTTI_TESRegionDataManager;
-extern const void * RTTI_TESRegionDataMap;
-extern const void * RTTI_TESRegionDataSound;
-extern const void * RTTI_TESRegionDataWeather;
-extern const void * RTTI_TESRegionGrassObject;
-extern const void * RTTI_TESRegionGrassObjectList;
-extern const void * RTTI_TESRegionList;
-extern const void * RTTI_TESRoad;
-extern const void * RTTI_TESScriptableForm;
-extern const void * RTTI_TESSigilStone;
-extern const void * RTTI_TESSkill;
-extern const void * RTTI_TESSoulGem;
-extern const void * RTTI_TESSound;
-extern const void * RTTI_TESSpellList;
-extern const void * RTTI_TESSubSpace;
-extern const void * RTTI_TESTexture;
-extern const void * RTTI_TESTopic;
-extern const void * RTTI_TESTopicInfo;
-extern const void * RTTI_TESTrapListener;
-extern const void * RTTI_TESUsesForm;
-extern const void * RTTI_TESValueForm;
-extern const void * RTTI_TESWaterForm;
-extern const void * RTTI_TESWaterListener;
-extern const void * RTTI_TESWeather;
-extern const void * RTTI_TESWeightForm;
-extern const void * RTTI_TESWindListener;
-extern const void * RTTI_TESWorldSpace;
-extern const void * RTTI_TelekinesisEffect;
-extern const void * RTTI_TerrainLODQuadLoadTask;
-extern const void * RTTI_TextEditMenu;
-extern const void * RTTI_Tile;
-extern const void * RTTI_Tile3D;
-extern const void * RTTI_TileImage;
-extern const void * RTTI_TileMenu;
-extern const void * RTTI_TileRect;
-extern const void * RTTI_TileText;
-extern const void * RTTI_TileWindow;
-extern const void * RTTI_Tile__Extra;
-extern const void * RTTI_TopicInfoArray;
-extern const void * RTTI_TrainingMenu;
-extern const void * RTTI_TrespassPackage;
-extern const void * RTTI_TurnUndeadEffect;
-extern const void * RTTI_Uniform;
-extern const void * RTTI_VClairvoyanceEffect;
-extern const void * RTTI_VExtraAltarBigWorldLeveledRegion;
-extern const void * RTTI_VExtraAltarCellName;
-extern const void * RTTI_VExtraAltarThreatLevel;
-extern const void * RTTI_VHUDReticlePairableItem;
-extern const void * RTTI_VHandlerClassBase;
-extern const void * RTTI_VSaveFile;
-extern const void * RTTI_ValueModifierEffect;
-extern const void * RTTI_VampirismEffect;
-extern const void * RTTI_VideoDisplayMenu;
-extern const void * RTTI_VideoMenu;
-extern const void * RTTI_WaterShader;
-extern const void * RTTI_WaterShaderDisplacement;
-extern const void * RTTI_WaterShaderHeightMap;
-extern const void * RTTI_WeaponObject;
-extern const void * RTTI_ahkBreakableConstraintData;
-extern const void * RTTI_ahkCharacterProxy;
-extern const void * RTTI_ahkMalleableConstraintData;
-extern const void * RTTI_ahkWorld;
-extern const void * RTTI_bhkAabbPhantom;
-extern const void * RTTI_bhkAction;
-extern const void * RTTI_bhkAngularDashpotAction;
-extern const void * RTTI_bhkAvoidBox;
-extern const void * RTTI_bhkBallAndSocketConstraint;
-extern const void * RTTI_bhkBinaryAction;
-extern const void * RTTI_bhkBlendCollisionObject;
-extern const void * RTTI_bhkBlendCollisionObjectAddRotation;
-extern const void * RTTI_bhkBlendController;
-extern const void * RTTI_bhkBoxShape;
-extern const void * RTTI_bhkBreakableConstraint;
-extern const void * RTTI_bhkBvTreeShape;
-extern const void * RTTI_bhkCachingShapePhantom;
-extern const void * RTTI_bhkCapsuleShape;
-extern const void * RTTI_bhkCharControllerShape;
-extern const void * RTTI_bhkCharacterController;
-extern const void * RTTI_bhkCharacterListener;
-extern const void * RTTI_bhkCharacterListenerArrow;
-extern const void * RTTI_bhkCharacterListenerSpell;
-extern const void * RTTI_bhkCharacterPointCollector;
-extern const void * RTTI_bhkCharacterProxy;
-extern const void * RTTI_bhkCharacterStateFlying;
-extern const void * RTTI_bhkCharacterStateInAir;
-extern const void * RTTI_bhkCharacterStateJumping;
-extern const void * RTTI_bhkCharacterStateOnGround;
-extern const void * RTTI_bhkCharacterStateProjectile;
-extern const void * RTTI_bhkCharacterStateSwimming;
-extern const void * RTTI_bhkCollisionFilter;
-extern const void * RTTI_bhkCollisionObject;
-extern const void * RTTI_bhkConstraint;
-extern const void * RTTI_bhkConvexShape;
-extern const void * RTTI_bhkConvexSweepShape;
-extern const void * RTTI_bhkConvexTransformShape;
-extern const void * RTTI_bhkConvexVerticesShape;
-extern const void * RTTI_bhkCylinderShape;
-extern const void * RTTI_bhkDashpotAction;
-extern const void * RTTI_bhkEntity;
-extern const void * RTTI_bhkExtraData;
-extern const void * RTTI_bhkFixedConstraint;
-extern const void * RTTI_bhkForceController;
-extern const void * RTTI_bhkGenericConstraint;
-extern const void * RTTI_bhkHeightFieldShape;
-extern const void * RTTI_bhkHingeConstraint;
-extern const void * RTTI_bhkLimitedHingeConstraint;
-extern const void * RTTI_bhkListShape;
-extern const void * RTTI_bhkMalleableConstraint;
-extern const void * RTTI_bhkMoppBvTreeShape;
-extern const void * RTTI_bhkMotorAction;
-extern const void * RTTI_bhkMouseSpringAction;
-extern const void * RTTI_bhkMultiSphereShape;
-extern const void * RTTI_bhkNiCollisionObject;
-extern const void * RTTI_bhkNiTriStripsShape;
-extern const void * RTTI_bhkPCollisionObject;
-extern const void * RTTI_bhkPackedNiTriStripsShape;
-extern const void * RTTI_bhkPhantom;
-extern const void * RTTI_bhkPlaneShape;
-extern const void * RTTI_bhkPointToPathConstraint;
-extern const void * RTTI_bhkPoweredHingeConstraint;
-extern const void * RTTI_bhkPrismaticConstraint;
-extern const void * RTTI_bhkRagdollConstraint;
-extern const void * RTTI_bhkRefObject;
-extern const void * RTTI_bhkRigidBody;
-extern const void * RTTI_bhkRigidBodyT;
-extern const void * RTTI_bhkSPCollisionObject;
-extern const void * RTTI_bhkSerializable;
-extern const void * RTTI_bhkShape;
-extern const void * RTTI_bhkShapeCollection;
-extern const void * RTTI_bhkShapePhantom;
-extern const void * RTTI_bhkSimpleShapePhantom;
-extern const void * RTTI_bhkSphereRepShape;
-extern const void * RTTI_bhkSphereShape;
-extern const void * RTTI_bhkSpringAction;
-extern const void * RTTI_bhkStiffSpringConstraint;
-extern const void * RTTI_bhkTransformShape;
-extern const void * RTTI_bhkTriSampledHeightFieldBvTreeShape;
-extern const void * RTTI_bhkTriangleShape;
-extern const void * RTTI_bhkUnaryAction;
-extern const void * RTTI_bhkWaterListener;
-extern const void * RTTI_bhkWheelConstraint;
-extern const void * RTTI_bhkWindListener;
-extern const void * RTTI_bhkWorld;
-extern const void * RTTI_bhkWorldCinfo;
-extern const void * RTTI_bhkWorldM;
-extern const void * RTTI_bhkWorldObject;
-extern const void * RTTI_hk3AxisSweep;
-extern const void * RTTI_hkAllCdBodyPairCollector;
-extern const void * RTTI_hkAllCdPointCollector;
-extern const void * RTTI_hkAllRayHitCollector;
-extern const void * RTTI_hkAvoidBox;
-extern const void * RTTI_hkBSHeightFieldShape;
-extern const void * RTTI_hkBallAndSocketConstraintCinfo;
-extern const void * RTTI_hkBaseObject;
-extern const void * RTTI_hkBreakableConstraintCinfo;
-extern const void * RTTI_hkBreakableConstraintData;
-extern const void * RTTI_hkBroadPhaseCastCollector;
-extern const void * RTTI_hkCdBodyPairCollector;
-extern const void * RTTI_hkCdPointCollector;
-extern const void * RTTI_hkCharControllerShape;
-extern const void * RTTI_hkCharacterProxyListener;
-extern const void * RTTI_hkClosestCdPointCollector;
-extern const void * RTTI_hkClosestRayHitCollector;
-extern const void * RTTI_hkCollisionListener;
-extern const void * RTTI_hkConstraintCinfo;
-extern const void * RTTI_hkContinuousSimulation;
-extern const void * RTTI_hkDefaultToiResourceMgr;
-extern const void * RTTI_hkDiscreteSimulation;
-extern const void * RTTI_hkEntityListener;
-extern const void * RTTI_hkFirstCdBodyPairCollector;
-extern const void * RTTI_hkFixedConstraintCinfo;
-extern const void * RTTI_hkGenericConstraintCinfo;
-extern const void * RTTI_hkHingeConstraintCinfo;
-extern const void * RTTI_hkLimitedHingeConstraintCinfo;
-extern const void * RTTI_hkMalleableConstraintCinfo;
-extern const void * RTTI_hkMalleableConstraintData;
-extern const void * RTTI_hkMoppCode;
-extern const void * RTTI_hkMoppCodeGenerator;
-extern const void * RTTI_hkMoppDefaultAssembler;
-extern const void * RTTI_hkMoppDefaultCostFunction;
-extern const void * RTTI_hkMoppDefaultSplitter;
-extern const void * RTTI_hkMoppShapeMediator;
-extern const void * RTTI_hkMotorAction;
-extern const void * RTTI_hkMultiThreadedSimulation;
-extern const void * RTTI_hkMultiThreadedSimulation__MtEntityEntityBroadPhaseListener;
-extern const void * RTTI_hkMultiThreadedSimulation__MtPhantomBroadPhaseListener;
-extern const void * RTTI_hkNiTriStripsShape;
-extern const void * RTTI_hkNormalTriangleShape;
-extern const void * RTTI_hkPackedNiTriStripsData;
-extern const void * RTTI_hkPackedNiTriStripsShape;
-extern const void * RTTI_hkPhantomListener;
-extern const void * RTTI_hkPhantomOverlapListener;
-extern const void * RTTI_hkPointToPathConstraintCinfo;
-extern const void * RTTI_hkPoweredHingeConstraintCinfo;
-extern const void * RTTI_hkPoweredRagdollConstraintData;
-extern const void * RTTI_hkPrismaticConstraintCinfo;
-extern const void * RTTI_hkRagdollConstraintCinfo;
-extern const void * RTTI_hkRagdollConstraintData;
-extern const void * RTTI_hkRayHitCollector;
-extern const void * RTTI_hkRayShapeCollectionFilter;
-extern const void * RTTI_hkReferencedObject;
-extern const void * RTTI_hkScaledMoppBvTreeShape;
-extern const void * RTTI_hkShapeCollectionFilter;
-extern const void * RTTI_hkStiffSpringConstraintCinfo;
-extern const void * RTTI_hkTriangleShape;
-extern const void * RTTI_hkWheelConstraintCinfo;
-extern const void * RTTI_hkWorldRayCaster;
-extern const void * RTTI_icu_64__AbsoluteValueSubstitution;
-extern const void * RTTI_icu_64__AndConstraint;
-extern const void * RTTI_icu_64__AnnualTimeZoneRule;
-extern const void * RTTI_icu_64__Appendable;
-extern const void * RTTI_icu_64__BMPSet;
-extern const void * RTTI_icu_64__BasicCalendarFactory;
-extern const void * RTTI_icu_64__BasicTimeZone;
-extern const void * RTTI_icu_64__BreakIterator;
-extern const void * RTTI_icu_64__BuddhistCalendar;
-extern const void * RTTI_icu_64__BurmeseBreakEngine;
-extern const void * RTTI_icu_64__ByteSink;
-extern const void * RTTI_icu_64__BytesDictionaryMatcher;
-extern const void * RTTI_icu_64__CECalendar;
-extern const void * RTTI_icu_64__CEFinalizer;
-extern const void * RTTI_icu_64__CacheKeyBase;
-extern const void * RTTI_icu_64__Calendar;
-extern const void * RTTI_icu_64__CalendarAstronomer__AngleFunc;
-extern const void * RTTI_icu_64__CalendarCache;
-extern const void * RTTI_icu_64__CalendarService;
-extern const void * RTTI_icu_64__CanonicalIterator;
-extern const void * RTTI_icu_64__CharStringByteSink;
-extern const void * RTTI_icu_64__CharacterIterator;
-extern const void * RTTI_icu_64__CheckedArrayByteSink;
-extern const void * RTTI_icu_64__ChineseCalendar;
-extern const void * RTTI_icu_64__CjkBreakEngine;
-extern const void * RTTI_icu_64__CollationBuilder;
-extern const void * RTTI_icu_64__CollationCacheEntry;
-extern const void * RTTI_icu_64__CollationDataBuilder;
-extern const void * RTTI_icu_64__CollationDataBuilder__CEModifier;
-extern const void * RTTI_icu_64__CollationElementIterator;
-extern const void * RTTI_icu_64__CollationFastLatinBuilder;
-extern const void * RTTI_icu_64__CollationIterator;
-extern const void * RTTI_icu_64__CollationKeyByteSink;
-extern const void * RTTI_icu_64__CollationKeys__LevelCallback;
-extern const void * RTTI_icu_64__CollationRuleParser__Importer;
-extern const void * RTTI_icu_64__CollationRuleParser__Sink;
-extern const void * RTTI_icu_64__CollationSettings;
-extern const void * RTTI_icu_64__CollationTailoring;
-extern const void * RTTI_icu_64__Collator;
-extern const void * RTTI_icu_64__ComposeNormalizer2;
-extern const void * RTTI_icu_64__ContractionsAndExpansions__CESink;
-extern const void * RTTI_icu_64__CopticCalendar;
-extern const void * RTTI_icu_64__CurrencyAmount;
-extern const void * RTTI_icu_64__CurrencyPluralInfo;
-extern const void * RTTI_icu_64__CurrencyUnit;
-extern const void * RTTI_icu_64__DangiCalendar;
-extern const void * RTTI_icu_64__DataBuilderCollationIterator;
-extern const void * RTTI_icu_64__DateFmtBestPattern;
-extern const void * RTTI_icu_64__DateFmtBestPatternKey;
-extern const void * RTTI_icu_64__DateFormat;
-extern const void * RTTI_icu_64__DateFormatSymbols;
-extern const void * RTTI_icu_64__DateTimeMatcher;
-extern const void * RTTI_icu_64__DateTimePatternGenerator;
-extern const void * RTTI_icu_64__DateTimePatternGenerator__AppendItemFormatsSink;
-extern const void * RTTI_icu_64__DateTimePatternGenerator__AppendItemNamesSink;
-extern const void * RTTI_icu_64__DateTimePatternGenerator__AvailableFormatsSink;
-extern const void * RTTI_icu_64__DateTimeRule;
-extern const void * RTTI_icu_64__DayPeriodRulesCountSink;
-extern const void * RTTI_icu_64__DayPeriodRulesDataSink;
-extern const void * RTTI_icu_64__DecimalFormat;
-extern const void * RTTI_icu_64__DecimalFormatSymbols;
-extern const void * RTTI_icu_64__DecomposeNormalizer2;
-extern const void * RTTI_icu_64__DefaultCalendarFactory;
-extern const void * RTTI_icu_64__DictionaryBreakEngine;
-extern const void * RTTI_icu_64__DictionaryMatcher;
-extern const void * RTTI_icu_64__DistanceInfo;
-extern const void * RTTI_icu_64__ErrorCode;
-extern const void * RTTI_icu_64__EthiopicCalendar;
-extern const void * RTTI_icu_64__FCDNormalizer2;
-extern const void * RTTI_icu_64__FCDUIterCollationIterator;
-extern const void * RTTI_icu_64__FCDUTF16CollationIterator;
-extern const void * RTTI_icu_64__FCDUTF8CollationIterator;
-extern const void * RTTI_icu_64__FieldPosition;
-extern const void * RTTI_icu_64__FieldPositionHandler;
-extern const void * RTTI_icu_64__FieldPositionIteratorHandler;
-extern const void * RTTI_icu_64__FieldPositionOnlyHandler;
-extern const void * RTTI_icu_64__FilteredBreakIteratorBuilder;
-extern const void * RTTI_icu_64__FixedDecimal;
-extern const void * RTTI_icu_64__Format;
-extern const void * RTTI_icu_64__FormatNameEnumeration;
-extern const void * RTTI_icu_64__FormatParser;
-extern const void * RTTI_icu_64__Formattable;
-extern const void * RTTI_icu_64__FormattedValue;
-extern const void * RTTI_icu_64__FormattedValueNumberStringBuilderImpl;
-extern const void * RTTI_icu_64__ForwardCharacterIterator;
-extern const void * RTTI_icu_64__FractionalPartSubstitution;
-extern const void * RTTI_icu_64__GMTOffsetField;
-extern const void * RTTI_icu_64__GNameSearchHandler;
-extern const void * RTTI_icu_64__GregorianCalendar;
-extern const void * RTTI_icu_64__HebrewCalendar;
-extern const void * RTTI_icu_64__ICUBreakIteratorFactory;
-extern const void * RTTI_icu_64__ICUBreakIteratorService;
-extern const void * RTTI_icu_64__ICUCollatorFactory;
-extern const void * RTTI_icu_64__ICUCollatorService;
-extern const void * RTTI_icu_64__ICULanguageBreakFactory;
-extern const void * RTTI_icu_64__ICULocaleService;
-extern const void * RTTI_icu_64__ICUNotifier;
-extern const void * RTTI_icu_64__ICUNumberFormatFactory;
-extern const void * RTTI_icu_64__ICUNumberFormatService;
-extern const void * RTTI_icu_64__ICUResourceBundleFactory;
-extern const void * RTTI_icu_64__ICUService;
-extern const void * RTTI_icu_64__ICUServiceFactory;
-extern const void * RTTI_icu_64__ICUServiceKey;
-extern const void * RTTI_icu_64__IFixedDecimal;
-extern const void * RTTI_icu_64__IndianCalendar;
-extern const void * RTTI_icu_64__InitialTimeZoneRule;
-extern const void * RTTI_icu_64__IntegralPartSubstitution;
-extern const void * RTTI_icu_64__IslamicCalendar;
-extern const void * RTTI_icu_64__JapaneseCalendar;
-extern const void * RTTI_icu_64__KeywordEnumeration;
-extern const void * RTTI_icu_64__KhmerBreakEngine;
-extern const void * RTTI_icu_64__LanguageBreakEngine;
-extern const void * RTTI_icu_64__LanguageBreakFactory;
-extern const void * RTTI_icu_64__LaoBreakEngine;
-extern const void * RTTI_icu_64__LoadedNormalizer2Impl;
-extern const void * RTTI_icu_64__Locale;
-extern const void * RTTI_icu_64__LocaleDisplayNames;
-extern const void * RTTI_icu_64__LocaleDisplayNamesImpl;
-extern const void * RTTI_icu_64__LocaleDisplayNamesImpl__CapitalizationContextSink;
-extern const void * RTTI_icu_64__LocaleKey;
-extern const void * RTTI_icu_64__LocaleKeyFactory;
-extern const void * RTTI_icu_64__Measure;
-extern const void * RTTI_icu_64__MeasureUnit;
-extern const void * RTTI_icu_64__MessageFormat;
-extern const void * RTTI_icu_64__MessageFormat__DummyFormat;
-extern const void * RTTI_icu_64__MessageFormat__PluralSelectorProvider;
-extern const void * RTTI_icu_64__MessagePattern;
-extern const void * RTTI_icu_64__MetaZoneIDsEnumeration;
-extern const void * RTTI_icu_64__ModulusSubstitution;
-extern const void * RTTI_icu_64__MoonTimeAngleFunc;
-extern const void * RTTI_icu_64__MultiplierSubstitution;
-extern const void * RTTI_icu_64__NFSubstitution;
-extern const void * RTTI_icu_64__NoUnit;
-extern const void * RTTI_icu_64__NoopNormalizer2;
-extern const void * RTTI_icu_64__Normalizer2;
-extern const void * RTTI_icu_64__Normalizer2Impl;
-extern const void * RTTI_icu_64__NumberFormat;
-extern const void * RTTI_icu_64__NumberingSystem;
-extern const void * RTTI_icu_64__NumeratorSubstitution;
-extern const void * RTTI_icu_64__OlsonTimeZone;
-extern const void * RTTI_icu_64__OrConstraint;
-extern const void * RTTI_icu_64__ParsePosition;
-extern const void * RTTI_icu_64__PatternMap;
-extern const void * RTTI_icu_64__PatternMapIterator;
-extern const void * RTTI_icu_64__PersianCalendar;
-extern const void * RTTI_icu_64__PluralFormat;
-extern const void * RTTI_icu_64__PluralFormat__PluralSelector;
-extern const void * RTTI_icu_64__PluralFormat__PluralSelectorAdapter;
-extern const void * RTTI_icu_64__PluralKeywordEnumeration;
-extern const void * RTTI_icu_64__PluralRuleParser;
-extern const void * RTTI_icu_64__PluralRules;
-extern const void * RTTI_icu_64__PtnElem;
-extern const void * RTTI_icu_64__PtnSkeleton;
-extern const void * RTTI_icu_64__RegexCompile;
-extern const void * RTTI_icu_64__RegexMatcher;
-extern const void * RTTI_icu_64__RegexPattern;
-extern const void * RTTI_icu_64__RelativeDateFormat;
-extern const void * RTTI_icu_64__Replaceable;
-extern const void * RTTI_icu_64__ResourceBundle;
-extern const void * RTTI_icu_64__ResourceDataValue;
-extern const void * RTTI_icu_64__ResourceSink;
-extern const void * RTTI_icu_64__ResourceValue;
-extern const void * RTTI_icu_64__RuleBasedBreakIterator;
-extern const void * RTTI_icu_64__RuleBasedBreakIterator__BreakCache;
-extern const void * RTTI_icu_64__RuleBasedCollator;
-extern const void * RTTI_icu_64__RuleBasedNumberFormat;
-extern const void * RTTI_icu_64__RuleBasedTimeZone;
-extern const void * RTTI_icu_64__RuleChain;
-extern const void * RTTI_icu_64__SameValueSubstitution;
-extern const void * RTTI_icu_64__ServiceEnumeration;
-extern const void * RTTI_icu_64__SharedCalendar;
-extern const void * RTTI_icu_64__SharedDateFormatSymbols;
-extern const void * RTTI_icu_64__SharedNumberFormat;
-extern const void * RTTI_icu_64__SharedObject;
-extern const void * RTTI_icu_64__SharedPluralRules;
-extern const void * RTTI_icu_64__SimpleDateFormat;
-extern const void * RTTI_icu_64__SimpleFactory;
-extern const void * RTTI_icu_64__SimpleFilteredBreakIteratorBuilder;
-extern const void * RTTI_icu_64__SimpleFilteredSentenceBreakData;
-extern const void * RTTI_icu_64__SimpleFilteredSentenceBreakIterator;
-extern const void * RTTI_icu_64__SimpleLocaleKeyFactory;
-extern const void * RTTI_icu_64__SimpleTimeZone;
-extern const void * RTTI_icu_64__SortKeyByteSink;
-extern const void * RTTI_icu_64__StringCharacterIterator;
-extern const void * RTTI_icu_64__StringEnumeration;
-extern const void * RTTI_icu_64__StringTrieBuilder;
-extern const void * RTTI_icu_64__StringTrieBuilder__BranchHeadNode;
-extern const void * RTTI_icu_64__StringTrieBuilder__FinalValueNode;
-extern const void * RTTI_icu_64__StringTrieBuilder__IntermediateValueNode;
-extern const void * RTTI_icu_64__StringTrieBuilder__ListBranchNode;
-extern const void * RTTI_icu_64__StringTrieBuilder__SplitBranchNode;
-extern const void * RTTI_icu_64__SunTimeAngleFunc;
-extern const void * RTTI_icu_64__TZDBNameSearchHandler;
-extern const void * RTTI_icu_64__TZDBNames;
-extern const void * RTTI_icu_64__TZDBTimeZoneNames;
-extern const void * RTTI_icu_64__TZEnumeration;
-extern const void * RTTI_icu_64__TZGNCore;
-extern const void * RTTI_icu_64__TaiwanCalendar;
-extern const void * RTTI_icu_64__TextTrieMap;
-extern const void * RTTI_icu_64__TextTrieMapSearchResultHandler;
-extern const void * RTTI_icu_64__ThaiBreakEngine;
-extern const void * RTTI_icu_64__TimeArrayTimeZoneRule;
-extern const void * RTTI_icu_64__TimeZone;
-extern const void * RTTI_icu_64__TimeZoneFormat;
-extern const void * RTTI_icu_64__TimeZoneGenericNames;
-extern const void * RTTI_icu_64__TimeZoneNames;
-extern const void * RTTI_icu_64__TimeZoneNamesDelegate;
-extern const void * RTTI_icu_64__TimeZoneNamesImpl;
-extern const void * RTTI_icu_64__TimeZoneNamesImpl__ZoneStringsLoader;
-extern const void * RTTI_icu_64__TimeZoneNames__MatchInfoCollection;
-extern const void * RTTI_icu_64__TimeZoneRule;
-extern const void * RTTI_icu_64__TimeZoneTransition;
-extern const void * RTTI_icu_64__UCharCharacterIterator;
-extern const void * RTTI_icu_64__UCharsDictionaryMatcher;
-extern const void * RTTI_icu_64__UCharsTrieBuilder;
-extern const void * RTTI_icu_64__UCharsTrieBuilder__UCTLinearMatchNode;
-extern const void * RTTI_icu_64__UIterCollationIterator;
-extern const void * RTTI_icu_64__UObject;
-extern const void * RTTI_icu_64__UStack;
-extern const void * RTTI_icu_64__UStringSet;
-extern const void * RTTI_icu_64__UTF16CollationIterator;
-extern const void * RTTI_icu_64__UTF8CollationIterator;
-extern const void * RTTI_icu_64__UVector;
-extern const void * RTTI_icu_64__UVector32;
-extern const void * RTTI_icu_64__UVector64;
-extern const void * RTTI_icu_64__UnhandledEngine;
-extern const void * RTTI_icu_64__UnicodeFilter;
-extern const void * RTTI_icu_64__UnicodeFunctor;
-extern const void * RTTI_icu_64__UnicodeMatcher;
-extern const void * RTTI_icu_64__UnicodeSet;
-extern const void * RTTI_icu_64__UnicodeSetIterator;
-extern const void * RTTI_icu_64__UnicodeString;
-extern const void * RTTI_icu_64__UnicodeStringAppendable;
-extern const void * RTTI_icu_64__UnifiedCache;
-extern const void * RTTI_icu_64__UnifiedCacheBase;
-extern const void * RTTI_icu_64__WholeStringBreakIterator;
-extern const void * RTTI_icu_64__Win32DateFormat;
-extern const void * RTTI_icu_64__Win32NumberFormat;
-extern const void * RTTI_icu_64__ZNameSearchHandler;
-extern const void * RTTI_icu_64__ZNames__ZNamesLoader;
-extern const void * RTTI_icu_64__ZoneIdMatchHandler;
-extern const void * RTTI_icu_64__number__FormattedNumber;
-extern const void * RTTI_icu_64__number__impl__AdoptingModifierStore;
-extern const void * RTTI_icu_64__number__impl__AffixPatternProvider;
-extern const void * RTTI_icu_64__number__impl__CompactData;
-extern const void * RTTI_icu_64__number__impl__CompactData__CompactDataSink;
-extern const void * RTTI_icu_64__number__impl__CompactHandler;
-extern const void * RTTI_icu_64__number__impl__ConstantMultiFieldModifier;
-extern const void * RTTI_icu_64__number__impl__CurrencyPluralInfoAffixProvider;
-extern const void * RTTI_icu_64__number__impl__CurrencySpacingEnabledModifier;
-extern const void * RTTI_icu_64__number__impl__DecimalQuantity;
-extern const void * RTTI_icu_64__number__impl__EmptyModifier;
-extern const void * RTTI_icu_64__number__impl__ImmutablePatternModifier;
-extern const void * RTTI_icu_64__number__impl__LocalizedNumberFormatterAsFormat;
-extern const void * RTTI_icu_64__number__impl__LongNameHandler;
-extern const void * RTTI_icu_64__number__impl__MicroProps;
-extern const void * RTTI_icu_64__number__impl__MicroPropsGenerator;
-extern const void * RTTI_icu_64__number__impl__Modifier;
-extern const void * RTTI_icu_64__number__impl__ModifierStore;
-extern const void * RTTI_icu_64__number__impl__MultiplierFormatHandler;
-extern const void * RTTI_icu_64__number__impl__MultiplierProducer;
-extern const void * RTTI_icu_64__number__impl__MutablePatternModifier;
-extern const void * RTTI_icu_64__number__impl__ParsedPatternInfo;
-extern const void * RTTI_icu_64__number__impl__PropertiesAffixPatternProvider;
-extern const void * RTTI_icu_64__number__impl__ScientificHandler;
-extern const void * RTTI_icu_64__number__impl__ScientificModifier;
-extern const void * RTTI_icu_64__number__impl__SimpleModifier;
-extern const void * RTTI_icu_64__number__impl__SymbolProvider;
-extern const void * RTTI_icu_64__number__impl__TokenConsumer;
-extern const void * RTTI_icu_64__number__impl__UFormattedNumberData;
-extern const void * RTTI_icu_64__numparse__impl__AffixMatcher;
-extern const void * RTTI_icu_64__numparse__impl__AffixPatternMatcher;
-extern const void * RTTI_icu_64__numparse__impl__AffixPatternMatcherBuilder;
-extern const void * RTTI_icu_64__numparse__impl__ArraySeriesMatcher;
-extern const void * RTTI_icu_64__numparse__impl__CodePointMatcher;
-extern const void * RTTI_icu_64__numparse__impl__CombinedCurrencyMatcher;
-extern const void * RTTI_icu_64__numparse__impl__DecimalMatcher;
-extern const void * RTTI_icu_64__numparse__impl__IgnorablesMatcher;
-extern const void * RTTI_icu_64__numparse__impl__InfinityMatcher;
-extern const void * RTTI_icu_64__numparse__impl__MinusSignMatcher;
-extern const void * RTTI_icu_64__numparse__impl__MultiplierParseHandler;
-extern const void * RTTI_icu_64__numparse__impl__NanMatcher;
-extern const void * RTTI_icu_64__numparse__impl__NumberParseMatcher;
-extern const void * RTTI_icu_64__numparse__impl__NumberParserImpl;
-extern const void * RTTI_icu_64__numparse__impl__PaddingMatcher;
-extern const void * RTTI_icu_64__numparse__impl__PercentMatcher;
-extern const void * RTTI_icu_64__numparse__impl__PermilleMatcher;
-extern const void * RTTI_icu_64__numparse__impl__PlusSignMatcher;
-extern const void * RTTI_icu_64__numparse__impl__RequireAffixValidator;
-extern const void * RTTI_icu_64__numparse__impl__RequireCurrencyValidator;
-extern const void * RTTI_icu_64__numparse__impl__RequireDecimalSeparatorValidator;
-extern const void * RTTI_icu_64__numparse__impl__RequireNumberValidator;
-extern const void * RTTI_icu_64__numparse__impl__ScientificMatcher;
-extern const void * RTTI_icu_64__numparse__impl__SymbolMatcher;
-extern const void * RTTI_mkvparser__AudioTrack;
-extern const void * RTTI_mkvparser__BlockEntry;
-extern const void * RTTI_mkvparser__BlockGroup;
-extern const void * RTTI_mkvparser__IMkvReader;
-extern const void * RTTI_mkvparser__SimpleBlock;
-extern const void * RTTI_mkvparser__Track;
-extern const void * RTTI_mkvparser__Track__EOSBlock;
-extern const void * RTTI_mkvparser__VideoTrack;
-extern const void * RTTI_std___Generic_error_category;
-extern const void * RTTI_std___Ref_count_base;
-extern const void * RTTI_std___System_error;
-extern const void * RTTI_std__exception;
-extern const void * RTTI_std__invalid_argument;
-extern const void * RTTI_std__logic_error;
-extern const void * RTTI_std__range_error;
-extern const void * RTTI_std__runtime_error;
-extern const void * RTTI_std__system_error;
-extern const void * RTTI_testing__MatchResultListener;
-extern const void * RTTI_testing__Test;
-extern const void * RTTI_testing__TestEventListener;
-extern const void * RTTI_testing__TestPartResultReporterInterface;
-extern const void * RTTI_testing__TestSuite;
-extern const void * RTTI_testing__UnitTest;
-extern const void * RTTI_testing__internal__DeathTest;
-extern const void * RTTI_testing__internal__DeathTestFactory;
-extern const void * RTTI_testing__internal__DeathTestImpl;
-extern const void * RTTI_testing__internal__DefaultDeathTestFactory;
-extern const void * RTTI_testing__internal__DefaultGlobalTestPartResultReporter;
-extern const void * RTTI_testing__internal__DefaultPerThreadTestPartResultReporter;
-extern const void * RTTI_testing__internal__DummyMatchResultListener;
-extern const void * RTTI_testing__internal__GoogleTestFailureException;
-extern const void * RTTI_testing__internal__OsStackTraceGetter;
-extern const void * RTTI_testing__internal__OsStackTraceGetterInterface;
-extern const void * RTTI_testing__internal__PrettyUnitTestResultPrinter;
-extern const void * RTTI_testing__internal__TestEventRepeater;
-extern const void * RTTI_testing__internal__ThreadLocalBase;
-extern const void * RTTI_testing__internal__ThreadLocalValueHolderBase;
-extern const void * RTTI_testing__internal__UnitTestImpl;
-extern const void * RTTI_testing__internal__WindowsDeathTest;
-extern const void * RTTI_type_info;
+extern StaticRelocAddr <const void *> RTTI_AStarNodeList;
+extern StaticRelocAddr <const void *> RTTI_AStarWorldNodeList;
+extern StaticRelocAddr <const void *> RTTI_AbsorbEffect;
+extern StaticRelocAddr <const void *> RTTI_ActiveEffect;
+extern StaticRelocAddr <const void *> RTTI_Actor;
+extern StaticRelocAddr <const void *> RTTI_AlarmPackage;
+extern StaticRelocAddr <const void *> RTTI_AlchemyItem;
+extern StaticRelocAddr <const void *> RTTI_AlchemyMenu;
+extern StaticRelocAddr <const void *> RTTI_AnimSequenceBase;
+extern StaticRelocAddr <const void *> RTTI_AnimSequenceMultiple;
+extern StaticRelocAddr <const void *> RTTI_AnimSequenceSingle;
+extern StaticRelocAddr <const void *> RTTI_Archive;
+extern StaticRelocAddr <const void *> RTTI_ArchiveFile;
+extern StaticRelocAddr <const void *> RTTI_ArrowProjectile;
+extern StaticRelocAddr <const void *> RTTI_AssociatedItemEffect;
+extern StaticRelocAddr <const void *> RTTI_Atmosphere;
+extern StaticRelocAddr <const void *> RTTI_AttachDistant3DTask;
+extern StaticRelocAddr <const void *> RTTI_AudioMenu;
+extern StaticRelocAddr <const void *> RTTI_BSAnimGroupSequence;
+extern StaticRelocAddr <const void *> RTTI_BSBound;
+extern StaticRelocAddr <const void *> RTTI_BSClearZNode;
+extern StaticRelocAddr <const void *> RTTI_BSCullingProcess;
+extern StaticRelocAddr <const void *> RTTI_BSDoorHavokController;
+extern StaticRelocAddr <const void *> RTTI_BSExtraData;
+extern StaticRelocAddr <const void *> RTTI_BSFaceGenAnimationData;
+extern StaticRelocAddr <const void *> RTTI_BSFaceGenBaseMorphExtraData;
+extern StaticRelocAddr <const void *> RTTI_BSFaceGenBinaryFile;
+extern StaticRelocAddr <const void *> RTTI_BSFaceGenKeyframe;
+extern StaticRelocAddr <const void *> RTTI_BSFaceGenKeyframeMultiple;
+extern StaticRelocAddr <const void *> RTTI_BSFaceGenModel;
+extern StaticRelocAddr <const void *> RTTI_BSFaceGenModelExtraData;
+extern StaticRelocAddr <const void *> RTTI_BSFaceGenModelMap;
+extern StaticRelocAddr <const void *> RTTI_BSFaceGenModelMap__Entry;
+extern StaticRelocAddr <const void *> RTTI_BSFaceGenMorph;
+extern StaticRelocAddr <const void *> RTTI_BSFaceGenMorphDataHair;
+extern StaticRelocAddr <const void *> RTTI_BSFaceGenMorphDataHead;
+extern StaticRelocAddr <const void *> RTTI_BSFaceGenMorphDifferential;
+extern StaticRelocAddr <const void *> RTTI_BSFaceGenMorphStatistical;
+extern StaticRelocAddr <const void *> RTTI_BSFaceGenNiNode;
+extern StaticRelocAddr <const void *> RTTI_BSFadeNode;
+extern StaticRelocAddr <const void *> RTTI_BSFile;
+extern StaticRelocAddr <const void *> RTTI_BSFogProperty;
+extern StaticRelocAddr <const void *> RTTI_BSFurnitureMarker;
+extern StaticRelocAddr <const void *> RTTI_BSNodeReferences;
+extern StaticRelocAddr <const void *> RTTI_BSPSysArrayEmitter;
+extern StaticRelocAddr <const void *> RTTI_BSPackedAdditionalGeometryData;
+extern StaticRelocAddr <const void *> RTTI_BSPackedAdditionalGeometryData__NiBSPackedAGDDataBlock;
+extern StaticRelocAddr <const void *> RTTI_BSParentVelocityModifier;
+extern StaticRelocAddr <const void *> RTTI_BSPlayerDistanceCheckController;
+extern StaticRelocAddr <const void *> RTTI_BSReference;
+extern StaticRelocAddr <const void *> RTTI_BSScissorNode;
+extern StaticRelocAddr <const void *> RTTI_BSScissorTriShape;
+extern StaticRelocAddr <const void *> RTTI_BSSearchPath;
+extern StaticRelocAddr <const void *> RTTI_BSShaderAccumulator;
+extern StaticRelocAddr <const void *> RTTI_BSStream;
+extern StaticRelocAddr <const void *> RTTI_BSTaskThread;
+extern StaticRelocAddr <const void *> RTTI_BSTempEffect;
+extern StaticRelocAddr <const void *> RTTI_BSTempEffectDecal;
+extern StaticRelocAddr <const void *> RTTI_BSTempEffectGeometryDecal;
+extern StaticRelocAddr <const void *> RTTI_BSTempEffectParticle;
+extern StaticRelocAddr <const void *> RTTI_BSTempNode;
+extern StaticRelocAddr <const void *> RTTI_BSTempNodeManager;
+extern StaticRelocAddr <const void *> RTTI_BSTexturePalette;
+extern StaticRelocAddr <const void *> RTTI_BSThread;
+extern StaticRelocAddr <const void *> RTTI_BSTreeModel;
+extern StaticRelocAddr <const void *> RTTI_BSTreeNode;
+extern StaticRelocAddr <const void *> RTTI_BSWindModifier;
+extern StaticRelocAddr <const void *> RTTI_BSXFlags;
+extern StaticRelocAddr <const void *> RTTI_BackgroundCloneThread;
+extern StaticRelocAddr <const void *> RTTI_BackgroundLoader;
+extern StaticRelocAddr <const void *> RTTI_BackgroundLoaderThread;
+extern StaticRelocAddr <const void *> RTTI_BaseExtraList;
+extern StaticRelocAddr <const void *> RTTI_BaseProcess;
+extern StaticRelocAddr <const void *> RTTI_BirthSign;
+extern StaticRelocAddr <const void *> RTTI_BlendSettingCollection;
+extern StaticRelocAddr <const void *> RTTI_BoltShaderProperty;
+extern StaticRelocAddr <const void *> RTTI_BookMenu;
+extern StaticRelocAddr <const void *> RTTI_BoundItemEffect;
+extern StaticRelocAddr <const void *> RTTI_BreathMenu;
+extern StaticRelocAddr <const void *> RTTI_CBillboardLeaf;
+extern StaticRelocAddr <const void *> RTTI_CIdvCamera;
+extern StaticRelocAddr <const void *> RTTI_CSingletonCriticalSection;
+extern StaticRelocAddr <const void *> RTTI_CTreeEngine;
+extern StaticRelocAddr <const void *> RTTI_CalmEffect;
+extern StaticRelocAddr <const void *> RTTI_CellMopp;
+extern StaticRelocAddr <const void *> RTTI_ChameleonEffect;
+extern StaticRelocAddr <const void *> RTTI_ChangesMap;
+extern StaticRelocAddr <const void *> RTTI_Character;
+extern StaticRelocAddr <const void *> RTTI_ClassMenu;
+extern StaticRelocAddr <const void *> RTTI_Clouds;
+extern StaticRelocAddr <const void *> RTTI_CombatController;
+extern StaticRelocAddr <const void *> RTTI_CommandCreatureEffect;
+extern StaticRelocAddr <const void *> RTTI_CommandEffect;
+extern StaticRelocAddr <const void *> RTTI_CommandHumanoidEffect;
+extern StaticRelocAddr <const void *> RTTI_CompressedArchiveFile;
+extern StaticRelocAddr <const void *> RTTI_ContainerMenu;
+extern StaticRelocAddr <const void *> RTTI_Controls;
+extern StaticRelocAddr <const void *> RTTI_ControlsMenu;
+extern StaticRelocAddr <const void *> RTTI_Creature;
+extern StaticRelocAddr <const void *> RTTI_CreditsMenu;
+extern StaticRelocAddr <const void *> RTTI_CureEffect;
+extern StaticRelocAddr <const void *> RTTI_DarknessEffect;
+extern StaticRelocAddr <const void *> RTTI_DebugTextExtraData;
+extern StaticRelocAddr <const void *> RTTI_DefaultCombatStyle;
+extern StaticRelocAddr <const void *> RTTI_DemoralizeEffect;
+extern StaticRelocAddr <const void *> RTTI_DetectLifeEffect;
+extern StaticRelocAddr <const void *> RTTI_DialogMenu;
+extern StaticRelocAddr <const void *> RTTI_DialoguePackage;
+extern StaticRelocAddr <const void *> RTTI_DisintegrateArmorEffect;
+extern StaticRelocAddr <const void *> RTTI_DisintegrateWeaponEffect;
+extern StaticRelocAddr <const void *> RTTI_DispelEffect;
+extern StaticRelocAddr <const void *> RTTI_DistantLODLoaderTask;
+extern StaticRelocAddr <const void *> RTTI_EffectItem;
+extern StaticRelocAddr <const void *> RTTI_EffectItemList;
+extern StaticRelocAddr <const void *> RTTI_EffectSetting;
+extern StaticRelocAddr <const void *> RTTI_EffectSettingCollection;
+extern StaticRelocAddr <const void *> RTTI_EffectSettingMenu;
+extern StaticRelocAddr <const void *> RTTI_EnchantmentItem;
+extern StaticRelocAddr <const void *> RTTI_EnchantmentMenu;
+extern StaticRelocAddr <const void *> RTTI_ExportAlchemyItem;
+extern StaticRelocAddr <const void *> RTTI_ExportBaseFormComponent;
+extern StaticRelocAddr <const void *> RTTI_ExportEffectItem;
+extern StaticRelocAddr <const void *> RTTI_ExportMagicItem;
+extern StaticRelocAddr <const void *> RTTI_ExportMagicItemObject;
+extern StaticRelocAddr <const void *> RTTI_ExportTESActorBase;
+extern StaticRelocAddr <const void *> RTTI_ExportTESActorBaseData;
+extern StaticRelocAddr <const void *> RTTI_ExportTESAmmo;
+extern StaticRelocAddr <const void *> RTTI_ExportTESAnimation;
+extern StaticRelocAddr <const void *> RTTI_ExportTESAttributes;
+extern StaticRelocAddr <const void *> RTTI_ExportTESContainer;
+extern StaticRelocAddr <const void *> RTTI_ExportTESCreature;
+extern StaticRelocAddr <const void *> RTTI_ExportTESForm;
+extern StaticRelocAddr <const void *> RTTI_ExportTESIcon;
+extern StaticRelocAddr <const void *> RTTI_ExportTESModel;
+extern StaticRelocAddr <const void *> RTTI_ExportTESModelList;
+extern StaticRelocAddr <const void *> RTTI_ExportTESNPC;
+extern StaticRelocAddr <const void *> RTTI_ExportTESObjectARMO;
+extern StaticRelocAddr <const void *> RTTI_ExportTESObjectBOOK;
+extern StaticRelocAddr <const void *> RTTI_ExportTESObjectCLOT;
+extern StaticRelocAddr <const void *> RTTI_ExportTESObjectREFR;
+extern StaticRelocAddr <const void *> RTTI_ExportTESObjectWEAP;
+extern StaticRelocAddr <const void *> RTTI_ExportTESRace;
+extern StaticRelocAddr <const void *> RTTI_ExportTESReactionForm;
+extern StaticRelocAddr <const void *> RTTI_ExportTESSpellList;
+extern StaticRelocAddr <const void *> RTTI_ExportTESTexture;
+extern StaticRelocAddr <const void *> RTTI_ExteriorCellNewReferencesMap;
+extern StaticRelocAddr <const void *> RTTI_ExtraAction;
+extern StaticRelocAddr <const void *> RTTI_ExtraAltarActorGUID;
+extern StaticRelocAddr <const void *> RTTI_ExtraAltarBPVariant;
+extern StaticRelocAddr <const void *> RTTI_ExtraAltarData;
+extern StaticRelocAddr <const void *> RTTI_ExtraAnim;
+extern StaticRelocAddr <const void *> RTTI_ExtraBoundArmor;
+extern StaticRelocAddr <const void *> RTTI_ExtraCannotWear;
+extern StaticRelocAddr <const void *> RTTI_ExtraCell3D;
+extern StaticRelocAddr <const void *> RTTI_ExtraCellCanopyShadowMask;
+extern StaticRelocAddr <const void *> RTTI_ExtraCellClimate;
+extern StaticRelocAddr <const void *> RTTI_ExtraCellMusicType;
+extern StaticRelocAddr <const void *> RTTI_ExtraCellWaterType;
+extern StaticRelocAddr <const void *> RTTI_ExtraCharge;
+extern StaticRelocAddr <const void *> RTTI_ExtraContainerChanges;
+extern StaticRelocAddr <const void *> RTTI_ExtraCount;
+extern StaticRelocAddr <const void *> RTTI_ExtraCrimeGold;
+extern StaticRelocAddr <const void *> RTTI_ExtraDataList;
+extern StaticRelocAddr <const void *> RTTI_ExtraDetachTime;
+extern StaticRelocAddr <const void *> RTTI_ExtraDistantData;
+extern StaticRelocAddr <const void *> RTTI_ExtraDroppedItemList;
+extern StaticRelocAddr <const void *> RTTI_ExtraEditorID;
+extern StaticRelocAddr <const void *> RTTI_ExtraEditorRefMoveData;
+extern StaticRelocAddr <const void *> RTTI_ExtraEnableStateChildren;
+extern StaticRelocAddr <const void *> RTTI_ExtraEnableStateParent;
+extern StaticRelocAddr <const void *> RTTI_ExtraFollower;
+extern StaticRelocAddr <const void *> RTTI_ExtraFriendHitList;
+extern StaticRelocAddr <const void *> RTTI_ExtraGhost;
+extern StaticRelocAddr <const void *> RTTI_ExtraGlobal;
+extern StaticRelocAddr <const void *> RTTI_ExtraHaggleAmount;
+extern StaticRelocAddr <const void *> RTTI_ExtraHasNoRumors;
+extern StaticRelocAddr <const void *> RTTI_ExtraHavok;
+extern StaticRelocAddr <const void *> RTTI_ExtraHeadingTarget;
+extern StaticRelocAddr <const void *> RTTI_ExtraHealth;
+extern StaticRelocAddr <const void *> RTTI_ExtraInfoGeneralTopic;
+extern StaticRelocAddr <const void *> RTTI_ExtraInvestmentGold;
+extern StaticRelocAddr <const void *> RTTI_ExtraItemDropper;
+extern StaticRelocAddr <const void *> RTTI_ExtraLastFinishedSequence;
+extern StaticRelocAddr <const void *> RTTI_ExtraLevCreaModifier;
+extern StaticRelocAddr <const void *> RTTI_ExtraLeveledCreature;
+extern StaticRelocAddr <const void *> RTTI_ExtraLeveledItem;
+extern StaticRelocAddr <const void *> RTTI_ExtraLight;
+extern StaticRelocAddr <const void *> RTTI_ExtraLock;
+extern StaticRelocAddr <const void *> RTTI_ExtraMapMarker;
+extern StaticRelocAddr <const void *> RTTI_ExtraMerchantContainer;
+extern StaticRelocAddr <const void *> RTTI_ExtraNorthRotation;
+extern StaticRelocAddr <const void *> RTTI_ExtraOblivionEntry;
+extern StaticRelocAddr <const void *> RTTI_ExtraOriginalReference;
+extern StaticRelocAddr <const void *> RTTI_ExtraOwnership;
+extern StaticRelocAddr <const void *> RTTI_ExtraPackage;
+extern StaticRelocAddr <const void *> RTTI_ExtraPackageStartLocation;
+extern StaticRelocAddr <const void *> RTTI_ExtraPersistentCell;
+extern StaticRelocAddr <const void *> RTTI_ExtraPersuasionPercent;
+extern StaticRelocAddr <const void *> RTTI_ExtraPoison;
+extern StaticRelocAddr <const void *> RTTI_ExtraProcessMiddleLow;
+extern StaticRelocAddr <const void *> RTTI_ExtraQuickKey;
+extern StaticRelocAddr <const void *> RTTI_ExtraRagDollData;
+extern StaticRelocAddr <const void *> RTTI_ExtraRandomTeleportMarker;
+extern StaticRelocAddr <const void *> RTTI_ExtraRank;
+extern StaticRelocAddr <const void *> RTTI_ExtraReferencePointer;
+extern StaticRelocAddr <const void *> RTTI_ExtraRefractionProperty;
+extern StaticRelocAddr <const void *> RTTI_ExtraRegionList;
+extern StaticRelocAddr <const void *> RTTI_ExtraRunOncePacks;
+extern StaticRelocAddr <const void *> RTTI_ExtraSavedMovementData;
+extern StaticRelocAddr <const void *> RTTI_ExtraScale;
+extern StaticRelocAddr <const void *> RTTI_ExtraScript;
+extern StaticRelocAddr <const void *> RTTI_ExtraSeed;
+extern StaticRelocAddr <const void *> RTTI_ExtraSeenData;
+extern StaticRelocAddr <const void *> RTTI_ExtraSoul;
+extern StaticRelocAddr <const void *> RTTI_ExtraSound;
+extern StaticRelocAddr <const void *> RTTI_ExtraStartingPosition;
+extern StaticRelocAddr <const void *> RTTI_ExtraStartingWorldOrCell;
+extern StaticRelocAddr <const void *> RTTI_ExtraTeleport;
+extern StaticRelocAddr <const void *> RTTI_ExtraTimeLeft;
+extern StaticRelocAddr <const void *> RTTI_ExtraTravelHorse;
+extern StaticRelocAddr <const void *> RTTI_ExtraTresPassPackage;
+extern StaticRelocAddr <const void *> RTTI_ExtraUsedMarkers;
+extern StaticRelocAddr <const void *> RTTI_ExtraUses;
+extern StaticRelocAddr <const void *> RTTI_ExtraWaterHeight;
+extern StaticRelocAddr <const void *> RTTI_ExtraWorn;
+extern StaticRelocAddr <const void *> RTTI_ExtraWornLeft;
+extern StaticRelocAddr <const void *> RTTI_ExtraXTarget;
+extern StaticRelocAddr <const void *> RTTI_FAutoConsoleObject;
+extern StaticRelocAddr <const void *> RTTI_FDefaultModuleImpl;
+extern StaticRelocAddr <const void *> RTTI_FExrReaderGpuModule;
+extern StaticRelocAddr <const void *> RTTI_FGlobalShaderType;
+extern StaticRelocAddr <const void *> RTTI_FOpenExrRTTIModule;
+extern StaticRelocAddr <const void *> RTTI_FadeNodeMaxAlphaExtraData;
+extern StaticRelocAddr <const void *> RTTI_FileFinder;
+extern StaticRelocAddr <const void *> RTTI_FleePackage;
+extern StaticRelocAddr <const void *> RTTI_FrenzyEffect;
+extern StaticRelocAddr <const void *> RTTI_FutBinaryFileC;
+extern StaticRelocAddr <const void *> RTTI_GameSettingCollection;
+extern StaticRelocAddr <const void *> RTTI_GameplayMenu;
+extern StaticRelocAddr <const void *> RTTI_GenericMenu;
+extern StaticRelocAddr <const void *> RTTI_GridArray;
+extern StaticRelocAddr <const void *> RTTI_GridCellArray;
+extern StaticRelocAddr <const void *> RTTI_GridDistantArray;
+extern StaticRelocAddr <const void *> RTTI_HUDInfoMenu;
+extern StaticRelocAddr <const void *> RTTI_HUDMainMenu;
+extern StaticRelocAddr <const void *> RTTI_HUDReticle;
+extern StaticRelocAddr <const void *> RTTI_HUDSubtitleMenu;
+extern StaticRelocAddr <const void *> RTTI_HavokError;
+extern StaticRelocAddr <const void *> RTTI_HavokFileStreambufReader;
+extern StaticRelocAddr <const void *> RTTI_HavokFileStreambufWriter;
+extern StaticRelocAddr <const void *> RTTI_HavokStreambufFactory;
+extern StaticRelocAddr <const void *> RTTI_HavokStreambufWriter;
+extern StaticRelocAddr <const void *> RTTI_HighProcess;
+extern StaticRelocAddr <const void *> RTTI_IModuleInterface;
+extern StaticRelocAddr <const void *> RTTI_INISettingCollection;
+extern StaticRelocAddr <const void *> RTTI_IOManager;
+extern StaticRelocAddr <const void *> RTTI_IVPairableItem;
+extern StaticRelocAddr <const void *> RTTI_IconArray;
+extern StaticRelocAddr <const void *> RTTI_IdvFileError;
+extern StaticRelocAddr <const void *> RTTI_Iex_3_1__ArgExc;
+extern StaticRelocAddr <const void *> RTTI_Iex_3_1__BaseExc;
+extern StaticRelocAddr <const void *> RTTI_Iex_3_1__E2bigExc;
+extern StaticRelocAddr <const void *> RTTI_Iex_3_1__EaccesExc;
+extern StaticRelocAddr <const void *> RTTI_Iex_3_1__EaddrinuseExc;
+extern StaticRelocAddr <const void *> RTTI_Iex_3_1__EaddrnotavailExc;
+extern StaticRelocAddr <const void *> RTTI_Iex_3_1__EafnosupportExc;
+extern StaticRelocAddr <const void *> RTTI_Iex_3_1__EagainExc;
+extern StaticRelocAddr <const void *> RTTI_Iex_3_1__EalreadyExc;
+extern StaticRelocAddr <const void *> RTTI_Iex_3_1__EbadfExc;
+extern StaticRelocAddr <const void *> RTTI_Iex_3_1__EbadmsgExc;
+extern StaticRelocAddr <const void *> RTTI_Iex_3_1__EbusyExc;
+extern StaticRelocAddr <const void *> RTTI_Iex_3_1__EcanceledExc;
+extern StaticRelocAddr <const void *> RTTI_Iex_3_1__EchildExc;
+extern StaticRelocAddr <const void *> RTTI_Iex_3_1__EconnabortedExc;
+extern StaticRelocAddr <const void *> RTTI_Iex_3_1__EconnrefusedExc;
+extern StaticRelocAddr <const void *> RTTI_Iex_3_1__EconnresetExc;
+extern StaticRelocAddr <const void *> RTTI_Iex_3_1__EdeadlkExc;
+extern StaticRelocAddr <const void *> RTTI_Iex_3_1__EdestaddrreqExc;
+extern StaticRelocAddr <const void *> RTTI_Iex_3_1__EdomExc;
+extern StaticRelocAddr <const void *> RTTI_Iex_3_1__EexistExc;
+extern StaticRelocAddr <const void *> RTTI_Iex_3_1__EfaultExc;
+extern StaticRelocAddr <const void *> RTTI_Iex_3_1__EfbigExc;
+extern StaticRelocAddr <const void *> RTTI_Iex_3_1__EhostunreachExc;
+extern StaticRelocAddr <const void *> RTTI_Iex_3_1__EidrmExc;
+extern StaticRelocAddr <const void *> RTTI_Iex_3_1__EilseqExc;
+extern StaticRelocAddr <const void *> RTTI_Iex_3_1__EinprogressExc;
+extern StaticRelocAddr <const void *> RTTI_Iex_3_1__EintrExc;
+extern StaticRelocAddr <const void *> RTTI_Iex_3_1__EinvalExc;
+extern StaticRelocAddr <const void *> RTTI_Iex_3_1__EioExc;
+extern StaticRelocAddr <const void *> RTTI_Iex_3_1__EisconnExc;
+extern StaticRelocAddr <const void *> RTTI_Iex_3_1__EisdirExc;
+extern StaticRelocAddr <const void *> RTTI_Iex_3_1__EloopExc;
+extern StaticRelocAddr <const void *> RTTI_Iex_3_1__EmfileExc;
+extern StaticRelocAddr <const void *> RTTI_Iex_3_1__EmlinkExc;
+extern StaticRelocAddr <const void *> RTTI_Iex_3_1__EmsgsizeExc;
+extern StaticRelocAddr <const void *> RTTI_Iex_3_1__EnametoolongExc;
+extern StaticRelocAddr <const void *> RTTI_Iex_3_1__EnetdownExc;
+extern StaticRelocAddr <const void *> RTTI_Iex_3_1__EnetresetExc;
+extern StaticRelocAddr <const void *> RTTI_Iex_3_1__EnetunreachExc;
+extern StaticRelocAddr <const void *> RTTI_Iex_3_1__EnfileExc;
+extern StaticRelocAddr <const void *> RTTI_Iex_3_1__EnobufsExc;
+extern StaticRelocAddr <const void *> RTTI_Iex_3_1__EnodataExc;
+extern StaticRelocAddr <const void *> RTTI_Iex_3_1__EnodevExc;
+extern StaticRelocAddr <const void *> RTTI_Iex_3_1__EnoentExc;
+extern StaticRelocAddr <const void *> RTTI_Iex_3_1__EnoexecExc;
+extern StaticRelocAddr <const void *> RTTI_Iex_3_1__EnolckExc;
+extern StaticRelocAddr <const void *> RTTI_Iex_3_1__EnolinkExc;
+extern StaticRelocAddr <const void *> RTTI_Iex_3_1__EnomemExc;
+extern StaticRelocAddr <const void *> RTTI_Iex_3_1__EnomsgExc;
+extern StaticRelocAddr <const void *> RTTI_Iex_3_1__EnoprotooptExc;
+extern StaticRelocAddr <const void *> RTTI_Iex_3_1__EnospcExc;
+extern StaticRelocAddr <const void *> RTTI_Iex_3_1__EnosrExc;
+extern StaticRelocAddr <const void *> RTTI_Iex_3_1__EnostrExc;
+extern StaticRelocAddr <const void *> RTTI_Iex_3_1__EnosysExc;
+extern StaticRelocAddr <const void *> RTTI_Iex_3_1__EnotconnExc;
+extern StaticRelocAddr <const void *> RTTI_Iex_3_1__EnotdirExc;
+extern StaticRelocAddr <const void *> RTTI_Iex_3_1__EnotemptyExc;
+extern StaticRelocAddr <const void *> RTTI_Iex_3_1__EnotsockExc;
+extern StaticRelocAddr <const void *> RTTI_Iex_3_1__EnotsupExc;
+extern StaticRelocAddr <const void *> RTTI_Iex_3_1__EnottyExc;
+extern StaticRelocAddr <const void *> RTTI_Iex_3_1__EnxioExc;
+extern StaticRelocAddr <const void *> RTTI_Iex_3_1__EopnotsuppExc;
+extern StaticRelocAddr <const void *> RTTI_Iex_3_1__EoverflowExc;
+extern StaticRelocAddr <const void *> RTTI_Iex_3_1__EpermExc;
+extern StaticRelocAddr <const void *> RTTI_Iex_3_1__EpipeExc;
+extern StaticRelocAddr <const void *> RTTI_Iex_3_1__EprotoExc;
+extern StaticRelocAddr <const void *> RTTI_Iex_3_1__EprotonosupportExc;
+extern StaticRelocAddr <const void *> RTTI_Iex_3_1__EprototypeExc;
+extern StaticRelocAddr <const void *> RTTI_Iex_3_1__ErangeExc;
+extern StaticRelocAddr <const void *> RTTI_Iex_3_1__ErofsExc;
+extern StaticRelocAddr <const void *> RTTI_Iex_3_1__ErrnoExc;
+extern StaticRelocAddr <const void *> RTTI_Iex_3_1__EspipeExc;
+extern StaticRelocAddr <const void *> RTTI_Iex_3_1__EsrchExc;
+extern StaticRelocAddr <const void *> RTTI_Iex_3_1__EtimeExc;
+extern StaticRelocAddr <const void *> RTTI_Iex_3_1__EtimedoutExc;
+extern StaticRelocAddr <const void *> RTTI_Iex_3_1__EtxtbsyExc;
+extern StaticRelocAddr <const void *> RTTI_Iex_3_1__ExdevExc;
+extern StaticRelocAddr <const void *> RTTI_Iex_3_1__InputExc;
+extern StaticRelocAddr <const void *> RTTI_Iex_3_1__IoExc;
+extern StaticRelocAddr <const void *> RTTI_Iex_3_1__LogicExc;
+extern StaticRelocAddr <const void *> RTTI_Iex_3_1__MathExc;
+extern StaticRelocAddr <const void *> RTTI_Iex_3_1__NoImplExc;
+extern StaticRelocAddr <const void *> RTTI_Iex_3_1__OverflowExc;
+extern StaticRelocAddr <const void *> RTTI_Iex_3_1__TypeExc;
+extern StaticRelocAddr <const void *> RTTI_IlmThread_3_1__Semaphore;
+extern StaticRelocAddr <const void *> RTTI_IlmThread_3_1__Task;
+extern StaticRelocAddr <const void *> RTTI_IlmThread_3_1__Thread;
+extern StaticRelocAddr <const void *> RTTI_IlmThread_3_1__ThreadPool;
+extern StaticRelocAddr <const void *> RTTI_IlmThread_3_1__ThreadPoolProvider;
+extern StaticRelocAddr <const void *> RTTI_Imf_3_1__Attribute;
+extern StaticRelocAddr <const void *> RTTI_Imf_3_1__B44Compressor;
+extern StaticRelocAddr <const void *> RTTI_Imf_3_1__CompositeDeepScanLine;
+extern StaticRelocAddr <const void *> RTTI_Imf_3_1__Compressor;
+extern StaticRelocAddr <const void *> RTTI_Imf_3_1__DeepCompositing;
+extern StaticRelocAddr <const void *> RTTI_Imf_3_1__DeepScanLineInputFile;
+extern StaticRelocAddr <const void *> RTTI_Imf_3_1__DwaCompressor;
+extern StaticRelocAddr <const void *> RTTI_Imf_3_1__DwaCompressor__LossyDctDecoder;
+extern StaticRelocAddr <const void *> RTTI_Imf_3_1__DwaCompressor__LossyDctDecoderBase;
+extern StaticRelocAddr <const void *> RTTI_Imf_3_1__DwaCompressor__LossyDctDecoderCsc;
+extern StaticRelocAddr <const void *> RTTI_Imf_3_1__DwaCompressor__LossyDctEncoder;
+extern StaticRelocAddr <const void *> RTTI_Imf_3_1__DwaCompressor__LossyDctEncoderBase;
+extern StaticRelocAddr <const void *> RTTI_Imf_3_1__DwaCompressor__LossyDctEncoderCsc;
+extern StaticRelocAddr <const void *> RTTI_Imf_3_1__GenericInputFile;
+extern StaticRelocAddr <const void *> RTTI_Imf_3_1__GenericOutputFile;
+extern StaticRelocAddr <const void *> RTTI_Imf_3_1__IStream;
+extern StaticRelocAddr <const void *> RTTI_Imf_3_1__InputFile;
+extern StaticRelocAddr <const void *> RTTI_Imf_3_1__MultiPartInputFile;
+extern StaticRelocAddr <const void *> RTTI_Imf_3_1__OStream;
+extern StaticRelocAddr <const void *> RTTI_Imf_3_1__OpaqueAttribute;
+extern StaticRelocAddr <const void *> RTTI_Imf_3_1__OutputFile;
+extern StaticRelocAddr <const void *> RTTI_Imf_3_1__PizCompressor;
+extern StaticRelocAddr <const void *> RTTI_Imf_3_1__Pxr24Compressor;
+extern StaticRelocAddr <const void *> RTTI_Imf_3_1__RgbaInputFile;
+extern StaticRelocAddr <const void *> RTTI_Imf_3_1__RleCompressor;
+extern StaticRelocAddr <const void *> RTTI_Imf_3_1__ScanLineInputFile;
+extern StaticRelocAddr <const void *> RTTI_Imf_3_1__StdIFStream;
+extern StaticRelocAddr <const void *> RTTI_Imf_3_1__StdOSStream;
+extern StaticRelocAddr <const void *> RTTI_Imf_3_1__TiledInputFile;
+extern StaticRelocAddr <const void *> RTTI_Imf_3_1__ZipCompressor;
+extern StaticRelocAddr <const void *> RTTI_IngredientItem;
+extern StaticRelocAddr <const void *> RTTI_IntSeenData;
+extern StaticRelocAddr <const void *> RTTI_InterfacedClass;
+extern StaticRelocAddr <const void *> RTTI_InteriorCellNewReferencesMap;
+extern StaticRelocAddr <const void *> RTTI_InventoryMenu;
+extern StaticRelocAddr <const void *> RTTI_InvisibilityEffect;
+extern StaticRelocAddr <const void *> RTTI_LevelUpMenu;
+extern StaticRelocAddr <const void *> RTTI_LightEffect;
+extern StaticRelocAddr <const void *> RTTI_LipSynchroSettingCollection;
+extern StaticRelocAddr <const void *> RTTI_LipTask;
+extern StaticRelocAddr <const void *> RTTI_LoadgameMenu;
+extern StaticRelocAddr <const void *> RTTI_LoadingMenu;
+extern StaticRelocAddr <const void *> RTTI_LockEffect;
+extern StaticRelocAddr <const void *> RTTI_LockPickMenu;
+extern StaticRelocAddr <const void *> RTTI_LowProcess;
+extern StaticRelocAddr <const void *> RTTI_MagicBallProjectile;
+extern StaticRelocAddr <const void *> RTTI_MagicBoltProjectile;
+extern StaticRelocAddr <const void *> RTTI_MagicCaster;
+extern StaticRelocAddr <const void *> RTTI_MagicFogProjectile;
+extern StaticRelocAddr <const void *> RTTI_MagicHitEffect;
+extern StaticRelocAddr <const void *> RTTI_MagicItem;
+extern StaticRelocAddr <const void *> RTTI_MagicItemObject;
+extern StaticRelocAddr <const void *> RTTI_MagicMenu;
+extern StaticRelocAddr <const void *> RTTI_MagicModelHitEffect;
+extern StaticRelocAddr <const void *> RTTI_MagicPopupMenu;
+extern StaticRelocAddr <const void *> RTTI_MagicProjectile;
+extern StaticRelocAddr <const void *> RTTI_MagicShaderHitEffect;
+extern StaticRelocAddr <const void *> RTTI_MagicSprayProjectile;
+extern StaticRelocAddr <const void *> RTTI_MagicTarget;
+extern StaticRelocAddr <const void *> RTTI_MainMenu;
+extern StaticRelocAddr <const void *> RTTI_MapMenu;
+extern StaticRelocAddr <const void *> RTTI_Menu;
+extern StaticRelocAddr <const void *> RTTI_MessageHandler;
+extern StaticRelocAddr <const void *> RTTI_MessageMenu;
+extern StaticRelocAddr <const void *> RTTI_MiddleHighProcess;
+extern StaticRelocAddr <const void *> RTTI_MiddleLowProcess;
+extern StaticRelocAddr <const void *> RTTI_MobileObject;
+extern StaticRelocAddr <const void *> RTTI_Moon;
+extern StaticRelocAddr <const void *> RTTI_NegotiateMenu;
+extern StaticRelocAddr <const void *> RTTI_NiAVObject;
+extern StaticRelocAddr <const void *> RTTI_NiAVObjectPalette;
+extern StaticRelocAddr <const void *> RTTI_NiAccumulator;
+extern StaticRelocAddr <const void *> RTTI_NiAdditionalGeometryData;
+extern StaticRelocAddr <const void *> RTTI_NiAdditionalGeometryData__NiAGDDataBlock;
+extern StaticRelocAddr <const void *> RTTI_NiAlphaAccumulator;
+extern StaticRelocAddr <const void *> RTTI_NiAlphaController;
+extern StaticRelocAddr <const void *> RTTI_NiAlphaProperty;
+extern StaticRelocAddr <const void *> RTTI_NiAmbientLight;
+extern StaticRelocAddr <const void *> RTTI_NiBSBoneLODController;
+extern StaticRelocAddr <const void *> RTTI_NiBSPNode;
+extern StaticRelocAddr <const void *> RTTI_NiBSplineBasisData;
+extern StaticRelocAddr <const void *> RTTI_NiBSplineColorInterpolator;
+extern StaticRelocAddr <const void *> RTTI_NiBSplineCompColorInterpolator;
+extern StaticRelocAddr <const void *> RTTI_NiBSplineCompFloatInterpolator;
+extern StaticRelocAddr <const void *> RTTI_NiBSplineCompPoint3Interpolator;
+extern StaticRelocAddr <const void *> RTTI_NiBSplineCompTransformInterpolator;
+extern StaticRelocAddr <const void *> RTTI_NiBSplineData;
+extern StaticRelocAddr <const void *> RTTI_NiBSplineFloatInterpolator;
+extern StaticRelocAddr <const void *> RTTI_NiBSplineInterpolator;
+extern StaticRelocAddr <const void *> RTTI_NiBSplinePoint3Interpolator;
+extern StaticRelocAddr <const void *> RTTI_NiBSplineTransformInterpolator;
+extern StaticRelocAddr <const void *> RTTI_NiBackToFrontAccumulator;
+extern StaticRelocAddr <const void *> RTTI_NiBillboardNode;
+extern StaticRelocAddr <const void *> RTTI_NiBinaryExtraData;
+extern StaticRelocAddr <const void *> RTTI_NiBinaryStream;
+extern StaticRelocAddr <const void *> RTTI_NiBlendAccumTransformInterpolator;
+extern StaticRelocAddr <const void *> RTTI_NiBlendBoolInterpolator;
+extern StaticRelocAddr <const void *> RTTI_NiBlendColorInterpolator;
+extern StaticRelocAddr <const void *> RTTI_NiBlendFloatInterpolator;
+extern StaticRelocAddr <const void *> RTTI_NiBlendInterpolator;
+extern StaticRelocAddr <const void *> RTTI_NiBlendPoint3Interpolator;
+extern StaticRelocAddr <const void *> RTTI_NiBlendQuaternionInterpolator;
+extern StaticRelocAddr <const void *> RTTI_NiBlendTransformInterpolator;
+extern StaticRelocAddr <const void *> RTTI_NiBoneLODController;
+extern StaticRelocAddr <const void *> RTTI_NiBoolData;
+extern StaticRelocAddr <const void *> RTTI_NiBoolInterpController;
+extern StaticRelocAddr <const void *> RTTI_NiBoolInterpolator;
+extern StaticRelocAddr <const void *> RTTI_NiBoolTimelineInterpolator;
+extern StaticRelocAddr <const void *> RTTI_NiBooleanExtraData;
+extern StaticRelocAddr <const void *> RTTI_NiBoundingVolume;
+extern StaticRelocAddr <const void *> RTTI_NiBoxBV;
+extern StaticRelocAddr <const void *> RTTI_NiBoxCapsuleIntersector;
+extern StaticRelocAddr <const void *> RTTI_NiBoxSphereIntersector;
+extern StaticRelocAddr <const void *> RTTI_NiCamera;
+extern StaticRelocAddr <const void *> RTTI_NiCapsuleBV;
+extern StaticRelocAddr <const void *> RTTI_NiCapsuleCapsuleIntersector;
+extern StaticRelocAddr <const void *> RTTI_NiCapsuleSphereIntersector;
+extern StaticRelocAddr <const void *> RTTI_NiCapsuleTriIntersector;
+extern StaticRelocAddr <const void *> RTTI_NiCollisionData;
+extern StaticRelocAddr <const void *> RTTI_NiCollisionObject;
+extern StaticRelocAddr <const void *> RTTI_NiColorData;
+extern StaticRelocAddr <const void *> RTTI_NiColorExtraData;
+extern StaticRelocAddr <const void *> RTTI_NiColorExtraDataController;
+extern StaticRelocAddr <const void *> RTTI_NiColorInterpolator;
+extern StaticRelocAddr <const void *> RTTI_NiControllerManager;
+extern StaticRelocAddr <const void *> RTTI_NiControllerSequence;
+extern StaticRelocAddr <const void *> RTTI_NiCullingProcess;
+extern StaticRelocAddr <const void *> RTTI_NiDX9Renderer;
+extern StaticRelocAddr <const void *> RTTI_NiDefaultAVObjectPalette;
+extern StaticRelocAddr <const void *> RTTI_NiDirectionalLight;
+extern StaticRelocAddr <const void *> RTTI_NiDitherProperty;
+extern StaticRelocAddr <const void *> RTTI_NiDynamicEffect;
+extern StaticRelocAddr <const void *> RTTI_NiDynamicEffectState;
+extern StaticRelocAddr <const void *> RTTI_NiExtraData;
+extern StaticRelocAddr <const void *> RTTI_NiExtraDataController;
+extern StaticRelocAddr <const void *> RTTI_NiFile;
+extern StaticRelocAddr <const void *> RTTI_NiFlipController;
+extern StaticRelocAddr <const void *> RTTI_NiFloatController;
+extern StaticRelocAddr <const void *> RTTI_NiFloatData;
+extern StaticRelocAddr <const void *> RTTI_NiFloatExtraData;
+extern StaticRelocAddr <const void *> RTTI_NiFloatExtraDataController;
+extern StaticRelocAddr <const void *> RTTI_NiFloatInterpController;
+extern StaticRelocAddr <const void *> RTTI_NiFloatInterpolator;
+extern StaticRelocAddr <const void *> RTTI_NiFloatsExtraData;
+extern StaticRelocAddr <const void *> RTTI_NiFloatsExtraDataController;
+extern StaticRelocAddr <const void *> RTTI_NiFloatsExtraDataPoint3Controller;
+extern StaticRelocAddr <const void *> RTTI_NiFogProperty;
+extern StaticRelocAddr <const void *> RTTI_NiFormArray;
+extern StaticRelocAddr <const void *> RTTI_NiGeomMorpherController;
+extern StaticRelocAddr <const void *> RTTI_NiGeomMorpherUpdateTask;
+extern StaticRelocAddr <const void *> RTTI_NiGeometry;
+extern StaticRelocAddr <const void *> RTTI_NiGeometryData;
+extern StaticRelocAddr <const void *> RTTI_NiHalfSpaceBV;
+extern StaticRelocAddr <const void *> RTTI_NiImageConverter;
+extern StaticRelocAddr <const void *> RTTI_NiImageReader;
+extern StaticRelocAddr <const void *> RTTI_NiIntegerExtraData;
+extern StaticRelocAddr <const void *> RTTI_NiIntegersExtraData;
+extern StaticRelocAddr <const void *> RTTI_NiInterpController;
+extern StaticRelocAddr <const void *> RTTI_NiInterpolator;
+extern StaticRelocAddr <const void *> RTTI_NiIntersector;
+extern StaticRelocAddr <const void *> RTTI_NiKeyBasedInterpolator;
+extern StaticRelocAddr <const void *> RTTI_NiKeyframeManager;
+extern StaticRelocAddr <const void *> RTTI_NiLODData;
+extern StaticRelocAddr <const void *> RTTI_NiLODNode;
+extern StaticRelocAddr <const void *> RTTI_NiLight;
+extern StaticRelocAddr <const void *> RTTI_NiLightColorController;
+extern StaticRelocAddr <const void *> RTTI_NiLightDimmerController;
+extern StaticRelocAddr <const void *> RTTI_NiLines;
+extern StaticRelocAddr <const void *> RTTI_NiLinesData;
+extern StaticRelocAddr <const void *> RTTI_NiLogBehavior;
+extern StaticRelocAddr <const void *> RTTI_NiLookAtController;
+extern StaticRelocAddr <const void *> RTTI_NiLookAtInterpolator;
+extern StaticRelocAddr <const void *> RTTI_NiMaterialColorController;
+extern StaticRelocAddr <const void *> RTTI_NiMaterialProperty;
+extern StaticRelocAddr <const void *> RTTI_NiMemStream;
+extern StaticRelocAddr <const void *> RTTI_NiMemoryLogBehavior;
+extern StaticRelocAddr <const void *> RTTI_NiMeshPSysData;
+extern StaticRelocAddr <const void *> RTTI_NiMeshParticleSystem;
+extern StaticRelocAddr <const void *> RTTI_NiMorphData;
+extern StaticRelocAddr <const void *> RTTI_NiMultiTargetTransformController;
+extern StaticRelocAddr <const void *> RTTI_NiNIFImageReader;
+extern StaticRelocAddr <const void *> RTTI_NiNode;
+extern StaticRelocAddr <const void *> RTTI_NiOBBLeaf;
+extern StaticRelocAddr <const void *> RTTI_NiOBBNode;
+extern StaticRelocAddr <const void *> RTTI_NiOBBRoot;
+extern StaticRelocAddr <const void *> RTTI_NiObject;
+extern StaticRelocAddr <const void *> RTTI_NiObjectNET;
+extern StaticRelocAddr <const void *> RTTI_NiPSysAgeDeathModifier;
+extern StaticRelocAddr <const void *> RTTI_NiPSysAirFieldAirFrictionCtlr;
+extern StaticRelocAddr <const void *> RTTI_NiPSysAirFieldInheritVelocityCtlr;
+extern StaticRelocAddr <const void *> RTTI_NiPSysAirFieldModifier;
+extern StaticRelocAddr <const void *> RTTI_NiPSysAirFieldSpreadCtlr;
+extern StaticRelocAddr <const void *> RTTI_NiPSysBombModifier;
+extern StaticRelocAddr <const void *> RTTI_NiPSysBoundUpdateModifier;
+extern StaticRelocAddr <const void *> RTTI_NiPSysBoxEmitter;
+extern StaticRelocAddr <const void *> RTTI_NiPSysCollider;
+extern StaticRelocAddr <const void *> RTTI_NiPSysColliderManager;
+extern StaticRelocAddr <const void *> RTTI_NiPSysColorModifier;
+extern StaticRelocAddr <const void *> RTTI_NiPSysCylinderEmitter;
+extern StaticRelocAddr <const void *> RTTI_NiPSysData;
+extern StaticRelocAddr <const void *> RTTI_NiPSysDragFieldModifier;
+extern StaticRelocAddr <const void *> RTTI_NiPSysDragModifier;
+extern StaticRelocAddr <const void *> RTTI_NiPSysEmitter;
+extern StaticRelocAddr <const void *> RTTI_NiPSysEmitterCtlr;
+extern StaticRelocAddr <const void *> RTTI_NiPSysEmitterCtlrData;
+extern StaticRelocAddr <const void *> RTTI_NiPSysEmitterDeclinationCtlr;
+extern StaticRelocAddr <const void *> RTTI_NiPSysEmitterDeclinationVarCtlr;
+extern StaticRelocAddr <const void *> RTTI_NiPSysEmitterInitialRadiusCtlr;
+extern StaticRelocAddr <const void *> RTTI_NiPSysEmitterLifeSpanCtlr;
+extern StaticRelocAddr <const void *> RTTI_NiPSysEmitterPlanarAngleCtlr;
+extern StaticRelocAddr <const void *> RTTI_NiPSysEmitterPlanarAngleVarCtlr;
+extern StaticRelocAddr <const void *> RTTI_NiPSysEmitterSpeedCtlr;
+extern StaticRelocAddr <const void *> RTTI_NiPSysFieldAttenuationCtlr;
+extern StaticRelocAddr <const void *> RTTI_NiPSysFieldMagnitudeCtlr;
+extern StaticRelocAddr <const void *> RTTI_NiPSysFieldMaxDistanceCtlr;
+extern StaticRelocAddr <const void *> RTTI_NiPSysFieldModifier;
+extern StaticRelocAddr <const void *> RTTI_NiPSysGravityFieldModifier;
+extern StaticRelocAddr <const void *> RTTI_NiPSysGravityModifier;
+extern StaticRelocAddr <const void *> RTTI_NiPSysGravityStrengthCtlr;
+extern StaticRelocAddr <const void *> RTTI_NiPSysGrowFadeModifier;
+extern StaticRelocAddr <const void *> RTTI_NiPSysInitialRotAngleCtlr;
+extern StaticRelocAddr <const void *> RTTI_NiPSysInitialRotAngleVarCtlr;
+extern StaticRelocAddr <const void *> RTTI_NiPSysInitialRotSpeedCtlr;
+extern StaticRelocAddr <const void *> RTTI_NiPSysInitialRotSpeedVarCtlr;
+extern StaticRelocAddr <const void *> RTTI_NiPSysMeshEmitter;
+extern StaticRelocAddr <const void *> RTTI_NiPSysMeshEmitter__NiSkinnedEmitterData;
+extern StaticRelocAddr <const void *> RTTI_NiPSysMeshUpdateModifier;
+extern StaticRelocAddr <const void *> RTTI_NiPSysModifier;
+extern StaticRelocAddr <const void *> RTTI_NiPSysModifierActiveCtlr;
+extern StaticRelocAddr <const void *> RTTI_NiPSysModifierBoolCtlr;
+extern StaticRelocAddr <const void *> RTTI_NiPSysModifierCtlr;
+extern StaticRelocAddr <const void *> RTTI_NiPSysModifierFloatCtlr;
+extern StaticRelocAddr <const void *> RTTI_NiPSysPlanarCollider;
+extern StaticRelocAddr <const void *> RTTI_NiPSysPositionModifier;
+extern StaticRelocAddr <const void *> RTTI_NiPSysRadialFieldModifier;
+extern StaticRelocAddr <const void *> RTTI_NiPSysResetOnLoopCtlr;
+extern StaticRelocAddr <const void *> RTTI_NiPSysRotationModifier;
+extern StaticRelocAddr <const void *> RTTI_NiPSysSpawnModifier;
+extern StaticRelocAddr <const void *> RTTI_NiPSysSphereEmitter;
+extern StaticRelocAddr <const void *> RTTI_NiPSysSphericalCollider;
+extern StaticRelocAddr <const void *> RTTI_NiPSysTurbulenceFieldModifier;
+extern StaticRelocAddr <const void *> RTTI_NiPSysUpdateCtlr;
+extern StaticRelocAddr <const void *> RTTI_NiPSysUpdateTask;
+extern StaticRelocAddr <const void *> RTTI_NiPSysVolumeEmitter;
+extern StaticRelocAddr <const void *> RTTI_NiPSysVortexFieldModifier;
+extern StaticRelocAddr <const void *> RTTI_NiPalette;
+extern StaticRelocAddr <const void *> RTTI_NiParticleMeshes;
+extern StaticRelocAddr <const void *> RTTI_NiParticleMeshesData;
+extern StaticRelocAddr <const void *> RTTI_NiParticleSystem;
+extern StaticRelocAddr <const void *> RTTI_NiParticles;
+extern StaticRelocAddr <const void *> RTTI_NiParticlesData;
+extern StaticRelocAddr <const void *> RTTI_NiPathController;
+extern StaticRelocAddr <const void *> RTTI_NiPathInterpolator;
+extern StaticRelocAddr <const void *> RTTI_NiPixelData;
+extern StaticRelocAddr <const void *> RTTI_NiPoint3InterpController;
+extern StaticRelocAddr <const void *> RTTI_NiPoint3Interpolator;
+extern StaticRelocAddr <const void *> RTTI_NiPointLight;
+extern StaticRelocAddr <const void *> RTTI_NiPosData;
+extern StaticRelocAddr <const void *> RTTI_NiProfileLogBehavior;
+extern StaticRelocAddr <const void *> RTTI_NiProfiler__CriticalSection;
+extern StaticRelocAddr <const void *> RTTI_NiProfiler__FileInformation;
+extern StaticRelocAddr <const void *> RTTI_NiProfiler__Profile;
+extern StaticRelocAddr <const void *> RTTI_NiProfiler__String;
+extern StaticRelocAddr <const void *> RTTI_NiPropertyState;
+extern StaticRelocAddr <const void *> RTTI_NiQuaternionInterpolator;
+extern StaticRelocAddr <const void *> RTTI_NiRangeLODData;
+extern StaticRelocAddr <const void *> RTTI_NiRefObject;
+extern StaticRelocAddr <const void *> RTTI_NiRenderTargetGroup;
+extern StaticRelocAddr <const void *> RTTI_NiRenderer;
+extern StaticRelocAddr <const void *> RTTI_NiRendererSpecificProperty;
+extern StaticRelocAddr <const void *> RTTI_NiRollController;
+extern StaticRelocAddr <const void *> RTTI_NiRotData;
+extern StaticRelocAddr <const void *> RTTI_NiScreenElements;
+extern StaticRelocAddr <const void *> RTTI_NiScreenElementsData;
+extern StaticRelocAddr <const void *> RTTI_NiScreenGeometry;
+extern StaticRelocAddr <const void *> RTTI_NiScreenGeometryData;
+extern StaticRelocAddr <const void *> RTTI_NiScreenGeometryData__ScreenElement;
+extern StaticRelocAddr <const void *> RTTI_NiScreenLODData;
+extern StaticRelocAddr <const void *> RTTI_NiScreenPolygon;
+extern StaticRelocAddr <const void *> RTTI_NiScreenSpaceCamera;
+extern StaticRelocAddr <const void *> RTTI_NiScreenTexture;
+extern StaticRelocAddr <const void *> RTTI_NiSearchPath;
+extern StaticRelocAddr <const void *> RTTI_NiSequence;
+extern StaticRelocAddr <const void *> RTTI_NiSequenceStreamHelper;
+extern StaticRelocAddr <const void *> RTTI_NiShadeProperty;
+extern StaticRelocAddr <const void *> RTTI_NiShader;
+extern StaticRelocAddr <const void *> RTTI_NiSingleInterpController;
+extern StaticRelocAddr <const void *> RTTI_NiSkinData;
+extern StaticRelocAddr <const void *> RTTI_NiSkinInstance;
+extern StaticRelocAddr <const void *> RTTI_NiSkinPartition;
+extern StaticRelocAddr <const void *> RTTI_NiSkinPartition__Partition;
+extern StaticRelocAddr <const void *> RTTI_NiSortAdjustNode;
+extern StaticRelocAddr <const void *> RTTI_NiSourceCubeMap;
+extern StaticRelocAddr <const void *> RTTI_NiSourceTexture;
+extern StaticRelocAddr <const void *> RTTI_NiSpecularProperty;
+extern StaticRelocAddr <const void *> RTTI_NiSphereBV;
+extern StaticRelocAddr <const void *> RTTI_NiSphereTriIntersector;
+extern StaticRelocAddr <const void *> RTTI_NiSpotLight;
+extern StaticRelocAddr <const void *> RTTI_NiStencilProperty;
+extern StaticRelocAddr <const void *> RTTI_NiStream;
+extern StaticRelocAddr <const void *> RTTI_NiStringExtraData;
+extern StaticRelocAddr <const void *> RTTI_NiStringPalette;
+extern StaticRelocAddr <const void *> RTTI_NiStringsExtraData;
+extern StaticRelocAddr <const void *> RTTI_NiSwitchNode;
+extern StaticRelocAddr <const void *> RTTI_NiSwitchStringExtraData;
+extern StaticRelocAddr <const void *> RTTI_NiTask;
+extern StaticRelocAddr <const void *> RTTI_NiTextKeyExtraData;
+extern StaticRelocAddr <const void *> RTTI_NiTexture;
+extern StaticRelocAddr <const void *> RTTI_NiTextureEffect;
+extern StaticRelocAddr <const void *> RTTI_NiTextureTransformController;
+extern StaticRelocAddr <const void *> RTTI_NiTexturingProperty;
+extern StaticRelocAddr <const void *> RTTI_NiTexturingProperty__BumpMap;
+extern StaticRelocAddr <const void *> RTTI_NiTexturingProperty__Map;
+extern StaticRelocAddr <const void *> RTTI_NiTexturingProperty__ShaderMap;
+extern StaticRelocAddr <const void *> RTTI_NiTimeController;
+extern StaticRelocAddr <const void *> RTTI_NiTransformController;
+extern StaticRelocAddr <const void *> RTTI_NiTransformData;
+extern StaticRelocAddr <const void *> RTTI_NiTransformInterpolator;
+extern StaticRelocAddr <const void *> RTTI_NiTriBasedGeom;
+extern StaticRelocAddr <const void *> RTTI_NiTriBasedGeomData;
+extern StaticRelocAddr <const void *> RTTI_NiTriShape;
+extern StaticRelocAddr <const void *> RTTI_NiTriShapeData;
+extern StaticRelocAddr <const void *> RTTI_NiTriShapeDynamicData;
+extern StaticRelocAddr <const void *> RTTI_NiTriStrips;
+extern StaticRelocAddr <const void *> RTTI_NiTriStripsData;
+extern StaticRelocAddr <const void *> RTTI_NiTriStripsDynamicData;
+extern StaticRelocAddr <const void *> RTTI_NiUVController;
+extern StaticRelocAddr <const void *> RTTI_NiUVData;
+extern StaticRelocAddr <const void *> RTTI_NiUnionBV;
+extern StaticRelocAddr <const void *> RTTI_NiVectorExtraData;
+extern StaticRelocAddr <const void *> RTTI_NiVertWeightsExtraData;
+extern StaticRelocAddr <const void *> RTTI_NiVertexColorProperty;
+extern StaticRelocAddr <const void *> RTTI_NiVisController;
+extern StaticRelocAddr <const void *> RTTI_NiWireframeProperty;
+extern StaticRelocAddr <const void *> RTTI_NiZBufferProperty;
+extern StaticRelocAddr <const void *> RTTI_NightEyeEffect;
+extern StaticRelocAddr <const void *> RTTI_NonActorMagicCaster;
+extern StaticRelocAddr <const void *> RTTI_NonActorMagicTarget;
+extern StaticRelocAddr <const void *> RTTI_Normal;
+extern StaticRelocAddr <const void *> RTTI_NumericIDBufferMap;
+extern StaticRelocAddr <const void *> RTTI_OpenEffect;
+extern StaticRelocAddr <const void *> RTTI_OptionsMenu;
+extern StaticRelocAddr <const void *> RTTI_PArrayPoint;
+extern StaticRelocAddr <const void *> RTTI_ParalysisEffect;
+extern StaticRelocAddr <const void *> RTTI_PathBuilder;
+extern StaticRelocAddr <const void *> RTTI_PathHigh;
+extern StaticRelocAddr <const void *> RTTI_PathLow;
+extern StaticRelocAddr <const void *> RTTI_PathMiddleHigh;
+extern StaticRelocAddr <const void *> RTTI_PauseMenu;
+extern StaticRelocAddr <const void *> RTTI_PersuasionMenu;
+extern StaticRelocAddr <const void *> RTTI_PlayerCharacter;
+extern StaticRelocAddr <const void *> RTTI_PosGen;
+extern StaticRelocAddr <const void *> RTTI_Precipitation;
+extern StaticRelocAddr <const void *> RTTI_QuantityMenu;
+extern StaticRelocAddr <const void *> RTTI_QueuedAnimIdle;
+extern StaticRelocAddr <const void *> RTTI_QueuedCharacter;
+extern StaticRelocAddr <const void *> RTTI_QueuedChildren;
+extern StaticRelocAddr <const void *> RTTI_QueuedCreature;
+extern StaticRelocAddr <const void *> RTTI_QueuedDistantLOD;
+extern StaticRelocAddr <const void *> RTTI_QueuedFile;
+extern StaticRelocAddr <const void *> RTTI_QueuedFileEntry;
+extern StaticRelocAddr <const void *> RTTI_QueuedHead;
+extern StaticRelocAddr <const void *> RTTI_QueuedHelmet;
+extern StaticRelocAddr <const void *> RTTI_QueuedKF;
+extern StaticRelocAddr <const void *> RTTI_QueuedMagicItem;
+extern StaticRelocAddr <const void *> RTTI_QueuedModel;
+extern StaticRelocAddr <const void *> RTTI_QueuedPlayer;
+extern StaticRelocAddr <const void *> RTTI_QueuedReference;
+extern StaticRelocAddr <const void *> RTTI_QueuedTree;
+extern StaticRelocAddr <const void *> RTTI_QueuedTreeModel;
+extern StaticRelocAddr <const void *> RTTI_QuickKeysMenu;
+extern StaticRelocAddr <const void *> RTTI_RaceSexMenu;
+extern StaticRelocAddr <const void *> RTTI_Random;
+extern StaticRelocAddr <const void *> RTTI_ReanimateEffect;
+extern StaticRelocAddr <const void *> RTTI_RechargeMenu;
+extern StaticRelocAddr <const void *> RTTI_RepairMenu;
+extern StaticRelocAddr <const void *> RTTI_RepairMenu__RepairMenuList;
+extern StaticRelocAddr <const void *> RTTI_SaveGameFile;
+extern StaticRelocAddr <const void *> RTTI_SaveMenu;
+extern StaticRelocAddr <const void *> RTTI_SceneGraph;
+extern StaticRelocAddr <const void *> RTTI_Script;
+extern StaticRelocAddr <const void *> RTTI_ScriptEffect;
+extern StaticRelocAddr <const void *> RTTI_SeenData;
+extern StaticRelocAddr <const void *> RTTI_ShadowSceneLight;
+extern StaticRelocAddr <const void *> RTTI_ShadowSceneNode;
+extern StaticRelocAddr <const void *> RTTI_ShieldEffect;
+extern StaticRelocAddr <const void *> RTTI_SigilStoneMenu;
+extern StaticRelocAddr <const void *> RTTI_SkillsMenu;
+extern StaticRelocAddr <const void *> RTTI_Sky;
+extern StaticRelocAddr <const void *> RTTI_SkyObject;
+extern StaticRelocAddr <const void *> RTTI_SkyTask;
+extern StaticRelocAddr <const void *> RTTI_SleepWaitMenu;
+extern StaticRelocAddr <const void *> RTTI_SoulTrapEffect;
+extern StaticRelocAddr <const void *> RTTI_SoundCollisionListener;
+extern StaticRelocAddr <const void *> RTTI_SpecificItemCollector;
+extern StaticRelocAddr <const void *> RTTI_SpectatorPackage;
+extern StaticRelocAddr <const void *> RTTI_SpellItem;
+extern StaticRelocAddr <const void *> RTTI_SpellMakingMenu;
+extern StaticRelocAddr <const void *> RTTI_SpellPurchaseMenu;
+extern StaticRelocAddr <const void *> RTTI_Stars;
+extern StaticRelocAddr <const void *> RTTI_StatsMenu;
+extern StaticRelocAddr <const void *> RTTI_SummonCreatureEffect;
+extern StaticRelocAddr <const void *> RTTI_Sun;
+extern StaticRelocAddr <const void *> RTTI_SunDamageEffect;
+extern StaticRelocAddr <const void *> RTTI_TESAIForm;
+extern StaticRelocAddr <const void *> RTTI_TESActorBase;
+extern StaticRelocAddr <const void *> RTTI_TESActorBaseData;
+extern StaticRelocAddr <const void *> RTTI_TESAmmo;
+extern StaticRelocAddr <const void *> RTTI_TESAnimGroup;
+extern StaticRelocAddr <const void *> RTTI_TESAnimation;
+extern StaticRelocAddr <const void *> RTTI_TESArrowTargetListener;
+extern StaticRelocAddr <const void *> RTTI_TESAttackDamageForm;
+extern StaticRelocAddr <const void *> RTTI_TESAttributes;
+extern StaticRelocAddr <const void *> RTTI_TESBipedModelForm;
+extern StaticRelocAddr <const void *> RTTI_TESBoundAnimObject;
+extern StaticRelocAddr <const void *> RTTI_TESBoundObject;
+extern StaticRelocAddr <const void *> RTTI_TESBoundTreeObject;
+extern StaticRelocAddr <const void *> RTTI_TESClass;
+extern StaticRelocAddr <const void *> RTTI_TESClimate;
+extern StaticRelocAddr <const void *> RTTI_TESCombatStyle;
+extern StaticRelocAddr <const void *> RTTI_TESContainer;
+extern StaticRelocAddr <const void *> RTTI_TESCreature;
+extern StaticRelocAddr <const void *> RTTI_TESDescription;
+extern StaticRelocAddr <const void *> RTTI_TESEffectShader;
+extern StaticRelocAddr <const void *> RTTI_TESEnchantableForm;
+extern StaticRelocAddr <const void *> RTTI_TESEyes;
+extern StaticRelocAddr <const void *> RTTI_TESFaction;
+extern StaticRelocAddr <const void *> RTTI_TESFlora;
+extern StaticRelocAddr <const void *> RTTI_TESForm;
+extern StaticRelocAddr <const void *> RTTI_TESFullName;
+extern StaticRelocAddr <const void *> RTTI_TESFurniture;
+extern StaticRelocAddr <const void *> RTTI_TESGlobal;
+extern StaticRelocAddr <const void *> RTTI_TESGrass;
+extern StaticRelocAddr <const void *> RTTI_TESHair;
+extern StaticRelocAddr <const void *> RTTI_TESHealthForm;
+extern StaticRelocAddr <const void *> RTTI_TESIcon;
+extern StaticRelocAddr <const void *> RTTI_TESIdleForm;
+extern StaticRelocAddr <const void *> RTTI_TESKey;
+extern StaticRelocAddr <const void *> RTTI_TESLandTexture;
+extern StaticRelocAddr <const void *> RTTI_TESLevCreature;
+extern StaticRelocAddr <const void *> RTTI_TESLevItem;
+extern StaticRelocAddr <const void *> RTTI_TESLevSpell;
+extern StaticRelocAddr <const void *> RTTI_TESLeveledList;
+extern StaticRelocAddr <const void *> RTTI_TESLoadScreen;
+extern StaticRelocAddr <const void *> RTTI_TESModel;
+extern StaticRelocAddr <const void *> RTTI_TESModelList;
+extern StaticRelocAddr <const void *> RTTI_TESModelTree;
+extern StaticRelocAddr <const void *> RTTI_TESNPC;
+extern StaticRelocAddr <const void *> RTTI_TESObject;
+extern StaticRelocAddr <const void *> RTTI_TESObjectACTI;
+extern StaticRelocAddr <const void *> RTTI_TESObjectANIO;
+extern StaticRelocAddr <const void *> RTTI_TESObjectAPPA;
+extern StaticRelocAddr <const void *> RTTI_TESObjectARMO;
+extern StaticRelocAddr <const void *> RTTI_TESObjectBOOK;
+extern StaticRelocAddr <const void *> RTTI_TESObjectCELL;
+extern StaticRelocAddr <const void *> RTTI_TESObjectCLOT;
+extern StaticRelocAddr <const void *> RTTI_TESObjectCONT;
+extern StaticRelocAddr <const void *> RTTI_TESObjectDOOR;
+extern StaticRelocAddr <const void *> RTTI_TESObjectExtraData;
+extern StaticRelocAddr <const void *> RTTI_TESObjectLAND;
+extern StaticRelocAddr <const void *> RTTI_TESObjectLIGH;
+extern StaticRelocAddr <const void *> RTTI_TESObjectMISC;
+extern StaticRelocAddr <const void *> RTTI_TESObjectREFR;
+extern StaticRelocAddr <const void *> RTTI_TESObjectSTAT;
+extern StaticRelocAddr <const void *> RTTI_TESObjectTREE;
+extern StaticRelocAddr <const void *> RTTI_TESObjectWEAP;
+extern StaticRelocAddr <const void *> RTTI_TESPackage;
+extern StaticRelocAddr <const void *> RTTI_TESPathGrid;
+extern StaticRelocAddr <const void *> RTTI_TESProduceForm;
+extern StaticRelocAddr <const void *> RTTI_TESQualityForm;
+extern StaticRelocAddr <const void *> RTTI_TESQuest;
+extern StaticRelocAddr <const void *> RTTI_TESRace;
+extern StaticRelocAddr <const void *> RTTI_TESRaceForm;
+extern StaticRelocAddr <const void *> RTTI_TESReactionForm;
+extern StaticRelocAddr <const void *> RTTI_TESRegion;
+extern StaticRelocAddr <const void *> RTTI_TESRegionData;
+extern StaticRelocAddr <const void *> RTTI_TESRegionDataGrass;
+extern StaticRelocAddr <const void *> RTTI_TESRegionDataLandscape;
+extern StaticRelocAddr <const void *> RTTI_TESRegionDataManager;
+extern StaticRelocAddr <const void *> RTTI_TESRegionDataMap;
+extern StaticRelocAddr <const void *> RTTI_TESRegionDataSound;
+extern StaticRelocAddr <const void *> RTTI_TESRegionDataWeather;
+extern StaticRelocAddr <const void *> RTTI_TESRegionGrassObject;
+extern StaticRelocAddr <const void *> RTTI_TESRegionGrassObjectList;
+extern StaticRelocAddr <const void *> RTTI_TESRegionList;
+extern StaticRelocAddr <const void *> RTTI_TESRoad;
+extern StaticRelocAddr <const void *> RTTI_TESScriptableForm;
+extern StaticRelocAddr <const void *> RTTI_TESSigilStone;
+extern StaticRelocAddr <const void *> RTTI_TESSkill;
+extern StaticRelocAddr <const void *> RTTI_TESSoulGem;
+extern StaticRelocAddr <const void *> RTTI_TESSound;
+extern StaticRelocAddr <const void *> RTTI_TESSpellList;
+extern StaticRelocAddr <const void *> RTTI_TESSubSpace;
+extern StaticRelocAddr <const void *> RTTI_TESTexture;
+extern StaticRelocAddr <const void *> RTTI_TESTopic;
+extern StaticRelocAddr <const void *> RTTI_TESTopicInfo;
+extern StaticRelocAddr <const void *> RTTI_TESTrapListener;
+extern StaticRelocAddr <const void *> RTTI_TESUsesForm;
+extern StaticRelocAddr <const void *> RTTI_TESValueForm;
+extern StaticRelocAddr <const void *> RTTI_TESWaterForm;
+extern StaticRelocAddr <const void *> RTTI_TESWaterListener;
+extern StaticRelocAddr <const void *> RTTI_TESWeather;
+extern StaticRelocAddr <const void *> RTTI_TESWeightForm;
+extern StaticRelocAddr <const void *> RTTI_TESWindListener;
+extern StaticRelocAddr <const void *> RTTI_TESWorldSpace;
+extern StaticRelocAddr <const void *> RTTI_TelekinesisEffect;
+extern StaticRelocAddr <const void *> RTTI_TerrainLODQuadLoadTask;
+extern StaticRelocAddr <const void *> RTTI_TextEditMenu;
+extern StaticRelocAddr <const void *> RTTI_Tile;
+extern StaticRelocAddr <const void *> RTTI_Tile3D;
+extern StaticRelocAddr <const void *> RTTI_TileImage;
+extern StaticRelocAddr <const void *> RTTI_TileMenu;
+extern StaticRelocAddr <const void *> RTTI_TileRect;
+extern StaticRelocAddr <const void *> RTTI_TileText;
+extern StaticRelocAddr <const void *> RTTI_TileWindow;
+extern StaticRelocAddr <const void *> RTTI_Tile__Extra;
+extern StaticRelocAddr <const void *> RTTI_TopicInfoArray;
+extern StaticRelocAddr <const void *> RTTI_TrainingMenu;
+extern StaticRelocAddr <const void *> RTTI_TrespassPackage;
+extern StaticRelocAddr <const void *> RTTI_TurnUndeadEffect;
+extern StaticRelocAddr <const void *> RTTI_Uniform;
+extern StaticRelocAddr <const void *> RTTI_VClairvoyanceEffect;
+extern StaticRelocAddr <const void *> RTTI_VExtraAltarBigWorldLeveledRegion;
+extern StaticRelocAddr <const void *> RTTI_VExtraAltarCellName;
+extern StaticRelocAddr <const void *> RTTI_VExtraAltarThreatLevel;
+extern StaticRelocAddr <const void *> RTTI_VHUDReticlePairableItem;
+extern StaticRelocAddr <const void *> RTTI_VHandlerClassBase;
+extern StaticRelocAddr <const void *> RTTI_VSaveFile;
+extern StaticRelocAddr <const void *> RTTI_ValueModifierEffect;
+extern StaticRelocAddr <const void *> RTTI_VampirismEffect;
+extern StaticRelocAddr <const void *> RTTI_VideoDisplayMenu;
+extern StaticRelocAddr <const void *> RTTI_VideoMenu;
+extern StaticRelocAddr <const void *> RTTI_WaterShader;
+extern StaticRelocAddr <const void *> RTTI_WaterShaderDisplacement;
+extern StaticRelocAddr <const void *> RTTI_WaterShaderHeightMap;
+extern StaticRelocAddr <const void *> RTTI_WeaponObject;
+extern StaticRelocAddr <const void *> RTTI_ahkBreakableConstraintData;
+extern StaticRelocAddr <const void *> RTTI_ahkCharacterProxy;
+extern StaticRelocAddr <const void *> RTTI_ahkMalleableConstraintData;
+extern StaticRelocAddr <const void *> RTTI_ahkWorld;
+extern StaticRelocAddr <const void *> RTTI_bhkAabbPhantom;
+extern StaticRelocAddr <const void *> RTTI_bhkAction;
+extern StaticRelocAddr <const void *> RTTI_bhkAngularDashpotAction;
+extern StaticRelocAddr <const void *> RTTI_bhkAvoidBox;
+extern StaticRelocAddr <const void *> RTTI_bhkBallAndSocketConstraint;
+extern StaticRelocAddr <const void *> RTTI_bhkBinaryAction;
+extern StaticRelocAddr <const void *> RTTI_bhkBlendCollisionObject;
+extern StaticRelocAddr <const void *> RTTI_bhkBlendCollisionObjectAddRotation;
+extern StaticRelocAddr <const void *> RTTI_bhkBlendController;
+extern StaticRelocAddr <const void *> RTTI_bhkBoxShape;
+extern StaticRelocAddr <const void *> RTTI_bhkBreakableConstraint;
+extern StaticRelocAddr <const void *> RTTI_bhkBvTreeShape;
+extern StaticRelocAddr <const void *> RTTI_bhkCachingShapePhantom;
+extern StaticRelocAddr <const void *> RTTI_bhkCapsuleShape;
+extern StaticRelocAddr <const void *> RTTI_bhkCharControllerShape;
+extern StaticRelocAddr <const void *> RTTI_bhkCharacterController;
+extern StaticRelocAddr <const void *> RTTI_bhkCharacterListener;
+extern StaticRelocAddr <const void *> RTTI_bhkCharacterListenerArrow;
+extern StaticRelocAddr <const void *> RTTI_bhkCharacterListenerSpell;
+extern StaticRelocAddr <const void *> RTTI_bhkCharacterPointCollector;
+extern StaticRelocAddr <const void *> RTTI_bhkCharacterProxy;
+extern StaticRelocAddr <const void *> RTTI_bhkCharacterStateFlying;
+extern StaticRelocAddr <const void *> RTTI_bhkCharacterStateInAir;
+extern StaticRelocAddr <const void *> RTTI_bhkCharacterStateJumping;
+extern StaticRelocAddr <const void *> RTTI_bhkCharacterStateOnGround;
+extern StaticRelocAddr <const void *> RTTI_bhkCharacterStateProjectile;
+extern StaticRelocAddr <const void *> RTTI_bhkCharacterStateSwimming;
+extern StaticRelocAddr <const void *> RTTI_bhkCollisionFilter;
+extern StaticRelocAddr <const void *> RTTI_bhkCollisionObject;
+extern StaticRelocAddr <const void *> RTTI_bhkConstraint;
+extern StaticRelocAddr <const void *> RTTI_bhkConvexShape;
+extern StaticRelocAddr <const void *> RTTI_bhkConvexSweepShape;
+extern StaticRelocAddr <const void *> RTTI_bhkConvexTransformShape;
+extern StaticRelocAddr <const void *> RTTI_bhkConvexVerticesShape;
+extern StaticRelocAddr <const void *> RTTI_bhkCylinderShape;
+extern StaticRelocAddr <const void *> RTTI_bhkDashpotAction;
+extern StaticRelocAddr <const void *> RTTI_bhkEntity;
+extern StaticRelocAddr <const void *> RTTI_bhkExtraData;
+extern StaticRelocAddr <const void *> RTTI_bhkFixedConstraint;
+extern StaticRelocAddr <const void *> RTTI_bhkForceController;
+extern StaticRelocAddr <const void *> RTTI_bhkGenericConstraint;
+extern StaticRelocAddr <const void *> RTTI_bhkHeightFieldShape;
+extern StaticRelocAddr <const void *> RTTI_bhkHingeConstraint;
+extern StaticRelocAddr <const void *> RTTI_bhkLimitedHingeConstraint;
+extern StaticRelocAddr <const void *> RTTI_bhkListShape;
+extern StaticRelocAddr <const void *> RTTI_bhkMalleableConstraint;
+extern StaticRelocAddr <const void *> RTTI_bhkMoppBvTreeShape;
+extern StaticRelocAddr <const void *> RTTI_bhkMotorAction;
+extern StaticRelocAddr <const void *> RTTI_bhkMouseSpringAction;
+extern StaticRelocAddr <const void *> RTTI_bhkMultiSphereShape;
+extern StaticRelocAddr <const void *> RTTI_bhkNiCollisionObject;
+extern StaticRelocAddr <const void *> RTTI_bhkNiTriStripsShape;
+extern StaticRelocAddr <const void *> RTTI_bhkPCollisionObject;
+extern StaticRelocAddr <const void *> RTTI_bhkPackedNiTriStripsShape;
+extern StaticRelocAddr <const void *> RTTI_bhkPhantom;
+extern StaticRelocAddr <const void *> RTTI_bhkPlaneShape;
+extern StaticRelocAddr <const void *> RTTI_bhkPointToPathConstraint;
+extern StaticRelocAddr <const void *> RTTI_bhkPoweredHingeConstraint;
+extern StaticRelocAddr <const void *> RTTI_bhkPrismaticConstraint;
+extern StaticRelocAddr <const void *> RTTI_bhkRagdollConstraint;
+extern StaticRelocAddr <const void *> RTTI_bhkRefObject;
+extern StaticRelocAddr <const void *> RTTI_bhkRigidBody;
+extern StaticRelocAddr <const void *> RTTI_bhkRigidBodyT;
+extern StaticRelocAddr <const void *> RTTI_bhkSPCollisionObject;
+extern StaticRelocAddr <const void *> RTTI_bhkSerializable;
+extern StaticRelocAddr <const void *> RTTI_bhkShape;
+extern StaticRelocAddr <const void *> RTTI_bhkShapeCollection;
+extern StaticRelocAddr <const void *> RTTI_bhkShapePhantom;
+extern StaticRelocAddr <const void *> RTTI_bhkSimpleShapePhantom;
+extern StaticRelocAddr <const void *> RTTI_bhkSphereRepShape;
+extern StaticRelocAddr <const void *> RTTI_bhkSphereShape;
+extern StaticRelocAddr <const void *> RTTI_bhkSpringAction;
+extern StaticRelocAddr <const void *> RTTI_bhkStiffSpringConstraint;
+extern StaticRelocAddr <const void *> RTTI_bhkTransformShape;
+extern StaticRelocAddr <const void *> RTTI_bhkTriSampledHeightFieldBvTreeShape;
+extern StaticRelocAddr <const void *> RTTI_bhkTriangleShape;
+extern StaticRelocAddr <const void *> RTTI_bhkUnaryAction;
+extern StaticRelocAddr <const void *> RTTI_bhkWaterListener;
+extern StaticRelocAddr <const void *> RTTI_bhkWheelConstraint;
+extern StaticRelocAddr <const void *> RTTI_bhkWindListener;
+extern StaticRelocAddr <const void *> RTTI_bhkWorld;
+extern StaticRelocAddr <const void *> RTTI_bhkWorldCinfo;
+extern StaticRelocAddr <const void *> RTTI_bhkWorldM;
+extern StaticRelocAddr <const void *> RTTI_bhkWorldObject;
+extern StaticRelocAddr <const void *> RTTI_hk3AxisSweep;
+extern StaticRelocAddr <const void *> RTTI_hkAllCdBodyPairCollector;
+extern StaticRelocAddr <const void *> RTTI_hkAllCdPointCollector;
+extern StaticRelocAddr <const void *> RTTI_hkAllRayHitCollector;
+extern StaticRelocAddr <const void *> RTTI_hkAvoidBox;
+extern StaticRelocAddr <const void *> RTTI_hkBSHeightFieldShape;
+extern StaticRelocAddr <const void *> RTTI_hkBallAndSocketConstraintCinfo;
+extern StaticRelocAddr <const void *> RTTI_hkBaseObject;
+extern StaticRelocAddr <const void *> RTTI_hkBreakableConstraintCinfo;
+extern StaticRelocAddr <const void *> RTTI_hkBreakableConstraintData;
+extern StaticRelocAddr <const void *> RTTI_hkBroadPhaseCastCollector;
+extern StaticRelocAddr <const void *> RTTI_hkCdBodyPairCollector;
+extern StaticRelocAddr <const void *> RTTI_hkCdPointCollector;
+extern StaticRelocAddr <const void *> RTTI_hkCharControllerShape;
+extern StaticRelocAddr <const void *> RTTI_hkCharacterProxyListener;
+extern StaticRelocAddr <const void *> RTTI_hkClosestCdPointCollector;
+extern StaticRelocAddr <const void *> RTTI_hkClosestRayHitCollector;
+extern StaticRelocAddr <const void *> RTTI_hkCollisionListener;
+extern StaticRelocAddr <const void *> RTTI_hkConstraintCinfo;
+extern StaticRelocAddr <const void *> RTTI_hkContinuousSimulation;
+extern StaticRelocAddr <const void *> RTTI_hkDefaultToiResourceMgr;
+extern StaticRelocAddr <const void *> RTTI_hkDiscreteSimulation;
+extern StaticRelocAddr <const void *> RTTI_hkEntityListener;
+extern StaticRelocAddr <const void *> RTTI_hkFirstCdBodyPairCollector;
+extern StaticRelocAddr <const void *> RTTI_hkFixedConstraintCinfo;
+extern StaticRelocAddr <const void *> RTTI_hkGenericConstraintCinfo;
+extern StaticRelocAddr <const void *> RTTI_hkHingeConstraintCinfo;
+extern StaticRelocAddr <const void *> RTTI_hkLimitedHingeConstraintCinfo;
+extern StaticRelocAddr <const void *> RTTI_hkMalleableConstraintCinfo;
+extern StaticRelocAddr <const void *> RTTI_hkMalleableConstraintData;
+extern StaticRelocAddr <const void *> RTTI_hkMoppCode;
+extern StaticRelocAddr <const void *> RTTI_hkMoppCodeGenerator;
+extern StaticRelocAddr <const void *> RTTI_hkMoppDefaultAssembler;
+extern StaticRelocAddr <const void *> RTTI_hkMoppDefaultCostFunction;
+extern StaticRelocAddr <const void *> RTTI_hkMoppDefaultSplitter;
+extern StaticRelocAddr <const void *> RTTI_hkMoppShapeMediator;
+extern StaticRelocAddr <const void *> RTTI_hkMotorAction;
+extern StaticRelocAddr <const void *> RTTI_hkMultiThreadedSimulation;
+extern StaticRelocAddr <const void *> RTTI_hkMultiThreadedSimulation__MtEntityEntityBroadPhaseListener;
+extern StaticRelocAddr <const void *> RTTI_hkMultiThreadedSimulation__MtPhantomBroadPhaseListener;
+extern StaticRelocAddr <const void *> RTTI_hkNiTriStripsShape;
+extern StaticRelocAddr <const void *> RTTI_hkNormalTriangleShape;
+extern StaticRelocAddr <const void *> RTTI_hkPackedNiTriStripsData;
+extern StaticRelocAddr <const void *> RTTI_hkPackedNiTriStripsShape;
+extern StaticRelocAddr <const void *> RTTI_hkPhantomListener;
+extern StaticRelocAddr <const void *> RTTI_hkPhantomOverlapListener;
+extern StaticRelocAddr <const void *> RTTI_hkPointToPathConstraintCinfo;
+extern StaticRelocAddr <const void *> RTTI_hkPoweredHingeConstraintCinfo;
+extern StaticRelocAddr <const void *> RTTI_hkPoweredRagdollConstraintData;
+extern StaticRelocAddr <const void *> RTTI_hkPrismaticConstraintCinfo;
+extern StaticRelocAddr <const void *> RTTI_hkRagdollConstraintCinfo;
+extern StaticRelocAddr <const void *> RTTI_hkRagdollConstraintData;
+extern StaticRelocAddr <const void *> RTTI_hkRayHitCollector;
+extern StaticRelocAddr <const void *> RTTI_hkRayShapeCollectionFilter;
+extern StaticRelocAddr <const void *> RTTI_hkReferencedObject;
+extern StaticRelocAddr <const void *> RTTI_hkScaledMoppBvTreeShape;
+extern StaticRelocAddr <const void *> RTTI_hkShapeCollectionFilter;
+extern StaticRelocAddr <const void *> RTTI_hkStiffSpringConstraintCinfo;
+extern StaticRelocAddr <const void *> RTTI_hkTriangleShape;
+extern StaticRelocAddr <const void *> RTTI_hkWheelConstraintCinfo;
+extern StaticRelocAddr <const void *> RTTI_hkWorldRayCaster;
+extern StaticRelocAddr <const void *> RTTI_icu_64__AbsoluteValueSubstitution;
+extern StaticRelocAddr <const void *> RTTI_icu_64__AndConstraint;
+extern StaticRelocAddr <const void *> RTTI_icu_64__AnnualTimeZoneRule;
+extern StaticRelocAddr <const void *> RTTI_icu_64__Appendable;
+extern StaticRelocAddr <const void *> RTTI_icu_64__BMPSet;
+extern StaticRelocAddr <const void *> RTTI_icu_64__BasicCalendarFactory;
+extern StaticRelocAddr <const void *> RTTI_icu_64__BasicTimeZone;
+extern StaticRelocAddr <const void *> RTTI_icu_64__BreakIterator;
+extern StaticRelocAddr <const void *> RTTI_icu_64__BuddhistCalendar;
+extern StaticRelocAddr <const void *> RTTI_icu_64__BurmeseBreakEngine;
+extern StaticRelocAddr <const void *> RTTI_icu_64__ByteSink;
+extern StaticRelocAddr <const void *> RTTI_icu_64__BytesDictionaryMatcher;
+extern StaticRelocAddr <const void *> RTTI_icu_64__CECalendar;
+extern StaticRelocAddr <const void *> RTTI_icu_64__CEFinalizer;
+extern StaticRelocAddr <const void *> RTTI_icu_64__CacheKeyBase;
+extern StaticRelocAddr <const void *> RTTI_icu_64__Calendar;
+extern StaticRelocAddr <const void *> RTTI_icu_64__CalendarAstronomer__AngleFunc;
+extern StaticRelocAddr <const void *> RTTI_icu_64__CalendarCache;
+extern StaticRelocAddr <const void *> RTTI_icu_64__CalendarService;
+extern StaticRelocAddr <const void *> RTTI_icu_64__CanonicalIterator;
+extern StaticRelocAddr <const void *> RTTI_icu_64__CharStringByteSink;
+extern StaticRelocAddr <const void *> RTTI_icu_64__CharacterIterator;
+extern StaticRelocAddr <const void *> RTTI_icu_64__CheckedArrayByteSink;
+extern StaticRelocAddr <const void *> RTTI_icu_64__ChineseCalendar;
+extern StaticRelocAddr <const void *> RTTI_icu_64__CjkBreakEngine;
+extern StaticRelocAddr <const void *> RTTI_icu_64__CollationBuilder;
+extern StaticRelocAddr <const void *> RTTI_icu_64__CollationCacheEntry;
+extern StaticRelocAddr <const void *> RTTI_icu_64__CollationDataBuilder;
+extern StaticRelocAddr <const void *> RTTI_icu_64__CollationDataBuilder__CEModifier;
+extern StaticRelocAddr <const void *> RTTI_icu_64__CollationElementIterator;
+extern StaticRelocAddr <const void *> RTTI_icu_64__CollationFastLatinBuilder;
+extern StaticRelocAddr <const void *> RTTI_icu_64__CollationIterator;
+extern StaticRelocAddr <const void *> RTTI_icu_64__CollationKeyByteSink;
+extern StaticRelocAddr <const void *> RTTI_icu_64__CollationKeys__LevelCallback;
+extern StaticRelocAddr <const void *> RTTI_icu_64__CollationRuleParser__Importer;
+extern StaticRelocAddr <const void *> RTTI_icu_64__CollationRuleParser__Sink;
+extern StaticRelocAddr <const void *> RTTI_icu_64__CollationSettings;
+extern StaticRelocAddr <const void *> RTTI_icu_64__CollationTailoring;
+extern StaticRelocAddr <const void *> RTTI_icu_64__Collator;
+extern StaticRelocAddr <const void *> RTTI_icu_64__ComposeNormalizer2;
+extern StaticRelocAddr <const void *> RTTI_icu_64__ContractionsAndExpansions__CESink;
+extern StaticRelocAddr <const void *> RTTI_icu_64__CopticCalendar;
+extern StaticRelocAddr <const void *> RTTI_icu_64__CurrencyAmount;
+extern StaticRelocAddr <const void *> RTTI_icu_64__CurrencyPluralInfo;
+extern StaticRelocAddr <const void *> RTTI_icu_64__CurrencyUnit;
+extern StaticRelocAddr <const void *> RTTI_icu_64__DangiCalendar;
+extern StaticRelocAddr <const void *> RTTI_icu_64__DataBuilderCollationIterator;
+extern StaticRelocAddr <const void *> RTTI_icu_64__DateFmtBestPattern;
+extern StaticRelocAddr <const void *> RTTI_icu_64__DateFmtBestPatternKey;
+extern StaticRelocAddr <const void *> RTTI_icu_64__DateFormat;
+extern StaticRelocAddr <const void *> RTTI_icu_64__DateFormatSymbols;
+extern StaticRelocAddr <const void *> RTTI_icu_64__DateTimeMatcher;
+extern StaticRelocAddr <const void *> RTTI_icu_64__DateTimePatternGenerator;
+extern StaticRelocAddr <const void *> RTTI_icu_64__DateTimePatternGenerator__AppendItemFormatsSink;
+extern StaticRelocAddr <const void *> RTTI_icu_64__DateTimePatternGenerator__AppendItemNamesSink;
+extern StaticRelocAddr <const void *> RTTI_icu_64__DateTimePatternGenerator__AvailableFormatsSink;
+extern StaticRelocAddr <const void *> RTTI_icu_64__DateTimeRule;
+extern StaticRelocAddr <const void *> RTTI_icu_64__DayPeriodRulesCountSink;
+extern StaticRelocAddr <const void *> RTTI_icu_64__DayPeriodRulesDataSink;
+extern StaticRelocAddr <const void *> RTTI_icu_64__DecimalFormat;
+extern StaticRelocAddr <const void *> RTTI_icu_64__DecimalFormatSymbols;
+extern StaticRelocAddr <const void *> RTTI_icu_64__DecomposeNormalizer2;
+extern StaticRelocAddr <const void *> RTTI_icu_64__DefaultCalendarFactory;
+extern StaticRelocAddr <const void *> RTTI_icu_64__DictionaryBreakEngine;
+extern StaticRelocAddr <const void *> RTTI_icu_64__DictionaryMatcher;
+extern StaticRelocAddr <const void *> RTTI_icu_64__DistanceInfo;
+extern StaticRelocAddr <const void *> RTTI_icu_64__ErrorCode;
+extern StaticRelocAddr <const void *> RTTI_icu_64__EthiopicCalendar;
+extern StaticRelocAddr <const void *> RTTI_icu_64__FCDNormalizer2;
+extern StaticRelocAddr <const void *> RTTI_icu_64__FCDUIterCollationIterator;
+extern StaticRelocAddr <const void *> RTTI_icu_64__FCDUTF16CollationIterator;
+extern StaticRelocAddr <const void *> RTTI_icu_64__FCDUTF8CollationIterator;
+extern StaticRelocAddr <const void *> RTTI_icu_64__FieldPosition;
+extern StaticRelocAddr <const void *> RTTI_icu_64__FieldPositionHandler;
+extern StaticRelocAddr <const void *> RTTI_icu_64__FieldPositionIteratorHandler;
+extern StaticRelocAddr <const void *> RTTI_icu_64__FieldPositionOnlyHandler;
+extern StaticRelocAddr <const void *> RTTI_icu_64__FilteredBreakIteratorBuilder;
+extern StaticRelocAddr <const void *> RTTI_icu_64__FixedDecimal;
+extern StaticRelocAddr <const void *> RTTI_icu_64__Format;
+extern StaticRelocAddr <const void *> RTTI_icu_64__FormatNameEnumeration;
+extern StaticRelocAddr <const void *> RTTI_icu_64__FormatParser;
+extern StaticRelocAddr <const void *> RTTI_icu_64__Formattable;
+extern StaticRelocAddr <const void *> RTTI_icu_64__FormattedValue;
+extern StaticRelocAddr <const void *> RTTI_icu_64__FormattedValueNumberStringBuilderImpl;
+extern StaticRelocAddr <const void *> RTTI_icu_64__ForwardCharacterIterator;
+extern StaticRelocAddr <const void *> RTTI_icu_64__FractionalPartSubstitution;
+extern StaticRelocAddr <const void *> RTTI_icu_64__GMTOffsetField;
+extern StaticRelocAddr <const void *> RTTI_icu_64__GNameSearchHandler;
+extern StaticRelocAddr <const void *> RTTI_icu_64__GregorianCalendar;
+extern StaticRelocAddr <const void *> RTTI_icu_64__HebrewCalendar;
+extern StaticRelocAddr <const void *> RTTI_icu_64__ICUBreakIteratorFactory;
+extern StaticRelocAddr <const void *> RTTI_icu_64__ICUBreakIteratorService;
+extern StaticRelocAddr <const void *> RTTI_icu_64__ICUCollatorFactory;
+extern StaticRelocAddr <const void *> RTTI_icu_64__ICUCollatorService;
+extern StaticRelocAddr <const void *> RTTI_icu_64__ICULanguageBreakFactory;
+extern StaticRelocAddr <const void *> RTTI_icu_64__ICULocaleService;
+extern StaticRelocAddr <const void *> RTTI_icu_64__ICUNotifier;
+extern StaticRelocAddr <const void *> RTTI_icu_64__ICUNumberFormatFactory;
+extern StaticRelocAddr <const void *> RTTI_icu_64__ICUNumberFormatService;
+extern StaticRelocAddr <const void *> RTTI_icu_64__ICUResourceBundleFactory;
+extern StaticRelocAddr <const void *> RTTI_icu_64__ICUService;
+extern StaticRelocAddr <const void *> RTTI_icu_64__ICUServiceFactory;
+extern StaticRelocAddr <const void *> RTTI_icu_64__ICUServiceKey;
+extern StaticRelocAddr <const void *> RTTI_icu_64__IFixedDecimal;
+extern StaticRelocAddr <const void *> RTTI_icu_64__IndianCalendar;
+extern StaticRelocAddr <const void *> RTTI_icu_64__InitialTimeZoneRule;
+extern StaticRelocAddr <const void *> RTTI_icu_64__IntegralPartSubstitution;
+extern StaticRelocAddr <const void *> RTTI_icu_64__IslamicCalendar;
+extern StaticRelocAddr <const void *> RTTI_icu_64__JapaneseCalendar;
+extern StaticRelocAddr <const void *> RTTI_icu_64__KeywordEnumeration;
+extern StaticRelocAddr <const void *> RTTI_icu_64__KhmerBreakEngine;
+extern StaticRelocAddr <const void *> RTTI_icu_64__LanguageBreakEngine;
+extern StaticRelocAddr <const void *> RTTI_icu_64__LanguageBreakFactory;
+extern StaticRelocAddr <const void *> RTTI_icu_64__LaoBreakEngine;
+extern StaticRelocAddr <const void *> RTTI_icu_64__LoadedNormalizer2Impl;
+extern StaticRelocAddr <const void *> RTTI_icu_64__Locale;
+extern StaticRelocAddr <const void *> RTTI_icu_64__LocaleDisplayNames;
+extern StaticRelocAddr <const void *> RTTI_icu_64__LocaleDisplayNamesImpl;
+extern StaticRelocAddr <const void *> RTTI_icu_64__LocaleDisplayNamesImpl__CapitalizationContextSink;
+extern StaticRelocAddr <const void *> RTTI_icu_64__LocaleKey;
+extern StaticRelocAddr <const void *> RTTI_icu_64__LocaleKeyFactory;
+extern StaticRelocAddr <const void *> RTTI_icu_64__Measure;
+extern StaticRelocAddr <const void *> RTTI_icu_64__MeasureUnit;
+extern StaticRelocAddr <const void *> RTTI_icu_64__MessageFormat;
+extern StaticRelocAddr <const void *> RTTI_icu_64__MessageFormat__DummyFormat;
+extern StaticRelocAddr <const void *> RTTI_icu_64__MessageFormat__PluralSelectorProvider;
+extern StaticRelocAddr <const void *> RTTI_icu_64__MessagePattern;
+extern StaticRelocAddr <const void *> RTTI_icu_64__MetaZoneIDsEnumeration;
+extern StaticRelocAddr <const void *> RTTI_icu_64__ModulusSubstitution;
+extern StaticRelocAddr <const void *> RTTI_icu_64__MoonTimeAngleFunc;
+extern StaticRelocAddr <const void *> RTTI_icu_64__MultiplierSubstitution;
+extern StaticRelocAddr <const void *> RTTI_icu_64__NFSubstitution;
+extern StaticRelocAddr <const void *> RTTI_icu_64__NoUnit;
+extern StaticRelocAddr <const void *> RTTI_icu_64__NoopNormalizer2;
+extern StaticRelocAddr <const void *> RTTI_icu_64__Normalizer2;
+extern StaticRelocAddr <const void *> RTTI_icu_64__Normalizer2Impl;
+extern StaticRelocAddr <const void *> RTTI_icu_64__NumberFormat;
+extern StaticRelocAddr <const void *> RTTI_icu_64__NumberingSystem;
+extern StaticRelocAddr <const void *> RTTI_icu_64__NumeratorSubstitution;
+extern StaticRelocAddr <const void *> RTTI_icu_64__OlsonTimeZone;
+extern StaticRelocAddr <const void *> RTTI_icu_64__OrConstraint;
+extern StaticRelocAddr <const void *> RTTI_icu_64__ParsePosition;
+extern StaticRelocAddr <const void *> RTTI_icu_64__PatternMap;
+extern StaticRelocAddr <const void *> RTTI_icu_64__PatternMapIterator;
+extern StaticRelocAddr <const void *> RTTI_icu_64__PersianCalendar;
+extern StaticRelocAddr <const void *> RTTI_icu_64__PluralFormat;
+extern StaticRelocAddr <const void *> RTTI_icu_64__PluralFormat__PluralSelector;
+extern StaticRelocAddr <const void *> RTTI_icu_64__PluralFormat__PluralSelectorAdapter;
+extern StaticRelocAddr <const void *> RTTI_icu_64__PluralKeywordEnumeration;
+extern StaticRelocAddr <const void *> RTTI_icu_64__PluralRuleParser;
+extern StaticRelocAddr <const void *> RTTI_icu_64__PluralRules;
+extern StaticRelocAddr <const void *> RTTI_icu_64__PtnElem;
+extern StaticRelocAddr <const void *> RTTI_icu_64__PtnSkeleton;
+extern StaticRelocAddr <const void *> RTTI_icu_64__RegexCompile;
+extern StaticRelocAddr <const void *> RTTI_icu_64__RegexMatcher;
+extern StaticRelocAddr <const void *> RTTI_icu_64__RegexPattern;
+extern StaticRelocAddr <const void *> RTTI_icu_64__RelativeDateFormat;
+extern StaticRelocAddr <const void *> RTTI_icu_64__Replaceable;
+extern StaticRelocAddr <const void *> RTTI_icu_64__ResourceBundle;
+extern StaticRelocAddr <const void *> RTTI_icu_64__ResourceDataValue;
+extern StaticRelocAddr <const void *> RTTI_icu_64__ResourceSink;
+extern StaticRelocAddr <const void *> RTTI_icu_64__ResourceValue;
+extern StaticRelocAddr <const void *> RTTI_icu_64__RuleBasedBreakIterator;
+extern StaticRelocAddr <const void *> RTTI_icu_64__RuleBasedBreakIterator__BreakCache;
+extern StaticRelocAddr <const void *> RTTI_icu_64__RuleBasedCollator;
+extern StaticRelocAddr <const void *> RTTI_icu_64__RuleBasedNumberFormat;
+extern StaticRelocAddr <const void *> RTTI_icu_64__RuleBasedTimeZone;
+extern StaticRelocAddr <const void *> RTTI_icu_64__RuleChain;
+extern StaticRelocAddr <const void *> RTTI_icu_64__SameValueSubstitution;
+extern StaticRelocAddr <const void *> RTTI_icu_64__ServiceEnumeration;
+extern StaticRelocAddr <const void *> RTTI_icu_64__SharedCalendar;
+extern StaticRelocAddr <const void *> RTTI_icu_64__SharedDateFormatSymbols;
+extern StaticRelocAddr <const void *> RTTI_icu_64__SharedNumberFormat;
+extern StaticRelocAddr <const void *> RTTI_icu_64__SharedObject;
+extern StaticRelocAddr <const void *> RTTI_icu_64__SharedPluralRules;
+extern StaticRelocAddr <const void *> RTTI_icu_64__SimpleDateFormat;
+extern StaticRelocAddr <const void *> RTTI_icu_64__SimpleFactory;
+extern StaticRelocAddr <const void *> RTTI_icu_64__SimpleFilteredBreakIteratorBuilder;
+extern StaticRelocAddr <const void *> RTTI_icu_64__SimpleFilteredSentenceBreakData;
+extern StaticRelocAddr <const void *> RTTI_icu_64__SimpleFilteredSentenceBreakIterator;
+extern StaticRelocAddr <const void *> RTTI_icu_64__SimpleLocaleKeyFactory;
+extern StaticRelocAddr <const void *> RTTI_icu_64__SimpleTimeZone;
+extern StaticRelocAddr <const void *> RTTI_icu_64__SortKeyByteSink;
+extern StaticRelocAddr <const void *> RTTI_icu_64__StringCharacterIterator;
+extern StaticRelocAddr <const void *> RTTI_icu_64__StringEnumeration;
+extern StaticRelocAddr <const void *> RTTI_icu_64__StringTrieBuilder;
+extern StaticRelocAddr <const void *> RTTI_icu_64__StringTrieBuilder__BranchHeadNode;
+extern StaticRelocAddr <const void *> RTTI_icu_64__StringTrieBuilder__FinalValueNode;
+extern StaticRelocAddr <const void *> RTTI_icu_64__StringTrieBuilder__IntermediateValueNode;
+extern StaticRelocAddr <const void *> RTTI_icu_64__StringTrieBuilder__ListBranchNode;
+extern StaticRelocAddr <const void *> RTTI_icu_64__StringTrieBuilder__SplitBranchNode;
+extern StaticRelocAddr <const void *> RTTI_icu_64__SunTimeAngleFunc;
+extern StaticRelocAddr <const void *> RTTI_icu_64__TZDBNameSearchHandler;
+extern StaticRelocAddr <const void *> RTTI_icu_64__TZDBNames;
+extern StaticRelocAddr <const void *> RTTI_icu_64__TZDBTimeZoneNames;
+extern StaticRelocAddr <const void *> RTTI_icu_64__TZEnumeration;
+extern StaticRelocAddr <const void *> RTTI_icu_64__TZGNCore;
+extern StaticRelocAddr <const void *> RTTI_icu_64__TaiwanCalendar;
+extern StaticRelocAddr <const void *> RTTI_icu_64__TextTrieMap;
+extern StaticRelocAddr <const void *> RTTI_icu_64__TextTrieMapSearchResultHandler;
+extern StaticRelocAddr <const void *> RTTI_icu_64__ThaiBreakEngine;
+extern StaticRelocAddr <const void *> RTTI_icu_64__TimeArrayTimeZoneRule;
+extern StaticRelocAddr <const void *> RTTI_icu_64__TimeZone;
+extern StaticRelocAddr <const void *> RTTI_icu_64__TimeZoneFormat;
+extern StaticRelocAddr <const void *> RTTI_icu_64__TimeZoneGenericNames;
+extern StaticRelocAddr <const void *> RTTI_icu_64__TimeZoneNames;
+extern StaticRelocAddr <const void *> RTTI_icu_64__TimeZoneNamesDelegate;
+extern StaticRelocAddr <const void *> RTTI_icu_64__TimeZoneNamesImpl;
+extern StaticRelocAddr <const void *> RTTI_icu_64__TimeZoneNamesImpl__ZoneStringsLoader;
+extern StaticRelocAddr <const void *> RTTI_icu_64__TimeZoneNames__MatchInfoCollection;
+extern StaticRelocAddr <const void *> RTTI_icu_64__TimeZoneRule;
+extern StaticRelocAddr <const void *> RTTI_icu_64__TimeZoneTransition;
+extern StaticRelocAddr <const void *> RTTI_icu_64__UCharCharacterIterator;
+extern StaticRelocAddr <const void *> RTTI_icu_64__UCharsDictionaryMatcher;
+extern StaticRelocAddr <const void *> RTTI_icu_64__UCharsTrieBuilder;
+extern StaticRelocAddr <const void *> RTTI_icu_64__UCharsTrieBuilder__UCTLinearMatchNode;
+extern StaticRelocAddr <const void *> RTTI_icu_64__UIterCollationIterator;
+extern StaticRelocAddr <const void *> RTTI_icu_64__UObject;
+extern StaticRelocAddr <const void *> RTTI_icu_64__UStack;
+extern StaticRelocAddr <const void *> RTTI_icu_64__UStringSet;
+extern StaticRelocAddr <const void *> RTTI_icu_64__UTF16CollationIterator;
+extern StaticRelocAddr <const void *> RTTI_icu_64__UTF8CollationIterator;
+extern StaticRelocAddr <const void *> RTTI_icu_64__UVector;
+extern StaticRelocAddr <const void *> RTTI_icu_64__UVector32;
+extern StaticRelocAddr <const void *> RTTI_icu_64__UVector64;
+extern StaticRelocAddr <const void *> RTTI_icu_64__UnhandledEngine;
+extern StaticRelocAddr <const void *> RTTI_icu_64__UnicodeFilter;
+extern StaticRelocAddr <const void *> RTTI_icu_64__UnicodeFunctor;
+extern StaticRelocAddr <const void *> RTTI_icu_64__UnicodeMatcher;
+extern StaticRelocAddr <const void *> RTTI_icu_64__UnicodeSet;
+extern StaticRelocAddr <const void *> RTTI_icu_64__UnicodeSetIterator;
+extern StaticRelocAddr <const void *> RTTI_icu_64__UnicodeString;
+extern StaticRelocAddr <const void *> RTTI_icu_64__UnicodeStringAppendable;
+extern StaticRelocAddr <const void *> RTTI_icu_64__UnifiedCache;
+extern StaticRelocAddr <const void *> RTTI_icu_64__UnifiedCacheBase;
+extern StaticRelocAddr <const void *> RTTI_icu_64__WholeStringBreakIterator;
+extern StaticRelocAddr <const void *> RTTI_icu_64__Win32DateFormat;
+extern StaticRelocAddr <const void *> RTTI_icu_64__Win32NumberFormat;
+extern StaticRelocAddr <const void *> RTTI_icu_64__ZNameSearchHandler;
+extern StaticRelocAddr <const void *> RTTI_icu_64__ZNames__ZNamesLoader;
+extern StaticRelocAddr <const void *> RTTI_icu_64__ZoneIdMatchHandler;
+extern StaticRelocAddr <const void *> RTTI_icu_64__number__FormattedNumber;
+extern StaticRelocAddr <const void *> RTTI_icu_64__number__impl__AdoptingModifierStore;
+extern StaticRelocAddr <const void *> RTTI_icu_64__number__impl__AffixPatternProvider;
+extern StaticRelocAddr <const void *> RTTI_icu_64__number__impl__CompactData;
+extern StaticRelocAddr <const void *> RTTI_icu_64__number__impl__CompactData__CompactDataSink;
+extern StaticRelocAddr <const void *> RTTI_icu_64__number__impl__CompactHandler;
+extern StaticRelocAddr <const void *> RTTI_icu_64__number__impl__ConstantMultiFieldModifier;
+extern StaticRelocAddr <const void *> RTTI_icu_64__number__impl__CurrencyPluralInfoAffixProvider;
+extern StaticRelocAddr <const void *> RTTI_icu_64__number__impl__CurrencySpacingEnabledModifier;
+extern StaticRelocAddr <const void *> RTTI_icu_64__number__impl__DecimalQuantity;
+extern StaticRelocAddr <const void *> RTTI_icu_64__number__impl__EmptyModifier;
+extern StaticRelocAddr <const void *> RTTI_icu_64__number__impl__ImmutablePatternModifier;
+extern StaticRelocAddr <const void *> RTTI_icu_64__number__impl__LocalizedNumberFormatterAsFormat;
+extern StaticRelocAddr <const void *> RTTI_icu_64__number__impl__LongNameHandler;
+extern StaticRelocAddr <const void *> RTTI_icu_64__number__impl__MicroProps;
+extern StaticRelocAddr <const void *> RTTI_icu_64__number__impl__MicroPropsGenerator;
+extern StaticRelocAddr <const void *> RTTI_icu_64__number__impl__Modifier;
+extern StaticRelocAddr <const void *> RTTI_icu_64__number__impl__ModifierStore;
+extern StaticRelocAddr <const void *> RTTI_icu_64__number__impl__MultiplierFormatHandler;
+extern StaticRelocAddr <const void *> RTTI_icu_64__number__impl__MultiplierProducer;
+extern StaticRelocAddr <const void *> RTTI_icu_64__number__impl__MutablePatternModifier;
+extern StaticRelocAddr <const void *> RTTI_icu_64__number__impl__ParsedPatternInfo;
+extern StaticRelocAddr <const void *> RTTI_icu_64__number__impl__PropertiesAffixPatternProvider;
+extern StaticRelocAddr <const void *> RTTI_icu_64__number__impl__ScientificHandler;
+extern StaticRelocAddr <const void *> RTTI_icu_64__number__impl__ScientificModifier;
+extern StaticRelocAddr <const void *> RTTI_icu_64__number__impl__SimpleModifier;
+extern StaticRelocAddr <const void *> RTTI_icu_64__number__impl__SymbolProvider;
+extern StaticRelocAddr <const void *> RTTI_icu_64__number__impl__TokenConsumer;
+extern StaticRelocAddr <const void *> RTTI_icu_64__number__impl__UFormattedNumberData;
+extern StaticRelocAddr <const void *> RTTI_icu_64__numparse__impl__AffixMatcher;
+extern StaticRelocAddr <const void *> RTTI_icu_64__numparse__impl__AffixPatternMatcher;
+extern StaticRelocAddr <const void *> RTTI_icu_64__numparse__impl__AffixPatternMatcherBuilder;
+extern StaticRelocAddr <const void *> RTTI_icu_64__numparse__impl__ArraySeriesMatcher;
+extern StaticRelocAddr <const void *> RTTI_icu_64__numparse__impl__CodePointMatcher;
+extern StaticRelocAddr <const void *> RTTI_icu_64__numparse__impl__CombinedCurrencyMatcher;
+extern StaticRelocAddr <const void *> RTTI_icu_64__numparse__impl__DecimalMatcher;
+extern StaticRelocAddr <const void *> RTTI_icu_64__numparse__impl__IgnorablesMatcher;
+extern StaticRelocAddr <const void *> RTTI_icu_64__numparse__impl__InfinityMatcher;
+extern StaticRelocAddr <const void *> RTTI_icu_64__numparse__impl__MinusSignMatcher;
+extern StaticRelocAddr <const void *> RTTI_icu_64__numparse__impl__MultiplierParseHandler;
+extern StaticRelocAddr <const void *> RTTI_icu_64__numparse__impl__NanMatcher;
+extern StaticRelocAddr <const void *> RTTI_icu_64__numparse__impl__NumberParseMatcher;
+extern StaticRelocAddr <const void *> RTTI_icu_64__numparse__impl__NumberParserImpl;
+extern StaticRelocAddr <const void *> RTTI_icu_64__numparse__impl__PaddingMatcher;
+extern StaticRelocAddr <const void *> RTTI_icu_64__numparse__impl__PercentMatcher;
+extern StaticRelocAddr <const void *> RTTI_icu_64__numparse__impl__PermilleMatcher;
+extern StaticRelocAddr <const void *> RTTI_icu_64__numparse__impl__PlusSignMatcher;
+extern StaticRelocAddr <const void *> RTTI_icu_64__numparse__impl__RequireAffixValidator;
+extern StaticRelocAddr <const void *> RTTI_icu_64__numparse__impl__RequireCurrencyValidator;
+extern StaticRelocAddr <const void *> RTTI_icu_64__numparse__impl__RequireDecimalSeparatorValidator;
+extern StaticRelocAddr <const void *> RTTI_icu_64__numparse__impl__RequireNumberValidator;
+extern StaticRelocAddr <const void *> RTTI_icu_64__numparse__impl__ScientificMatcher;
+extern StaticRelocAddr <const void *> RTTI_icu_64__numparse__impl__SymbolMatcher;
+extern StaticRelocAddr <const void *> RTTI_mkvparser__AudioTrack;
+extern StaticRelocAddr <const void *> RTTI_mkvparser__BlockEntry;
+extern StaticRelocAddr <const void *> RTTI_mkvparser__BlockGroup;
+extern StaticRelocAddr <const void *> RTTI_mkvparser__IMkvReader;
+extern StaticRelocAddr <const void *> RTTI_mkvparser__SimpleBlock;
+extern StaticRelocAddr <const void *> RTTI_mkvparser__Track;
+extern StaticRelocAddr <const void *> RTTI_mkvparser__Track__EOSBlock;
+extern StaticRelocAddr <const void *> RTTI_mkvparser__VideoTrack;
+extern StaticRelocAddr <const void *> RTTI_std___Generic_error_category;
+extern StaticRelocAddr <const void *> RTTI_std___Ref_count_base;
+extern StaticRelocAddr <const void *> RTTI_std___System_error;
+extern StaticRelocAddr <const void *> RTTI_std__exception;
+extern StaticRelocAddr <const void *> RTTI_std__invalid_argument;
+extern StaticRelocAddr <const void *> RTTI_std__logic_error;
+extern StaticRelocAddr <const void *> RTTI_std__range_error;
+extern StaticRelocAddr <const void *> RTTI_std__runtime_error;
+extern StaticRelocAddr <const void *> RTTI_std__system_error;
+extern StaticRelocAddr <const void *> RTTI_testing__MatchResultListener;
+extern StaticRelocAddr <const void *> RTTI_testing__Test;
+extern StaticRelocAddr <const void *> RTTI_testing__TestEventListener;
+extern StaticRelocAddr <const void *> RTTI_testing__TestPartResultReporterInterface;
+extern StaticRelocAddr <const void *> RTTI_testing__TestSuite;
+extern StaticRelocAddr <const void *> RTTI_testing__UnitTest;
+extern StaticRelocAddr <const void *> RTTI_testing__internal__DeathTest;
+extern StaticRelocAddr <const void *> RTTI_testing__internal__DeathTestFactory;
+extern StaticRelocAddr <const void *> RTTI_testing__internal__DeathTestImpl;
+extern StaticRelocAddr <const void *> RTTI_testing__internal__DefaultDeathTestFactory;
+extern StaticRelocAddr <const void *> RTTI_testing__internal__DefaultGlobalTestPartResultReporter;
+extern StaticRelocAddr <const void *> RTTI_testing__internal__DefaultPerThreadTestPartResultReporter;
+extern StaticRelocAddr <const void *> RTTI_testing__internal__DummyMatchResultListener;
+extern StaticRelocAddr <const void *> RTTI_testing__internal__GoogleTestFailureException;
+extern StaticRelocAddr <const void *> RTTI_testing__internal__OsStackTraceGetter;
+extern StaticRelocAddr <const void *> RTTI_testing__internal__OsStackTraceGetterInterface;
+extern StaticRelocAddr <const void *> RTTI_testing__internal__PrettyUnitTestResultPrinter;
+extern StaticRelocAddr <const void *> RTTI_testing__internal__TestEventRepeater;
+extern StaticRelocAddr <const void *> RTTI_testing__internal__ThreadLocalBase;
+extern StaticRelocAddr <const void *> RTTI_testing__internal__ThreadLocalValueHolderBase;
+extern StaticRelocAddr <const void *> RTTI_testing__internal__UnitTestImpl;
+extern StaticRelocAddr <const void *> RTTI_testing__internal__WindowsDeathTest;
+extern StaticRelocAddr <const void *> RTTI_type_info;
@@ -1,4 +1,4 @@
 #include "GameScript.h"
 
-RelocPtr <CommandInfo>	g_firstScriptCommand(0x08FEC850);
-RelocPtr <CommandInfo>	g_firstConsoleCommand(0x08FF3C40);
+RELOC_STATIC StaticRelocPtr <CommandInfo>	g_firstScriptCommand(0x08FEC850);
+RELOC_STATIC StaticRelocPtr <CommandInfo>	g_firstConsoleCommand(0x08FF3C40);
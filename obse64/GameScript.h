@@ -84,5 +84,5 @@ enum
 	kScript_OBSEOpBase = 0x1400,
 };
 
-extern RelocPtr <CommandInfo>	g_firstScriptCommand;
-extern RelocPtr <CommandInfo>	g_firstConsoleCommand;
+extern StaticRelocPtr <CommandInfo>	g_firstScriptCommand;
+extern StaticRelocPtr <CommandInfo>	g_firstConsoleCommand;
@@ -0,0 +1,200 @@
+#include "HookThunks.h"
+#include "obse64_common/BranchTrampoline.h"
+#include "obse64_common/Log.h"
+#include "xbyak/xbyak.h"
+
+#ifdef _WIN32
+#include <Windows.h>
+#endif
+
+// UNWIND_CODE ops
+enum
+{
+	kUnwindOp_AllocLarge = 1,	// next slot is the size / 8
+	kUnwindOp_AllocSmall = 2,	// info is size / 8 - 1
+};
+
+bool GenerateHookThunk(Xbyak::CodeGenerator & code, const HookThunkDesc & desc, u64 ** origSlotOut,
+	HookThunkFunctionEntry ** functionEntryOut)
+{
+	using namespace Xbyak::util;
+
+	const Xbyak::Reg64 intArgs[4] = { rcx, rdx, r8, r9 };
+	const Xbyak::Xmm floatArgs[4] = { xmm0, xmm1, xmm2, xmm3 };
+
+	u32 numRegArgs = (desc.numArgs < 4) ? desc.numArgs : 4;
+	u32 numStackArgs = desc.numArgs - numRegArgs;
+
+	// shadow space plus outgoing stack arguments, keeping rsp 16 byte aligned at each call
+	u32 frameSize = 32 + (numStackArgs * 8);
+	if((frameSize & 15) != 8)
+		frameSize += 8;
+
+	// caller's home area and stack arguments, relative to rsp after the frame is set up
+	u32 homeOffset = frameSize + 8;
+	u32 callerStackArgsOffset = homeOffset + 32;
+
+	Xbyak::Label origSlot, preAddr, postAddr, functionEntry;
+
+	bool hasFrame = desc.pre || desc.post;
+	size_t prologSize = 0;
+	size_t codeSize = 0;
+
+	try
+	{
+		if(!hasFrame)
+		{
+			code.jmp(code.ptr[rip + origSlot]);
+		}
+		else
+		{
+			code.sub(rsp, frameSize);
+			prologSize = code.getSize();
+
+			// the caller's home area belongs to us
+			for(u32 i = 0; i < numRegArgs; i++)
+			{
+				if(desc.floatArgs & (1 << i))
+					code.movsd(code.ptr[rsp + homeOffset + (i * 8)], floatArgs[i]);
+				else
+					code.mov(code.ptr[rsp + homeOffset + (i * 8)], intArgs[i]);
+			}
+
+			// stack arguments are passed on to both calls from our frame
+			for(u32 i = 0; i < numStackArgs; i++)
+			{
+				code.mov(rax, code.ptr[rsp + callerStackArgsOffset + (i * 8)]);
+				code.mov(code.ptr[rsp + 32 + (i * 8)], rax);
+			}
+
+			if(desc.pre)
+			{
+				code.call(code.ptr[rip + preAddr]);
+
+				for(u32 i = 0; i < numRegArgs; i++)
+				{
+					if(desc.floatArgs & (1 << i))
+						code.movsd(floatArgs[i], code.ptr[rsp + homeOffset + (i * 8)]);
+					else
+						code.mov(intArgs[i], code.ptr[rsp + homeOffset + (i * 8)]);
+				}
+			}
+
+			if(!desc.post)
+			{
+				// tail call, the function returns straight to our caller
+				code.add(rsp, frameSize);
+				code.jmp(code.ptr[rip + origSlot]);
+			}
+			else
+			{
+				code.call(code.ptr[rip + origSlot]);
+
+				// return value becomes the first argument, float results are already in xmm0
+				if(!desc.floatReturn)
+					code.mov(rcx, rax);
+
+				code.call(code.ptr[rip + postAddr]);
+
+				code.add(rsp, frameSize);
+				code.ret();
+			}
+		}
+
+		codeSize = code.getSize();
+
+		code.align(8);
+		code.L(origSlot);
+		code.dq(0);
+		code.L(preAddr);
+		code.dq(desc.pre);
+		code.L(postAddr);
+		code.dq(desc.post);
+
+		// the only prolog op is the sub, both epilogs (add rsp then ret or jmp) are found by the unwinder
+		// without being described. a thunk without a frame is a leaf, it doesn't need any
+		if(hasFrame)
+		{
+			size_t unwindInfo = code.getSize();
+
+			code.db(1);				// version 1, no flags
+			code.db(prologSize);
+			code.db((frameSize <= 128) ? 1 : 2);
+			code.db(0);				// no frame register
+
+			code.db(prologSize);
+			if(frameSize <= 128)
+			{
+				code.db(kUnwindOp_AllocSmall | (((frameSize / 8) - 1) << 4));
+				code.dw(0);			// the slot count is always padded to even
+			}
+			else
+			{
+				code.db(kUnwindOp_AllocLarge);
+				code.dw(frameSize / 8);
+			}
+
+			code.L(functionEntry);
+			code.dd(0);
+			code.dd(codeSize);
+			code.dd(unwindInfo);
+		}
+	}
+	catch(const Xbyak::Error & err)
+	{
+		_ERROR("GenerateHookThunk: %s", err.what());
+		return false;
+	}
+
+	*origSlotOut = (u64 *)origSlot.getAddress();
+	*functionEntryOut = hasFrame ? (HookThunkFunctionEntry *)functionEntry.getAddress() : nullptr;
+
+	return true;
+}
+
+uintptr_t CreateHookThunk(const HookThunkDesc & desc, u64 ** origSlotOut, HookThunkFunctionEntry ** functionEntryOut)
+{
+	void * buf = g_branchTrampoline.allocate(kHookThunk_MaxSize);
+	if(!buf)
+		return 0;
+
+	bool result = false;
+	HookThunkFunctionEntry * functionEntry = nullptr;
+
+	{
+		BranchTrampoline::WriteWindow window(g_branchTrampoline, buf, kHookThunk_MaxSize);
+		Xbyak::CodeGenerator code(kHookThunk_MaxSize, buf);
+
+		result = GenerateHookThunk(code, desc, origSlotOut, &functionEntry);
+	}
+
+	if(!result)
+	{
+		g_branchTrampoline.release(buf, kHookThunk_MaxSize);
+		return 0;
+	}
+
+#ifdef _WIN32
+	// offsets in the entry are from buf. not fatal, the thunk still runs, exceptions just can't pass through it
+	if(functionEntry && !RtlAddFunctionTable((PRUNTIME_FUNCTION)functionEntry, 1, DWORD64(buf)))
+		_WARNING("CreateHookThunk: couldn't register unwind data for %016I64X", buf);
+#endif
+
+	if(functionEntryOut)
+		*functionEntryOut = functionEntry;
+
+	return uintptr_t(buf);
+}
+
+void ReleaseHookThunk(uintptr_t thunk)
+{
+#ifdef _WIN32
+	DWORD64 imageBase = 0;
+
+	auto functionEntry = RtlLookupFunctionEntry(thunk, &imageBase, nullptr);
+	if(functionEntry && (imageBase == thunk))
+		RtlDeleteFunctionTable(functionEntry);
+#endif
+
+	g_branchTrampoline.release((void *)thunk, kHookThunk_MaxSize);
+}
@@ -0,0 +1,47 @@
+#pragma once
+
+#include <cstdint>
+#include "obse64_common/Types.h"
+
+namespace Xbyak
+{
+	class CodeGenerator;
+}
+
+// describes the function being wrapped, so the generated thunk only saves what it has to
+struct HookThunkDesc
+{
+	u32			numArgs;
+	u32			floatArgs;		// bit n set if register argument n (0-3) is float or double
+	bool		floatReturn;
+
+	uintptr_t	pre;			// void pre(same arguments as the function), optional
+	uintptr_t	post;			// ret post(ret), gets the return value and returns what the caller sees, optional
+};
+
+// RUNTIME_FUNCTION, offsets are from the start of the thunk
+struct HookThunkFunctionEntry
+{
+	u32	begin;
+	u32	end;
+	u32	unwindInfo;
+};
+
+// generates a Win64 thunk that calls pre, the function through *origSlotOut, then post
+// without post the function is tail called and no frame is left on the stack
+// thunks with a frame also get unwind data, *functionEntryOut is set to it or to null if the thunk has no frame
+// returns false if the code doesn't fit
+bool GenerateHookThunk(Xbyak::CodeGenerator & code, const HookThunkDesc & desc, u64 ** origSlotOut,
+	HookThunkFunctionEntry ** functionEntryOut);
+
+// allocates from the branch trampoline and registers the unwind data, so exceptions and stack walks get past
+// the thunk. returns 0 on failure
+uintptr_t CreateHookThunk(const HookThunkDesc & desc, u64 ** origSlotOut, HookThunkFunctionEntry ** functionEntryOut = nullptr);
+
+// unregisters the unwind data and gives the memory back
+void ReleaseHookThunk(uintptr_t thunk);
+
+enum
+{
+	kHookThunk_MaxSize = 256,
+};
@@ -1,13 +1,15 @@
 #include "Hooks_Gameplay.h"
+#include "PluginManager.h"
 #include "obse64_common/BranchTrampoline.h"
 #include "obse64_common/Relocation.h"
 
-RelocAddr <uintptr_t> OblivionThread_Target(0x065FB250 + 0x1208);
-RelocAddr <uintptr_t> UnrealGameThread_Target(0x03914960 + 0x53);
+RELOC_STATIC StaticRelocAddr <uintptr_t> OblivionThread_Target(0x065FB250 + 0x1208);
+RELOC_STATIC StaticRelocAddr <uintptr_t> UnrealGameThread_Target(0x03914960 + 0x53);
 
 void OblivionThreadHook(const char * dbgStr)
 {
-
+	// once per main loop iteration
+	PluginManager::dispatchQueuedMessages();
 }
 
 void UnrealGameThreadHook()
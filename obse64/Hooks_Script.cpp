@@ -10,7 +10,7 @@
 #include "xbyak/xbyak.h"
 #include <vector>
 
-RelocAddr <ParseFunction> DefaultParseFunction(0x06972980);
+RELOC_STATIC StaticRelocAddr <ParseFunction> DefaultParseFunction(0x06972980);
 
 bool PadCommand_Execute(const ParamInfo * paramInfo,
 	const char * scriptData,
@@ -77,7 +77,7 @@ struct ParamTypeInfo
 };
 
 // may need to patch/redirect this as well
-RelocPtr <ParamTypeInfo> g_paramTypeInfo(0x08FF6670);
+RELOC_STATIC StaticRelocPtr <ParamTypeInfo> g_paramTypeInfo(0x08FF6670);
 
 class HookedCommandTable
 {
@@ -254,6 +254,8 @@ void HookedCommandTable::Apply(const PatchInfo * start, const PatchInfo * end, c
 	m_trampolineCopy = (CommandInfo *)g_branchTrampoline.allocate(tableSize);
 	ASSERT(m_trampolineCopy);
 
+	BranchTrampoline::WriteWindow window(g_branchTrampoline, m_trampolineCopy, tableSize);
+
 	std::copy(m_commands.begin(), m_commands.end(), m_trampolineCopy);
 }
 
@@ -273,7 +275,7 @@ bool IsScriptCmdParamAReference(u32 scriptCmdIdx, u32 paramTypeIdx)
 	return g_paramTypeInfo[typeID].refType;
 }
 
-RelocAddr <decltype(&IsScriptCmdParamAReference)> IsScriptCmdParamAReference_Original(0x06A70870);
+RELOC_STATIC StaticRelocAddr <decltype(&IsScriptCmdParamAReference)> IsScriptCmdParamAReference_Original(0x06A70870);
 
 void Hooks_Script_Apply()
 {
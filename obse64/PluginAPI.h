@@ -28,6 +28,9 @@ enum
 	kInterface_Invalid = 0,
 	kInterface_Messaging,
 	kInterface_Trampoline,
+	kInterface_Hooks,
+	kInterface_Task,
+	kInterface_Patch,
 	kInterface_Max,
 };
 
@@ -99,7 +102,7 @@ struct OBSEMessagingInterface
 	typedef void (* EventCallback)(Message* msg);
 
 	enum {
-		kInterfaceVersion = 1
+		kInterfaceVersion = 5
 	};
 
 	// OBSE messages
@@ -111,19 +114,193 @@ struct OBSEMessagingInterface
 	std::uint32_t interfaceVersion;
 	bool	(* RegisterListener)(PluginHandle listener, const char* sender, EventCallback handler);
 	bool	(* Dispatch)(PluginHandle sender, std::uint32_t messageType, void * data, std::uint32_t dataLen, const char* receiver);
+
+	// version 2
+	// resolve a plugin name once (case-insensitive, "OBSE" is 0) and send to the handle after that
+	// returns kPluginHandle_Invalid if no plugin with that name is loaded
+	PluginHandle	(* LookupHandle)(const char * name);
+	bool	(* DispatchToHandle)(PluginHandle sender, std::uint32_t messageType, void * data, std::uint32_t dataLen, PluginHandle receiver);
+
+	// version 3
+	// like RegisterListener, but handler is only called for the numTypes message types listed in types
+	// registering again adds types. a listener already registered for every type from sender is unaffected
+	bool	(* RegisterListenerForTypes)(PluginHandle listener, const char* sender, const std::uint32_t * types, std::uint32_t numTypes, EventCallback handler);
+
+	// version 4
+	// returns immediately, can be called from any thread. data is copied, listeners are called later on the game thread
+	// once per frame, in the order messages were sent. msg->data is only valid during the callback
+	// receiver is kPluginHandle_Invalid to send to every listener
+	bool	(* DispatchAsync)(PluginHandle sender, std::uint32_t messageType, const void * data, std::uint32_t dataLen, PluginHandle receiver);
+
+	// version 5
+	// refcounted payload buffers from a shared pool. AllocatePayload returns a buffer with a count of 1, fill it in
+	// and pass it as the data of any Dispatch call. receivers that need it after their callback can RetainPayload it
+	// instead of copying, but only for message types that are documented to carry one. everyone releases what they
+	// allocated or retained, the buffer goes back to the pool when the last reference is released
+	void *	(* AllocatePayload)(std::uint32_t size);
+	void	(* RetainPayload)(void * payload);
+	void	(* ReleasePayload)(void * payload);
+
+	// DispatchAsync without the copy. the queue holds its own reference until delivery, so the sender can release right away
+	bool	(* DispatchPayloadAsync)(PluginHandle sender, std::uint32_t messageType, void * payload, PluginHandle receiver);
 };
 
 struct OBSETrampolineInterface
 {
 	enum
 	{
-		kInterfaceVersion = 1
+		kInterfaceVersion = 4
+	};
+
+	enum
+	{
+		kPool_Branch = 0,
+		kPool_Local,
+	};
+
+	struct PoolStats
+	{
+		std::uint64_t	reserved;		// total size of all regions
+		std::uint64_t	used;			// handed out and not released
+		std::uint64_t	free;			// released and waiting to be reused
+		std::uint64_t	freeBlocks;
+		std::uint64_t	remain;			// never handed out
+		std::uint64_t	pluginUsed;		// handed out to the calling plugin and not released
+		std::uint32_t	numRegions;
+
+		std::uint64_t	sharedBranches;	// OBSE branches that reused an existing slot or stub with the same target
+		std::uint64_t	sharedSaved;	// bytes saved by that
 	};
 
 	std::uint32_t interfaceVersion;
 
+	// memory is reachable with a rel32 displacement from the game executable (branch pool) or your plugin (local pool)
 	void * (* AllocateFromBranchPool)(PluginHandle plugin, size_t size);
 	void * (* AllocateFromLocalPool)(PluginHandle plugin, size_t size);
+
+	// version 2
+	// memory is reachable with a rel32 displacement from target. use this when hooking code outside of the game executable
+	void * (* AllocateFromBranchPoolNear)(PluginHandle plugin, size_t size, const void * target);
+
+	// version 3
+	// size must match the allocation. make sure nothing still branches to the memory before releasing it
+	void	(* ReleaseToBranchPool)(PluginHandle plugin, void * ptr, size_t size);
+	void	(* ReleaseToLocalPool)(PluginHandle plugin, void * ptr, size_t size);
+
+	// releases everything the plugin allocated from both pools
+	void	(* ReleaseAll)(PluginHandle plugin);
+
+	// pool is kPool_Branch or kPool_Local
+	bool	(* GetPoolStats)(PluginHandle plugin, std::uint32_t pool, PoolStats * out);
+
+	// version 4
+	// with WriteProtect=1 in the [Trampoline] section of obse64.ini, pool memory is read/execute only
+	// wrap writes to memory you allocated in BeginWrite/EndWrite. they nest, and do nothing when protection is off
+	bool	(* IsWriteProtected)(std::uint32_t pool);
+	void	(* BeginWrite)(std::uint32_t pool, const void * ptr, size_t size);
+	void	(* EndWrite)(std::uint32_t pool, const void * ptr, size_t size);
+};
+
+// function detours that chain with other plugins instead of overwriting them
+// your handler replaces the function. call *original from it to run the next handler and eventually the game code
+struct OBSEHooksInterface
+{
+	enum
+	{
+		kInterfaceVersion = 2
+	};
+
+	std::uint32_t interfaceVersion;
+
+	// higher priority handlers are called first, ties are called in the order they were attached
+	// returns false if the code at target can't be moved, nothing is patched in that case
+	bool	(* Attach)(PluginHandle plugin, void * target, void * handler, std::int32_t priority, void ** original);
+	bool	(* Detach)(PluginHandle plugin, void * target, void * handler);
+
+	// number of times target has been called since it was first hooked
+	// only counted with CountCalls=1 in the [Detours] section of obse64.ini, otherwise always 0
+	std::uint64_t	(* GetCallCount)(void * target);
+
+	// version 2
+	// wraps target with generated code instead of a handwritten handler
+	// pre has the same arguments as target and returns void. post is called with target's return value and returns
+	// the value the caller sees (ret post(ret)). either can be null, leaving out post avoids the extra stack frame
+	// floatArgs has bit n set if argument n (0-3) is a float or double, floatReturn if target returns one
+	// returns the thunk to pass to Detach as the handler, or null on failure
+	void *	(* AttachThunk)(PluginHandle plugin, void * target, std::uint32_t numArgs, std::uint32_t floatArgs, bool floatReturn,
+		void * pre, void * post, std::int32_t priority);
+};
+
+// one thread pool shared by every plugin, use this instead of starting your own threads
+// it has one worker per physical core minus one, since threads waiting on tasks run them too, and at least one
+// worker. NumThreads in the [Tasks] section of obse64.ini overrides that
+// workers steal from each other, so a thread that runs out of work picks up what's queued elsewhere
+struct OBSETaskInterface
+{
+	enum
+	{
+		kInterfaceVersion = 1
+	};
+
+	typedef void * TaskHandle;	// opaque
+	typedef void (* TaskFn)(void * ctx);
+	typedef void (* RangeFn)(void * ctx, std::uint64_t begin, std::uint64_t end);
+
+	std::uint32_t interfaceVersion;
+
+	std::uint32_t	(* GetNumWorkers)(void);
+
+	// every handle returned here has to be released, releasing doesn't cancel the task
+	TaskHandle	(* Submit)(TaskFn fn, void * ctx);
+	// runs fn once predecessor has finished
+	TaskHandle	(* Then)(TaskHandle predecessor, TaskFn fn, void * ctx);
+	// runs fn once all numPredecessors tasks have finished
+	TaskHandle	(* WhenAll)(const TaskHandle * predecessors, std::uint32_t numPredecessors, TaskFn fn, void * ctx);
+
+	// the calling thread runs queued tasks while it waits, so this is safe to call from inside a task
+	void	(* Wait)(TaskHandle task);
+	bool	(* IsDone)(TaskHandle task);
+	void	(* Release)(TaskHandle task);
+
+	// calls fn on [begin, end) split in to chunks of about grain items (0 picks a size) and waits for all of them
+	void	(* ParallelFor)(std::uint64_t begin, std::uint64_t end, std::uint64_t grain, RangeFn fn, void * ctx);
+};
+
+// code patching through OBSE, so plugin patches are batched with OBSE's and show up in its patch map
+// plugins using obse64_common's SafeWrite can pass these to redirectSafeWrite instead of calling them directly
+struct OBSEPatchInterface
+{
+	enum
+	{
+		kInterfaceVersion = 2
+	};
+
+	struct PatchInfo
+	{
+		std::uintptr_t	start;
+		size_t			len;
+		PluginHandle	owner;	// 0 is OBSE
+	};
+
+	std::uint32_t interfaceVersion;
+
+	// while a transaction is open on the calling thread, the write joins it and nothing is written until commit
+	void	(* Write)(PluginHandle plugin, std::uintptr_t addr, const void * data, size_t len);
+
+	// transactions are per thread and nest. commit changes page protection once per page for every write in the
+	// transaction and flushes the instruction cache once. don't read back patched code before committing
+	void	(* BeginTransaction)(void);
+	void	(* CommitTransaction)(void);
+	void	(* CancelTransaction)(void);
+
+	// version 2
+	// adds a patch you make some other way to the patch map, so overlaps with other plugins are reported
+	// call it right before writing, the original bytes are read from addr
+	void	(* Record)(PluginHandle plugin, std::uintptr_t addr, const void * data, size_t len);
+
+	// patches overlapping [addr, addr + len) in address order. writes in a transaction show up once it commits
+	// fills in up to maxPatches and returns how many there are
+	size_t	(* QueryPatches)(std::uintptr_t addr, size_t len, PatchInfo * out, size_t maxPatches);
 };
 
 typedef bool (* _OBSEPlugin_Load)(const OBSEInterface * obse);
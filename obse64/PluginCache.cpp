@@ -0,0 +1,293 @@
+#include "PluginCache.h"
+#include "obse64_common/FileStream.h"
+#include "obse64_common/Utilities.h"
+#include "obse64_common/Log.h"
+#include <cstring>
+#include <vector>
+
+PluginCache g_pluginCache;
+
+// length prefixed strings and fixed size fields, strings are never longer than the version data fields
+class CacheWriter
+{
+public:
+	CacheWriter(std::vector <u8> & out) :m_out(out) { }
+
+	void	data(const void * src, size_t len) { m_out.insert(m_out.end(), (const u8 *)src, (const u8 *)src + len); }
+	void	w8(u8 v) { data(&v, sizeof(v)); }
+	void	w16(u16 v) { data(&v, sizeof(v)); }
+	void	w32(u32 v) { data(&v, sizeof(v)); }
+	void	w64(u64 v) { data(&v, sizeof(v)); }
+
+	void	wstr(const char * src, size_t len) { w16(u16(len)); data(src, len); }
+
+private:
+	std::vector <u8>	& m_out;
+};
+
+class CacheReader
+{
+public:
+	CacheReader(const u8 * data, size_t len) :m_cur(data), m_end(data + len), m_ok(true) { }
+
+	bool	ok() const { return m_ok; }
+	bool	done() const { return m_cur == m_end; }
+
+	void	data(void * dst, size_t len)
+	{
+		if(!m_ok || (size_t(m_end - m_cur) < len))
+		{
+			m_ok = false;
+			memset(dst, 0, len);
+			return;
+		}
+
+		memcpy(dst, m_cur, len);
+		m_cur += len;
+	}
+
+	u8		r8() { u8 v; data(&v, sizeof(v)); return v; }
+	u16		r16() { u16 v; data(&v, sizeof(v)); return v; }
+	u32		r32() { u32 v; data(&v, sizeof(v)); return v; }
+	u64		r64() { u64 v; data(&v, sizeof(v)); return v; }
+
+	// dst is always null terminated
+	void	rstr(char * dst, size_t dstLen)
+	{
+		u16 len = r16();
+		if(len >= dstLen)
+		{
+			m_ok = false;
+			len = 0;
+		}
+
+		data(dst, len);
+		dst[len] = 0;
+	}
+
+	void	rstr(std::string * dst)
+	{
+		u16 len = r16();
+		if(!m_ok || (size_t(m_end - m_cur) < len))
+		{
+			m_ok = false;
+			return;
+		}
+
+		dst->assign((const char *)m_cur, len);
+		m_cur += len;
+	}
+
+private:
+	const u8	* m_cur;
+	const u8	* m_end;
+	bool		m_ok;
+};
+
+enum
+{
+	kEntryFlag_HasLoad =	1 << 0,
+	kEntryFlag_HasPreload =	1 << 1,
+};
+
+PluginCache::PluginCache()
+	:m_environment(0)
+	, m_dirty(false)
+{
+	//
+}
+
+void PluginCache::open(const char * path, u64 environment)
+{
+	m_path = path;
+	m_environment = environment;
+	m_previous.clear();
+	m_current.clear();
+
+	// anything not read back successfully means the file needs to be rewritten
+	m_dirty = true;
+
+	FileStream src;
+	if(!src.open(path))
+		return;
+
+	std::vector <u8> data(src.length());
+	if((data.size() < sizeof(Header)) || (src.read(data.data(), data.size()) != data.size()))
+		return;
+
+	auto * header = (const Header *)data.data();
+	const u8 * body = data.data() + sizeof(Header);
+
+	if((header->signature != kSignature) || (header->version != kVersion) ||
+		(data.size() != sizeof(Header) + u64(header->dataLen)) ||
+		(hashMemory(body, header->dataLen) != header->checksum))
+	{
+		_MESSAGE("PluginCache: ignoring invalid cache file");
+		return;
+	}
+
+	if(header->environment != m_environment)
+	{
+		_MESSAGE("PluginCache: game, OBSE or address library changed, rescanning all plugins");
+		return;
+	}
+
+	if(!parse(body, header->dataLen, header->numEntries))
+	{
+		_MESSAGE("PluginCache: ignoring damaged cache file");
+		m_previous.clear();
+		return;
+	}
+
+	m_dirty = false;
+
+	_MESSAGE("PluginCache: loaded %d entries", header->numEntries);
+}
+
+bool PluginCache::parse(const u8 * data, size_t len, u32 numEntries)
+{
+	CacheReader src(data, len);
+
+	for(u32 i = 0; (i < numEntries) && src.ok(); i++)
+	{
+		std::string dllPath;
+		Entry entry;
+
+		memset(&entry.version, 0, sizeof(entry.version));
+
+		src.rstr(&dllPath);
+
+		entry.fileSize = src.r64();
+		entry.writeTime = src.r64();
+		entry.status = src.r8();
+
+		u8 flags = src.r8();
+		entry.hasLoad = (flags & kEntryFlag_HasLoad) != 0;
+		entry.hasPreload = (flags & kEntryFlag_HasPreload) != 0;
+
+		src.rstr(&entry.verdict);
+
+		auto & version = entry.version;
+
+		version.dataVersion = src.r32();
+		version.pluginVersion = src.r32();
+		src.rstr(version.name, sizeof(version.name));
+		src.rstr(version.author, sizeof(version.author));
+		version.addressIndependence = src.r32();
+		version.structureIndependence = src.r32();
+
+		u8 numCompatibleVersions = src.r8();
+		if(numCompatibleVersions > _countof(version.compatibleVersions))
+			return false;
+
+		for(u32 j = 0; j < numCompatibleVersions; j++)
+			version.compatibleVersions[j] = src.r32();
+
+		version.seVersionRequired = src.r32();
+		version.reservedNonBreaking = src.r32();
+		version.reservedBreaking = src.r32();
+
+		if(src.ok())
+			m_previous[dllPath] = entry;
+	}
+
+	return src.ok() && src.done();
+}
+
+void PluginCache::save()
+{
+	if(!m_dirty && m_previous.empty())
+		return;
+
+	std::vector <u8> body;
+	CacheWriter dst(body);
+
+	for(auto & iter : m_current)
+	{
+		auto & entry = iter.second;
+		auto & version = entry.version;
+
+		dst.wstr(iter.first.c_str(), iter.first.size());
+
+		dst.w64(entry.fileSize);
+		dst.w64(entry.writeTime);
+		dst.w8(u8(entry.status));
+		dst.w8((entry.hasLoad ? kEntryFlag_HasLoad : 0) | (entry.hasPreload ? kEntryFlag_HasPreload : 0));
+
+		dst.wstr(entry.verdict.c_str(), entry.verdict.size());
+
+		dst.w32(version.dataVersion);
+		dst.w32(version.pluginVersion);
+		dst.wstr(version.name, strlen(version.name));
+		dst.wstr(version.author, strlen(version.author));
+		dst.w32(version.addressIndependence);
+		dst.w32(version.structureIndependence);
+
+		u8 numCompatibleVersions = 0;
+		while((numCompatibleVersions < _countof(version.compatibleVersions)) && version.compatibleVersions[numCompatibleVersions])
+			numCompatibleVersions++;
+
+		dst.w8(numCompatibleVersions);
+
+		for(u32 j = 0; j < numCompatibleVersions; j++)
+			dst.w32(version.compatibleVersions[j]);
+
+		dst.w32(version.seVersionRequired);
+		dst.w32(version.reservedNonBreaking);
+		dst.w32(version.reservedBreaking);
+	}
+
+	Header header;
+
+	header.signature = kSignature;
+	header.version = kVersion;
+	header.environment = m_environment;
+	header.numEntries = u32(m_current.size());
+	header.dataLen = u32(body.size());
+	header.checksum = hashMemory(body.data(), body.size());
+
+	FileStream file;
+	if(!file.create(m_path.c_str()))
+	{
+		_WARNING("PluginCache: couldn't write %s", m_path.c_str());
+		return;
+	}
+
+	file.write(&header, sizeof(header));
+	file.write(body.data(), body.size());
+
+	// entries for plugins that have been removed are gone now
+	m_previous.clear();
+	m_dirty = false;
+}
+
+const PluginCache::Entry * PluginCache::find(const std::string & dllPath, u64 fileSize, u64 writeTime)
+{
+	auto iter = m_previous.find(dllPath);
+	if(iter == m_previous.end())
+		return nullptr;
+
+	Entry entry = iter->second;
+	m_previous.erase(iter);
+
+	if((entry.fileSize != fileSize) || (entry.writeTime != writeTime))
+	{
+		m_dirty = true;
+		return nullptr;
+	}
+
+	auto & result = m_current[dllPath];
+	result = entry;
+
+	return &result;
+}
+
+const PluginCache::Entry * PluginCache::insert(const std::string & dllPath, const Entry & entry)
+{
+	m_dirty = true;
+
+	auto & result = m_current[dllPath];
+	result = entry;
+
+	return &result;
+}
@@ -0,0 +1,69 @@
+#pragma once
+
+#include "obse64/PluginAPI.h"
+#include "obse64_common/Types.h"
+#include <string>
+#include <unordered_map>
+
+// what scanning each plugin dll found last time, keyed by path, size and last write time
+// lets an unchanged install skip opening every dll and re-checking compatibility. the header holds everything
+// else the compatibility verdict depends on, so updating the game or OBSE or the address library drops the file
+class PluginCache
+{
+public:
+	struct Entry
+	{
+		u64		fileSize;
+		u64		writeTime;	// FILETIME
+
+		u32		status;		// PluginScanResult status
+		bool	hasLoad;
+		bool	hasPreload;
+
+		OBSEPluginVersionData	version;	// reserved fields aren't stored
+
+		std::string	verdict;	// empty if compatible
+	};
+
+	PluginCache();
+
+	// environment identifies everything outside of the dll that can change the verdict
+	void	open(const char * path, u64 environment);
+	void	save();
+
+	// nullptr if the file changed or isn't cached
+	const Entry *	find(const std::string & dllPath, u64 fileSize, u64 writeTime);
+	const Entry *	insert(const std::string & dllPath, const Entry & entry);
+
+private:
+	enum
+	{
+		kSignature =	'CPBO',	// OBPC
+		kVersion =		1,
+	};
+
+#pragma pack(push, 4)
+	struct Header
+	{
+		u32	signature;
+		u32	version;
+		u64	environment;
+		u32	numEntries;
+		u32	dataLen;	// bytes after the header
+		u64	checksum;	// hashMemory of those bytes
+	};
+#pragma pack(pop)
+
+	bool	parse(const u8 * data, size_t len, u32 numEntries);
+
+	std::string	m_path;
+	u64			m_environment;
+	bool		m_dirty;
+
+	// entries read from the file, moved to m_current when they're used
+	std::unordered_map <std::string, Entry>	m_previous;
+	// everything seen this run, this is what gets saved. nodes don't move, so verdict strings stay valid
+	std::unordered_map <std::string, Entry>	m_current;
+};
+
+extern PluginCache g_pluginCache;
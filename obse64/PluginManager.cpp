@@ -1,11 +1,22 @@
 #include "PluginManager.h"
+#include "DetourManager.h"
+#include "PluginCache.h"
+#include "PluginMessageQueue.h"
 #include "obse64_common/DirectoryIterator.h"
 #include "obse64_common/FileStream.h"
 #include "obse64_common/Utilities.h"
 #include "obse64_common/obse64_version.h"
 #include "obse64_common/BranchTrampoline.h"
+#include "obse64_common/PatchRegistry.h"
+#include "obse64_common/PayloadPool.h"
+#include "obse64_common/SafeWrite.h"
+#include "obse64_common/TaskPool.h"
 #include "obse64_common/Log.h"
 #include "obse64_common/Errors.h"
+#include <algorithm>
+#include <cctype>
+#include <thread>
+#include <ShlObj.h>
 
 PluginManager	g_pluginManager;
 
@@ -13,6 +24,29 @@ PluginManager::LoadedPlugin *	PluginManager::s_currentLoadingPlugin = nullptr;
 PluginHandle					PluginManager::s_currentPluginHandle = 0;
 u32								s_trampolineLog = 1;
 
+static u64 GetTicks()
+{
+	LARGE_INTEGER counter;
+	QueryPerformanceCounter(&counter);
+
+	return counter.QuadPart;
+}
+
+static double TicksToMS(u64 ticks)
+{
+	static double s_msPerTick = 0;
+
+	if(!s_msPerTick)
+	{
+		LARGE_INTEGER freq;
+		QueryPerformanceFrequency(&freq);
+
+		s_msPerTick = 1000.0 / freq.QuadPart;
+	}
+
+	return ticks * s_msPerTick;
+}
+
 BranchTrampolineManager g_branchTrampolineManager(g_branchTrampoline);
 BranchTrampolineManager g_localTrampolineManager(g_localTrampoline);
 
@@ -35,14 +69,213 @@ static const OBSETrampolineInterface g_OBSETrampolineInterface =
 {
 	OBSETrampolineInterface::kInterfaceVersion,
 	AllocateFromOBSEBranchPool,
-	AllocateFromOBSELocalPool
+	AllocateFromOBSELocalPool,
+	AllocateFromOBSEBranchPoolNear,
+	ReleaseToOBSEBranchPool,
+	ReleaseToOBSELocalPool,
+	ReleaseAllFromOBSEPools,
+	GetOBSEPoolStats,
+	IsOBSEPoolWriteProtected,
+	BeginOBSEPoolWrite,
+	EndOBSEPoolWrite
 };
 
+static const OBSEHooksInterface g_OBSEHooksInterface =
+{
+	OBSEHooksInterface::kInterfaceVersion,
+	AttachOBSEDetour,
+	DetachOBSEDetour,
+	GetOBSEDetourCallCount,
+	AttachOBSEHookThunk
+};
+
+static void * AllocatePayload(u32 size)
+{
+	return g_payloadPool.allocate(size);
+}
+
+static void RetainPayload(void * payload)
+{
+	g_payloadPool.retain(payload);
+}
+
+static void ReleasePayload(void * payload)
+{
+	g_payloadPool.release(payload);
+}
+
 static OBSEMessagingInterface g_OBSEMessagingInterface =
 {
 	OBSEMessagingInterface::kInterfaceVersion,
 	PluginManager::registerListener,
 	PluginManager::dispatchMessage,
+	PluginManager::lookupHandle,
+	PluginManager::dispatchMessageToHandle,
+	PluginManager::registerListenerForTypes,
+	PluginManager::dispatchMessageAsync,
+	AllocatePayload,
+	RetainPayload,
+	ReleasePayload,
+	PluginManager::dispatchPayloadAsync,
+};
+
+// started the first time a plugin asks for it. never destroyed, joining threads while the process exits can deadlock
+static TaskPool * GetTaskPool()
+{
+	static TaskPool * s_pool = nullptr;
+	static std::once_flag s_once;
+
+	std::call_once(s_once, []()
+	{
+		// threads that wait on tasks or call parallelFor run tasks too, so one core is left for them. at least one
+		// worker, or tasks nobody waits on would never run
+		u32 numCores = getPhysicalCoreCount();
+		u32 numThreads = (numCores > 1) ? (numCores - 1) : 1;
+
+		getConfigOption_u32("Tasks", "NumThreads", &numThreads);
+		if(!numThreads)
+			numThreads = 1;
+
+		_MESSAGE("starting task pool with %d threads", numThreads);
+
+		s_pool = new TaskPool(numThreads);
+	});
+
+	return s_pool;
+}
+
+static u32 GetTaskWorkerCount()
+{
+	return GetTaskPool()->numWorkers();
+}
+
+static OBSETaskInterface::TaskHandle SubmitTask(OBSETaskInterface::TaskFn fn, void * ctx)
+{
+	return GetTaskPool()->submit(fn, ctx);
+}
+
+static OBSETaskInterface::TaskHandle ThenTask(OBSETaskInterface::TaskHandle predecessor, OBSETaskInterface::TaskFn fn, void * ctx)
+{
+	return GetTaskPool()->then((TaskPool::Task *)predecessor, fn, ctx);
+}
+
+static OBSETaskInterface::TaskHandle WhenAllTasks(const OBSETaskInterface::TaskHandle * predecessors, u32 numPredecessors, OBSETaskInterface::TaskFn fn, void * ctx)
+{
+	return GetTaskPool()->whenAll((TaskPool::Task * const *)predecessors, numPredecessors, fn, ctx);
+}
+
+static void WaitTask(OBSETaskInterface::TaskHandle task)
+{
+	GetTaskPool()->wait((TaskPool::Task *)task);
+}
+
+static bool IsTaskDone(OBSETaskInterface::TaskHandle task)
+{
+	return GetTaskPool()->isDone((TaskPool::Task *)task);
+}
+
+static void ReleaseTask(OBSETaskInterface::TaskHandle task)
+{
+	GetTaskPool()->release((TaskPool::Task *)task);
+}
+
+static void ParallelForTask(u64 begin, u64 end, u64 grain, OBSETaskInterface::RangeFn fn, void * ctx)
+{
+	GetTaskPool()->parallelFor(begin, end, grain, fn, ctx);
+}
+
+static OBSETaskInterface g_OBSETaskInterface =
+{
+	OBSETaskInterface::kInterfaceVersion,
+	GetTaskWorkerCount,
+	SubmitTask,
+	ThenTask,
+	WhenAllTasks,
+	WaitTask,
+	IsTaskDone,
+	ReleaseTask,
+	ParallelForTask,
+};
+
+static void WritePatch(PluginHandle plugin, std::uintptr_t addr, const void * data, size_t len)
+{
+	PatchRegistry::OwnerScope patchOwner(plugin);
+
+	safeWriteBuf(addr, const_cast <void *>(data), len);
+}
+
+// transactions plugins opened through the interface, innermost last
+static thread_local std::vector <PatchTransaction *> s_pluginTransactions;
+
+static void BeginPatchTransaction()
+{
+	s_pluginTransactions.push_back(new PatchTransaction);
+}
+
+static PatchTransaction * PopPatchTransaction()
+{
+	// a scoped transaction of ours opened inside the plugin's would be innermost, it has to end first
+	if(s_pluginTransactions.empty() || (s_pluginTransactions.back() != PatchTransaction::active()))
+	{
+		_ERROR("patch transaction commit/cancel without a matching begin");
+		return nullptr;
+	}
+
+	PatchTransaction * result = s_pluginTransactions.back();
+	s_pluginTransactions.pop_back();
+
+	return result;
+}
+
+static void CommitPatchTransaction()
+{
+	PatchTransaction * transaction = PopPatchTransaction();
+	if(transaction)
+	{
+		transaction->commit();
+		delete transaction;
+	}
+}
+
+static void CancelPatchTransaction()
+{
+	PatchTransaction * transaction = PopPatchTransaction();
+	if(transaction)
+	{
+		transaction->cancel();
+		delete transaction;
+	}
+}
+
+static void RecordPatch(PluginHandle plugin, std::uintptr_t addr, const void * data, size_t len)
+{
+	g_patchRegistry.record(addr, data, len, plugin, "reported");
+}
+
+static size_t QueryPatches(std::uintptr_t addr, size_t len, OBSEPatchInterface::PatchInfo * out, size_t maxPatches)
+{
+	std::vector <PatchRegistry::PatchInfo> patches;
+	g_patchRegistry.findPatches(addr, len, &patches);
+
+	for(size_t i = 0; (i < patches.size()) && (i < maxPatches); i++)
+	{
+		out[i].start = patches[i].start;
+		out[i].len = patches[i].len;
+		out[i].owner = patches[i].owner;
+	}
+
+	return patches.size();
+}
+
+static const OBSEPatchInterface g_OBSEPatchInterface =
+{
+	OBSEPatchInterface::kInterfaceVersion,
+	WritePatch,
+	BeginPatchTransaction,
+	CommitPatchTransaction,
+	CancelPatchTransaction,
+	RecordPatch,
+	QueryPatches,
 };
 
 PluginManager::PluginManager()
@@ -68,7 +301,7 @@ void PluginManager::init()
 		_MESSAGE("plugin directory = %s", m_pluginDirectory.c_str());
 
 		// avoid realloc
-		m_plugins.reserve(5);
+		m_slots.reserve(6);
 
 		__try
 		{
@@ -84,9 +317,12 @@ void PluginManager::init()
 
 void PluginManager::installPlugins(u32 phase)
 {
-	for(size_t i = 0; i < m_plugins.size(); i++)
+	for(size_t i = 1; i < m_slots.size(); i++)
 	{
-		auto & plugin = m_plugins[i];
+		if(!m_slots[i].live)
+			continue;
+
+		auto & plugin = m_slots[i].plugin;
 
 		// skip plugins that don't care about this phase
 		if(phase == kPhase_Preload)
@@ -109,7 +345,12 @@ void PluginManager::installPlugins(u32 phase)
 
 		if(!plugin.handle)
 		{
+			u64 loadLibraryStart = GetTicks();
+
 			plugin.handle = (HMODULE)LoadLibrary(pluginPath.c_str());
+
+			m_profiles[plugin.profileIdx].loadLibraryTicks = GetTicks() - loadLibraryStart;
+
 			if(!plugin.handle)
 				logPluginLoadError(plugin, "couldn't load plugin", GetLastError());
 		}
@@ -123,6 +364,8 @@ void PluginManager::installPlugins(u32 phase)
 			{
 				const char * loadStatus = nullptr;
 
+				PatchRegistry::OwnerScope patchOwner(plugin.internalHandle);
+
 				loadStatus = safeCallLoadPlugin(&plugin, &g_OBSEInterface, phase);
 
 				if(!loadStatus)
@@ -145,11 +388,8 @@ void PluginManager::installPlugins(u32 phase)
 			// failed, unload the library
 			if(plugin.handle) FreeLibrary(plugin.handle);
 
-			// and remove from plugins list
-			m_plugins.erase(m_plugins.begin() + i);
-
-			// fix iterator
-			i--;
+			// and remove from plugins list, nothing else moves
+			removePlugin(plugin.internalHandle);
 		}
 
 	}
@@ -160,9 +400,12 @@ void PluginManager::installPlugins(u32 phase)
 
 void PluginManager::loadComplete()
 {
-	for(size_t i = 0; i < m_plugins.size(); i++)
+	for(auto & slot : m_slots)
 	{
-		auto & plugin = m_plugins[i];
+		if(!slot.live)
+			continue;
+
+		auto & plugin = slot.plugin;
 
 		_MESSAGE("plugin %s (%08X %s %08X) %s (handle %d)",
 			plugin.dllName.c_str(),
@@ -174,10 +417,16 @@ void PluginManager::loadComplete()
 	}
 
 	reportPluginErrors();
+	reportStartupProfile();
 
-	// make fake PluginInfo structs after m_plugins is locked
-	for(auto & plugin : m_plugins)
+	// make fake PluginInfo structs after the plugin list is locked
+	for(auto & slot : m_slots)
 	{
+		if(!slot.live)
+			continue;
+
+		auto & plugin = slot.plugin;
+
 		plugin.info.infoVersion = PluginInfo::kInfoVersion;
 		plugin.info.name = plugin.version.name;
 		plugin.info.version = plugin.version.pluginVersion;
@@ -191,35 +440,146 @@ void PluginManager::loadComplete()
 
 void PluginManager::deinit()
 {
-	for(LoadedPluginList::iterator iter = m_plugins.begin(); iter != m_plugins.end(); ++iter)
+	for(auto & slot : m_slots)
 	{
-		LoadedPlugin	* plugin = &(*iter);
+		LoadedPlugin	* plugin = &slot.plugin;
 
-		if(plugin->handle)
+		if(slot.live && plugin->handle)
 		{
 			FreeLibrary(plugin->handle);
 		}
 	}
 
-	m_plugins.clear();
+	m_slots.clear();
+	m_freeSlots.clear();
+	m_numPlugins = 0;
+	m_nameIndex.clear();
 }
 
-const PluginInfo * PluginManager::infoByName(const char * name) const
+PluginHandle PluginManager::addPlugin(const LoadedPlugin & plugin)
+{
+	if(m_slots.empty())
+		m_slots.resize(1);
+
+	u32 index;
+
+	if(!m_freeSlots.empty())
+	{
+		index = m_freeSlots.back();
+		m_freeSlots.pop_back();
+	}
+	else
+	{
+		index = u32(m_slots.size());
+
+		// the last index with the last generation would be kPluginHandle_Invalid
+		ASSERT(index < kHandle_IndexMask);
+
+		m_slots.emplace_back();
+	}
+
+	auto & slot = m_slots[index];
+
+	slot.plugin = plugin;
+	slot.plugin.internalHandle = (slot.generation << kHandle_IndexBits) | index;
+	slot.live = true;
+
+	m_numPlugins++;
+
+	return slot.plugin.internalHandle;
+}
+
+void PluginManager::removePlugin(PluginHandle handle)
+{
+	if(!lookupPlugin(handle))
+		return;
+
+	u32 index = handleIndex(handle);
+	auto & slot = m_slots[index];
+
+	slot.plugin = LoadedPlugin();
+	slot.generation = (slot.generation + 1) & kHandle_GenerationMask;
+	slot.live = false;
+
+	m_freeSlots.push_back(index);
+	m_numPlugins--;
+
+	buildNameIndex();
+}
+
+PluginManager::LoadedPlugin * PluginManager::lookupPlugin(PluginHandle handle)
+{
+	u32 index = handleIndex(handle);
+
+	if(!index || (index >= m_slots.size()))
+		return nullptr;
+
+	auto & slot = m_slots[index];
+	if(!slot.live || (slot.generation != (handle >> kHandle_IndexBits)))
+		return nullptr;
+
+	return &slot.plugin;
+}
+
+const PluginManager::LoadedPlugin * PluginManager::lookupPlugin(PluginHandle handle) const
+{
+	return const_cast <PluginManager *>(this)->lookupPlugin(handle);
+}
+
+static u64 HashPluginName(const char * name)
+{
+	char folded[sizeof(OBSEPluginVersionData::name)];
+
+	// longer names can't match a plugin, the comparison after the hash catches them
+	size_t len = 0;
+	for(; name[len] && (len < sizeof(folded)); len++)
+		folded[len] = tolower(u8(name[len]));
+
+	return hashMemory(folded, len);
+}
+
+void PluginManager::buildNameIndex()
 {
-	for(LoadedPluginList::const_iterator iter = m_plugins.begin(); iter != m_plugins.end(); ++iter)
+	// at most half full
+	size_t size = 8;
+	while(size < (m_numPlugins * 2))
+		size <<= 1;
+
+	NameIndexEntry empty = { 0, kPluginHandle_Invalid };
+
+	m_nameIndex.assign(size, empty);
+
+	// slot order, so the first of several plugins with the same name comes first in its probe sequence
+	for(auto & slot : m_slots)
 	{
-		const LoadedPlugin * plugin = &(*iter);
+		if(!slot.live)
+			continue;
+
+		u64 hash = HashPluginName(slot.plugin.version.name);
+
+		size_t idx = hash & (size - 1);
+		while(m_nameIndex[idx].handle != kPluginHandle_Invalid)
+			idx = (idx + 1) & (size - 1);
 
-		if(plugin->info.name && !_stricmp(name, plugin->info.name))
-			return &plugin->info;
+		m_nameIndex[idx].hash = hash;
+		m_nameIndex[idx].handle = slot.plugin.internalHandle;
 	}
+}
+
+const PluginInfo * PluginManager::infoByName(const char * name) const
+{
+	auto * plugin = lookupPlugin(lookupHandleFromName(name));
+
+	// info is filled in once loading is done
+	if(plugin && plugin->info.name)
+		return &plugin->info;
 
 	return nullptr;
 }
 
 u32 PluginManager::numPlugins() const
 {
-	u32	result = (u32)m_plugins.size();
+	u32	result = m_numPlugins;
 
 	// is one currently loading?
 	if(s_currentLoadingPlugin) result++;
@@ -229,11 +589,13 @@ u32 PluginManager::numPlugins() const
 
 const char * PluginManager::pluginNameFromHandle(PluginHandle handle) const
 {
-	if(handle > 0 && handle <= m_plugins.size())
-		return (m_plugins[handle - 1].version.name);
-	else if(handle == 0)
+	if(handle == 0)
 		return "OBSE";
 
+	auto * plugin = lookupPlugin(handle);
+	if(plugin)
+		return plugin->version.name;
+
 	return nullptr;
 }
 
@@ -242,16 +604,20 @@ PluginHandle PluginManager::lookupHandleFromName(const char * pluginName) const
 	if(!_stricmp("OBSE", pluginName))
 		return 0;
 
-	u32	idx = 1;
-	for(LoadedPluginList::const_iterator iter = m_plugins.begin(); iter != m_plugins.end(); ++iter)
+	if(m_nameIndex.empty())
+		return kPluginHandle_Invalid;
+
+	u64 hash = HashPluginName(pluginName);
+	size_t mask = m_nameIndex.size() - 1;
+
+	for(size_t idx = hash & mask; m_nameIndex[idx].handle != kPluginHandle_Invalid; idx = (idx + 1) & mask)
 	{
-		const LoadedPlugin * plugin = &(*iter);
-		if(!_stricmp(plugin->version.name, pluginName))
-		{
-			return idx;
-		}
-		idx++;
+		auto & entry = m_nameIndex[idx];
+
+		if((entry.hash == hash) && !_stricmp(lookupPlugin(entry.handle)->version.name, pluginName))
+			return entry.handle;
 	}
+
 	return kPluginHandle_Invalid;
 }
 
@@ -267,6 +633,16 @@ void * PluginManager::queryInterface(u32 id)
 	case kInterface_Trampoline:
 		result = (void *)&g_OBSETrampolineInterface;
 		break;
+	case kInterface_Hooks:
+		result = (void *)&g_OBSEHooksInterface;
+		break;
+	case kInterface_Task:
+		GetTaskPool();
+		result = (void *)&g_OBSETaskInterface;
+		break;
+	case kInterface_Patch:
+		result = (void *)&g_OBSEPatchInterface;
+		break;
 
 	default:
 		_WARNING("unknown QueryInterface %08X", id);
@@ -314,120 +690,342 @@ bool PluginManager::findPluginDirectory(void)
 	return result;
 }
 
-void PluginManager::scanPlugins(void)
+// what one dll looked like, filled in on a worker thread
+struct PluginScanResult
 {
-	_MESSAGE("scanning plugin directory %s", m_pluginDirectory.c_str());
+	enum
+	{
+		kStatus_OK = 0,
+		kStatus_CantOpen,
+		kStatus_Not64Bit,
+		kStatus_NoVersion,
+		kStatus_Exception,
+	};
 
-	u32 handleIdx = 1;	// start at 1, 0 is reserved for internal use
+	u32		status = kStatus_CantOpen;
+	u32		errorCode = 0;
 
-	for(DirectoryIterator iter(m_pluginDirectory.c_str(), "*.dll"); !iter.done(); iter.next())
-	{
-		std::string	pluginPath = iter.fullPath();
+	OBSEPluginVersionData	version;
 
-		LoadedPlugin	plugin;
-		plugin.dllName = iter.get()->cFileName;
+	bool	hasLoad = false;
+	bool	hasPreload = false;
 
-		_MESSAGE("checking plugin %s", plugin.dllName.c_str());
+	u64		scanTicks = 0;
+};
+
+// kept separate from the caller because of __try
+static void ParsePluginFile(const void * base, u64 size, PluginScanResult * out)
+{
+	__try
+	{
+		if(!is64BitMappedFile(base, size))
+		{
+			out->status = PluginScanResult::kStatus_Not64Bit;
+			return;
+		}
 
-		HMODULE resourceHandle = (HMODULE)LoadLibraryEx(pluginPath.c_str(), nullptr, LOAD_LIBRARY_AS_IMAGE_RESOURCE);
-		if(resourceHandle)
+		auto * version = (const OBSEPluginVersionData *)getMappedFileExport(base, size, "OBSEPlugin_Version", sizeof(OBSEPluginVersionData));
+		if(!version)
 		{
-			if(is64BitDLL(resourceHandle))
-			{
-				auto * version = (const OBSEPluginVersionData *)getResourceLibraryProcAddress(resourceHandle, "OBSEPlugin_Version");
-				if(version)
-				{
-					plugin.version = *version;
-					sanitize(&plugin.version);
+			out->status = PluginScanResult::kStatus_NoVersion;
+			return;
+		}
 
-					auto * loadStatus = checkPluginCompatibility(plugin.version);
-					if(!loadStatus)
-					{
-						// compatible, add to list
+		out->version = *version;
+		out->hasLoad = getMappedFileExport(base, size, "OBSEPlugin_Load", 1) != nullptr;
+		out->hasPreload = getMappedFileExport(base, size, "OBSEPlugin_Preload", 1) != nullptr;
+		out->status = PluginScanResult::kStatus_OK;
+	}
+	__except(EXCEPTION_EXECUTE_HANDLER)
+	{
+		out->status = PluginScanResult::kStatus_Exception;
+	}
+}
 
-						plugin.internalHandle = handleIdx;
-						handleIdx++;
+// maps the file as plain data, the loader never sees it
+static void ScanPluginFile(const char * path, PluginScanResult * out)
+{
+	HANDLE file = CreateFile(path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+	if(file == INVALID_HANDLE_VALUE)
+	{
+		out->errorCode = GetLastError();
+		return;
+	}
 
-						plugin.hasLoad = getResourceLibraryProcAddress(resourceHandle, "OBSEPlugin_Load") != nullptr;
-						plugin.hasPreload = getResourceLibraryProcAddress(resourceHandle, "OBSEPlugin_Preload") != nullptr;
+	LARGE_INTEGER fileSize;
+	if(GetFileSizeEx(file, &fileSize))
+	{
+		HANDLE mapping = CreateFileMapping(file, NULL, PAGE_READONLY, 0, 0, NULL);
+		if(mapping)
+		{
+			const void * base = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+			if(base)
+			{
+				ParsePluginFile(base, fileSize.QuadPart, out);
 
-						m_plugins.push_back(plugin);
-					}
-					else
-					{
-						logPluginLoadError(plugin, loadStatus);
-					}
-				}
-				else
-				{
-					logPluginLoadError(plugin, "no version data", 0, false);
-				}
+				UnmapViewOfFile(base);
 			}
 			else
 			{
-				logPluginLoadError(plugin, "32-bit plugins can never work");
+				out->errorCode = GetLastError();
 			}
 
-			FreeLibrary(resourceHandle);
+			CloseHandle(mapping);
 		}
 		else
 		{
-			logPluginLoadError(plugin, "couldn't load plugin", GetLastError());
+			out->errorCode = GetLastError();
 		}
 	}
-}
-
-const char * PluginManager::checkAddressLibrary(void)
-{
-	static bool s_checked = false;
-	static const char * s_status = nullptr;
-
-	if(s_checked)
+	else
 	{
-		return s_status;
+		out->errorCode = GetLastError();
 	}
 
+	CloseHandle(file);
+}
+
+static void GetAddressLibraryPath(char * fileName, size_t fileNameLen)
+{
 	const char * buildType = "";
 
-	char fileName[256];
-	_snprintf_s(fileName, 256, "OBSE\\Plugins\\versionlib-%d-%d-%d-%d%s.bin",
+	_snprintf_s(fileName, fileNameLen, _TRUNCATE, "OBSE\\Plugins\\versionlib-%d-%d-%d-%d%s.bin",
 		GET_EXE_VERSION_MAJOR(RUNTIME_VERSION),
 		GET_EXE_VERSION_MINOR(RUNTIME_VERSION),
 		GET_EXE_VERSION_BUILD(RUNTIME_VERSION),
 		0, buildType);
+}
 
-	FileStream versionLib;
-	if(!versionLib.open(fileName))
+void PluginManager::scanPlugins(void)
+{
+	_MESSAGE("scanning plugin directory %s", m_pluginDirectory.c_str());
+
+	u64 scanStart = GetTicks();
+
+	// everything outside of the dlls that changes the compatibility verdict
+	u32 environment[3];
+
+	char addressLibraryPath[256];
+	GetAddressLibraryPath(addressLibraryPath, sizeof(addressLibraryPath));
+
+	environment[0] = RUNTIME_VERSION;
+	environment[1] = PACKED_OBSE_VERSION;
+	environment[2] = GetFileAttributes(addressLibraryPath) != INVALID_FILE_ATTRIBUTES;
+
+	g_pluginCache.open((getRuntimeDirectory() + "OBSE\\plugincache.bin").c_str(), hashMemory(environment, sizeof(environment)));
+
+	std::vector <std::string>				dllNames;
+	std::vector <std::string>				dllPaths;
+	std::vector <std::pair <u64, u64>>		dllFileInfo;	// size, last write time
+	std::vector <const PluginCache::Entry *>	cached;
+	std::vector <size_t>					toScan;
+
+	for(DirectoryIterator iter(m_pluginDirectory.c_str(), "*.dll"); !iter.done(); iter.next())
 	{
-		m_oldAddressLibrary = true;
-		s_status = "disabled, address library needs to be updated";
+		auto * findData = iter.get();
+
+		u64 fileSize = (u64(findData->nFileSizeHigh) << 32) | findData->nFileSizeLow;
+		u64 writeTime = (u64(findData->ftLastWriteTime.dwHighDateTime) << 32) | findData->ftLastWriteTime.dwLowDateTime;
+
+		dllNames.push_back(findData->cFileName);
+		dllPaths.push_back(iter.fullPath());
+		dllFileInfo.push_back(std::make_pair(fileSize, writeTime));
+
+		auto * entry = g_pluginCache.find(dllPaths.back(), fileSize, writeTime);
+		if(!entry)
+			toScan.push_back(cached.size());
+
+		cached.push_back(entry);
 	}
 
-	s_checked = true;
+	if(!dllPaths.empty())
+		_MESSAGE("%d of %d plugins unchanged since the last run", u32(dllPaths.size() - toScan.size()), u32(dllPaths.size()));
 
-	return s_status;
-}
+	// files are independent, so read them in parallel. results are merged below in directory order
+	std::vector <PluginScanResult>	results(dllPaths.size());
+	std::atomic <size_t>			nextFile(0);
 
-const char * PluginManager::safeCallLoadPlugin(LoadedPlugin * plugin, const OBSEInterface * obse64, u32 phase)
-{
-	__try
+	auto worker = [&]()
 	{
-		if(!plugin->load[phase](obse64))
+		for(size_t i = nextFile++; i < toScan.size(); i = nextFile++)
 		{
-			return "reported as incompatible during load";
+			u64 start = GetTicks();
+
+			ScanPluginFile(dllPaths[toScan[i]].c_str(), &results[toScan[i]]);
+
+			results[toScan[i]].scanTicks = GetTicks() - start;
 		}
-	}
-	__except(EXCEPTION_EXECUTE_HANDLER)
-	{
-		// something very bad happened
-		return "disabled, fatal error occurred while loading plugin";
-	}
+	};
 
-	return nullptr;
-}
+	size_t numThreads = (std::min)(size_t(std::thread::hardware_concurrency()), size_t(kMaxScanThreads));
+	numThreads = (std::min)(numThreads, toScan.size());
 
-void PluginManager::sanitize(OBSEPluginVersionData * version)
-{
+	std::vector <std::thread>	threads;
+
+	// this thread does its share too
+	for(size_t i = 1; i < numThreads; i++)
+		threads.emplace_back(worker);
+
+	worker();
+
+	for(auto & thread : threads)
+		thread.join();
+
+	// handles are assigned in directory order, same as scanning one at a time
+	for(size_t i = 0; i < results.size(); i++)
+	{
+		auto * entry = cached[i];
+
+		PluginCache::Entry uncached;
+
+		if(!entry)
+		{
+			auto & result = results[i];
+
+			uncached.fileSize = dllFileInfo[i].first;
+			uncached.writeTime = dllFileInfo[i].second;
+			uncached.status = result.status;
+			uncached.hasLoad = result.hasLoad;
+			uncached.hasPreload = result.hasPreload;
+			uncached.version = result.version;
+
+			if(result.status == PluginScanResult::kStatus_OK)
+			{
+				sanitize(&uncached.version);
+
+				auto * loadStatus = checkPluginCompatibility(uncached.version);
+				if(loadStatus)
+					uncached.verdict = loadStatus;
+			}
+
+			// files that couldn't be read might be fine next time
+			if((result.status != PluginScanResult::kStatus_CantOpen) && (result.status != PluginScanResult::kStatus_Exception))
+				entry = g_pluginCache.insert(dllPaths[i], uncached);
+			else
+				entry = &uncached;
+		}
+		else if(entry->version.addressIndependence & OBSEPluginVersionData::kAddressIndependence_AddressLibrary)
+		{
+			// the verdict already accounts for the address library, this keeps the update prompt working
+			checkAddressLibrary();
+		}
+
+		LoadedPlugin	plugin;
+		plugin.dllName = dllNames[i];
+
+		PluginProfile	profile;
+
+		profile.dllName = dllNames[i];
+		profile.cached = cached[i] != nullptr;
+		profile.scanTicks = results[i].scanTicks;
+
+		if(entry->status == PluginScanResult::kStatus_OK)
+			profile.name = entry->version.name;
+
+		plugin.profileIdx = u32(m_profiles.size());
+		m_profiles.push_back(profile);
+
+		_MESSAGE("checking plugin %s", plugin.dllName.c_str());
+
+		switch(entry->status)
+		{
+			case PluginScanResult::kStatus_OK:
+			{
+				plugin.version = entry->version;
+
+				auto * loadStatus = entry->verdict.empty() ? nullptr : entry->verdict.c_str();
+				if(!loadStatus)
+				{
+					// compatible, add to list
+
+					plugin.hasLoad = entry->hasLoad;
+					plugin.hasPreload = entry->hasPreload;
+
+					m_profiles[plugin.profileIdx].handle = addPlugin(plugin);
+				}
+				else
+				{
+					logPluginLoadError(plugin, loadStatus);
+				}
+			}
+			break;
+
+			case PluginScanResult::kStatus_NoVersion:
+				logPluginLoadError(plugin, "no version data", 0, false);
+				break;
+
+			case PluginScanResult::kStatus_Not64Bit:
+				logPluginLoadError(plugin, "not a 64-bit dll, 32-bit plugins can never work");
+				break;
+
+			case PluginScanResult::kStatus_Exception:
+				logPluginLoadError(plugin, "couldn't read plugin, file is damaged");
+				break;
+
+			default:
+				logPluginLoadError(plugin, "couldn't load plugin", results[i].errorCode);
+				break;
+		}
+	}
+
+	g_pluginCache.save();
+
+	buildNameIndex();
+
+	m_scanTicks = GetTicks() - scanStart;
+}
+
+const char * PluginManager::checkAddressLibrary(void)
+{
+	static bool s_checked = false;
+	static const char * s_status = nullptr;
+
+	if(s_checked)
+	{
+		return s_status;
+	}
+
+	char fileName[256];
+	GetAddressLibraryPath(fileName, sizeof(fileName));
+
+	FileStream versionLib;
+	if(!versionLib.open(fileName))
+	{
+		m_oldAddressLibrary = true;
+		s_status = "disabled, address library needs to be updated";
+	}
+
+	s_checked = true;
+
+	return s_status;
+}
+
+const char * PluginManager::safeCallLoadPlugin(LoadedPlugin * plugin, const OBSEInterface * obse64, u32 phase)
+{
+	const char * result = nullptr;
+
+	u64 start = GetTicks();
+
+	__try
+	{
+		if(!plugin->load[phase](obse64))
+		{
+			result = "reported as incompatible during load";
+		}
+	}
+	__except(EXCEPTION_EXECUTE_HANDLER)
+	{
+		// something very bad happened
+		result = "disabled, fatal error occurred while loading plugin";
+	}
+
+	m_profiles[plugin->profileIdx].loadTicks[phase] = GetTicks() - start;
+
+	return result;
+}
+
+void PluginManager::sanitize(OBSEPluginVersionData * version)
+{
 	version->name[sizeof(version->name) - 1] = 0;
 	version->author[sizeof(version->author) - 1] = 0;
 }
@@ -573,6 +1171,8 @@ void PluginManager::logPluginLoadError(const LoadedPlugin & pluginSrc, const cha
 	if(isError)
 		m_erroredPlugins.push_back(plugin);
 
+	m_profiles[plugin.profileIdx].status = errStr;
+
 	_MESSAGE("plugin %s (%08X %s %08X) %s %d (handle %d)",
 		plugin.dllName.c_str(),
 		plugin.version.dataVersion,
@@ -673,6 +1273,149 @@ void PluginManager::reportPluginErrors()
 	}
 }
 
+// src is in the ANSI codepage, like the dll names it comes from. anything outside of ascii is written as \u escapes
+// of its UTF-16 form, so the file stays valid whatever the codepage was
+static void AppendJSONString(std::string * dst, const char * src)
+{
+	std::wstring wide;
+
+	int len = MultiByteToWideChar(CP_ACP, 0, src, -1, nullptr, 0);
+	if(len > 1)
+	{
+		wide.resize(len);
+		MultiByteToWideChar(CP_ACP, 0, src, -1, &wide[0], len);
+		wide.resize(len - 1);
+	}
+	else
+	{
+		// not convertible, keep the ascii part
+		for(; *src; src++)
+			wide.push_back((u8(*src) < 0x80) ? wchar_t(*src) : L'?');
+	}
+
+	dst->push_back('"');
+
+	for(wchar_t c : wide)
+	{
+		if((c == L'"') || (c == L'\\'))
+		{
+			dst->push_back('\\');
+			dst->push_back(char(c));
+		}
+		else if((c < 0x20) || (c >= 0x80))
+		{
+			char buf[8];
+			sprintf_s(buf, "\\u%04X", u32(c));
+
+			dst->append(buf);
+		}
+		else
+		{
+			dst->push_back(char(c));
+		}
+	}
+
+	dst->push_back('"');
+}
+
+void PluginManager::reportStartupProfile()
+{
+	if(m_profiles.empty())
+		return;
+
+	// trampoline usage is only final once everything has loaded
+	std::vector <u64> trampolineBytes(m_profiles.size(), 0);
+
+	for(size_t i = 0; i < m_profiles.size(); i++)
+	{
+		auto & profile = m_profiles[i];
+
+		if(profile.handle != kPluginHandle_Invalid)
+			trampolineBytes[i] = g_branchTrampolineManager.pluginUsage(profile.handle) + g_localTrampolineManager.pluginUsage(profile.handle);
+	}
+
+	// slowest first
+	std::vector <size_t> order(m_profiles.size());
+	for(size_t i = 0; i < order.size(); i++)
+		order[i] = i;
+
+	std::stable_sort(order.begin(), order.end(), [this](size_t lhs, size_t rhs)
+	{
+		return m_profiles[lhs].totalTicks() > m_profiles[rhs].totalTicks();
+	});
+
+	u64 totalTicks = 0;
+	u32 numCached = 0;
+
+	for(auto & profile : m_profiles)
+	{
+		totalTicks += profile.loadLibraryTicks + profile.loadTicks[kPhase_Preload] + profile.loadTicks[kPhase_Load];
+
+		if(profile.cached)
+			numCached++;
+	}
+
+	_MESSAGE("startup profile: %d plugins (%d cached), scan %.2f ms, loading %.2f ms",
+		u32(m_profiles.size()), numCached, TicksToMS(m_scanTicks), TicksToMS(totalTicks));
+	_MESSAGE("\t  total ms     scan  library  preload     load  trampoline  plugin");
+
+	std::string json;
+
+	char buf[512];
+
+	sprintf_s(buf, "{\n\t\"scanMs\": %.3f,\n\t\"loadMs\": %.3f,\n\t\"plugins\": [", TicksToMS(m_scanTicks), TicksToMS(totalTicks));
+	json += buf;
+
+	for(size_t i = 0; i < order.size(); i++)
+	{
+		auto & profile = m_profiles[order[i]];
+		const char * status = profile.status.empty() ? "loaded" : profile.status.c_str();
+
+		_MESSAGE("\t%10.2f %8.2f %8.2f %8.2f %8.2f %11I64d  %s (%s)%s",
+			TicksToMS(profile.totalTicks()),
+			TicksToMS(profile.scanTicks),
+			TicksToMS(profile.loadLibraryTicks),
+			TicksToMS(profile.loadTicks[kPhase_Preload]),
+			TicksToMS(profile.loadTicks[kPhase_Load]),
+			trampolineBytes[order[i]],
+			profile.dllName.c_str(),
+			status,
+			profile.cached ? " cached" : "");
+
+		json += i ? ",\n\t\t{ \"dll\": " : "\n\t\t{ \"dll\": ";
+		AppendJSONString(&json, profile.dllName.c_str());
+		json += ", \"name\": ";
+		AppendJSONString(&json, profile.name.c_str());
+		json += ", \"status\": ";
+		AppendJSONString(&json, status);
+
+		sprintf_s(buf, ", \"cached\": %s, \"totalMs\": %.3f, \"scanMs\": %.3f, \"loadLibraryMs\": %.3f, \"preloadMs\": %.3f, \"loadMs\": %.3f, \"trampolineBytes\": %I64d }",
+			profile.cached ? "true" : "false",
+			TicksToMS(profile.totalTicks()),
+			TicksToMS(profile.scanTicks),
+			TicksToMS(profile.loadLibraryTicks),
+			TicksToMS(profile.loadTicks[kPhase_Preload]),
+			TicksToMS(profile.loadTicks[kPhase_Load]),
+			trampolineBytes[order[i]]);
+		json += buf;
+	}
+
+	json += "\n\t]\n}\n";
+
+	// next to the log
+	char path[MAX_PATH];
+	if(!SUCCEEDED(SHGetFolderPath(NULL, CSIDL_MYDOCUMENTS | CSIDL_FLAG_CREATE, NULL, SHGFP_TYPE_CURRENT, path)))
+		return;
+
+	strcat_s(path, "\\My Games\\" SAVE_FOLDER_NAME "\\OBSE\\Logs\\obse64_startup.json");
+
+	FileStream dst;
+	if(dst.create(path))
+		dst.write(json.data(), json.size());
+	else
+		_WARNING("couldn't write %s", path);
+}
+
 void PluginManager::updateAddressLibraryPrompt()
 {
 	int result = MessageBox(0,
@@ -692,26 +1435,86 @@ struct PluginListener {
 	OBSEMessagingInterface::EventCallback	handleMessage;
 };
 
-typedef std::vector<std::vector<PluginListener> > PluginListeners;
+typedef std::vector<PluginListener> PluginListenerList;
+
+struct SenderListeners {
+	// listeners that want every message type, in registration order
+	PluginListenerList	all;
+
+	// per message type subscribers, including everything in all so dispatch only walks one array
+	// types nobody subscribed to specifically just use all
+	std::unordered_map<u32, PluginListenerList>	byType;
+};
+
+// indexed by the sender's slot, see PluginManager::handleIndex
+typedef std::vector<SenderListeners> PluginListeners;
 static PluginListeners s_pluginListeners;
 
-bool PluginManager::registerListener(PluginHandle listener, const char* sender, OBSEMessagingInterface::EventCallback handler)
+static bool HasListener(const PluginListenerList & list, PluginHandle listener)
+{
+	for (auto & iter : list)
+	{
+		if (iter.listener == listener)
+			return true;
+	}
+
+	return false;
+}
+
+static void AddListener(PluginListenerList * list, const PluginListener & newListener)
+{
+	if (!HasListener(*list, newListener.listener))
+		list->push_back(newListener);
+}
+
+// types is null for every message type
+static void AddListener(SenderListeners * senderListeners, const PluginListener & newListener, const u32 * types, u32 numTypes)
+{
+	// already receives everything from this sender
+	if (HasListener(senderListeners->all, newListener.listener))
+		return;
+
+	if (!types)
+	{
+		senderListeners->all.push_back(newListener);
+
+		for (auto & iter : senderListeners->byType)
+			AddListener(&iter.second, newListener);
+	}
+	else
+	{
+		for (u32 i = 0; i < numTypes; i++)
+		{
+			auto result = senderListeners->byType.emplace(types[i], PluginListenerList());
+			if (result.second)
+				result.first->second = senderListeners->all;
+
+			AddListener(&result.first->second, newListener);
+		}
+	}
+}
+
+static bool RegisterListener(PluginHandle listener, const char* sender, const u32 * types, u32 numTypes, OBSEMessagingInterface::EventCallback handler)
 {
 	// because this can be called while plugins are loading, gotta make sure number of plugins hasn't increased
-	u32 numPlugins = g_pluginManager.numPlugins() + 1;
-	if (s_pluginListeners.size() < numPlugins)
+	u32 numSlots = g_pluginManager.numSlots();
+	if (s_pluginListeners.size() < numSlots)
 	{
-		s_pluginListeners.resize(numPlugins + 5);	// add some extra room to avoid unnecessary re-alloc
+		s_pluginListeners.resize(numSlots + 5);	// add some extra room to avoid unnecessary re-alloc
 	}
 
-	_MESSAGE("registering plugin listener for %s at %u of %u", sender, listener, numPlugins);
+	_MESSAGE("registering plugin listener for %s at %u of %u", sender, PluginManager::handleIndex(listener), numSlots);
 
-	// handle > num plugins = invalid
-	if (listener > g_pluginManager.numPlugins() || !handler) 
+	// handle doesn't belong to a loaded plugin = invalid
+	if (!g_pluginManager.isValidHandle(listener) || !handler) 
 	{
 		return false;
 	}
 
+	PluginListener newListener;
+	newListener.handleMessage = handler;
+	newListener.listener = listener;
+
 	if (sender)
 	{
 		// is target loaded?
@@ -720,87 +1523,69 @@ bool PluginManager::registerListener(PluginHandle listener, const char* sender,
 		{
 			return false;
 		}
-		// is listener already registered?
-		for (std::vector<PluginListener>::iterator iter = s_pluginListeners[target].begin(); iter != s_pluginListeners[target].end(); ++iter)
-		{
-			if (iter->listener == listener)
-			{
-				return true;
-			}
-		}
-
-		// register new listener
-		PluginListener newListener;
-		newListener.handleMessage = handler;
-		newListener.listener = listener;
 
-		s_pluginListeners[target].push_back(newListener);
+		AddListener(&s_pluginListeners[PluginManager::handleIndex(target)], newListener, types, numTypes);
 	}
 	else
 	{
 		// register listener to every loaded plugin
-		u32 idx = 0;
-		for(PluginListeners::iterator iter = s_pluginListeners.begin(); iter != s_pluginListeners.end(); ++iter)
+		for (u32 idx = 1; idx < s_pluginListeners.size(); idx++)
 		{
 			// don't add the listener to its own list
-			if (idx && idx != listener)
+			if (idx != PluginManager::handleIndex(listener))
 			{
-				bool skipCurrentList = false;
-				for (std::vector<PluginListener>::iterator iterEx = iter->begin(); iterEx != iter->end(); ++iterEx)
-				{
-					// already registered with this plugin, skip it
-					if (iterEx->listener == listener)
-					{
-						skipCurrentList = true;
-						break;
-					}
-				}
-				if (skipCurrentList)
-				{
-					continue;
-				}
-				PluginListener newListener;
-				newListener.handleMessage = handler;
-				newListener.listener = listener;
-
-				iter->push_back(newListener);
+				AddListener(&s_pluginListeners[idx], newListener, types, numTypes);
 			}
-			idx++;
 		}
 	}
 
 	return true;
 }
 
-bool PluginManager::dispatchMessage(PluginHandle sender, u32 messageType, void * data, u32 dataLen, const char* receiver)
+bool PluginManager::registerListener(PluginHandle listener, const char* sender, OBSEMessagingInterface::EventCallback handler)
+{
+	return RegisterListener(listener, sender, nullptr, 0, handler);
+}
+
+bool PluginManager::registerListenerForTypes(PluginHandle listener, const char* sender, const u32 * types, u32 numTypes, OBSEMessagingInterface::EventCallback handler)
+{
+	if (!types || !numTypes)
+		return false;
+
+	return RegisterListener(listener, sender, types, numTypes, handler);
+}
+
+// target is kPluginHandle_Invalid to send to every listener
+static bool DispatchToListeners(PluginHandle sender, u32 messageType, void * data, u32 dataLen, PluginHandle target)
 {
-	_MESSAGE("dispatch message (%d) to plugin listeners", messageType);
 	u32 numRespondents = 0;
-	PluginHandle target = kPluginHandle_Invalid;
 
 	if (!s_pluginListeners.size())	// no listeners yet registered
 	{
 		_MESSAGE("no listeners registered");
 		return false;
 	}
-	else if (sender >= s_pluginListeners.size())
+	else if (PluginManager::handleIndex(sender) >= s_pluginListeners.size())
 	{
 		_MESSAGE("sender is not in the list");
 		return false;
 	}
 
-	if (receiver)
-	{
-		target = g_pluginManager.lookupHandleFromName(receiver);
-		if (target == kPluginHandle_Invalid)
-			return false;
-	}
-
 	const char* senderName = g_pluginManager.pluginNameFromHandle(sender);
 	if (!senderName)
 		return false;
-	for (std::vector<PluginListener>::iterator iter = s_pluginListeners[sender].begin(); iter != s_pluginListeners[sender].end(); ++iter)
+	auto & senderListeners = s_pluginListeners[PluginManager::handleIndex(sender)];
+
+	// only listeners interested in this type
+	auto typeListeners = senderListeners.byType.find(messageType);
+	auto & listeners = (typeListeners != senderListeners.byType.end()) ? typeListeners->second : senderListeners.all;
+
+	for (PluginListenerList::iterator iter = listeners.begin(); iter != listeners.end(); ++iter)
 	{
+		// registered by a plugin that failed to load afterwards, its dll is gone
+		if (!g_pluginManager.isValidHandle(iter->listener))
+			continue;
+
 		OBSEMessagingInterface::Message msg;
 		msg.data = data;
 		msg.type = messageType;
@@ -811,6 +1596,7 @@ bool PluginManager::dispatchMessage(PluginHandle sender, u32 messageType, void *
 		{
 			if (iter->listener == target)
 			{
+				PatchRegistry::OwnerScope patchOwner(iter->listener);
 				iter->handleMessage(&msg);
 				return true;
 			}
@@ -818,6 +1604,7 @@ bool PluginManager::dispatchMessage(PluginHandle sender, u32 messageType, void *
 		else
 		{
 			_DMESSAGE("sending message type %u to plugin %u", messageType, iter->listener);
+			PatchRegistry::OwnerScope patchOwner(iter->listener);
 			iter->handleMessage(&msg);
 			numRespondents++;
 		}
@@ -826,19 +1613,166 @@ bool PluginManager::dispatchMessage(PluginHandle sender, u32 messageType, void *
 	return numRespondents ? true : false;
 }
 
-inline void * BranchTrampolineManager::allocate(PluginHandle plugin, size_t size)
+bool PluginManager::dispatchMessage(PluginHandle sender, u32 messageType, void * data, u32 dataLen, const char* receiver)
+{
+	_MESSAGE("dispatch message (%d) to plugin listeners", messageType);
+
+	PluginHandle target = kPluginHandle_Invalid;
+
+	if (receiver)
+	{
+		target = g_pluginManager.lookupHandleFromName(receiver);
+		if (target == kPluginHandle_Invalid)
+			return false;
+	}
+
+	return DispatchToListeners(sender, messageType, data, dataLen, target);
+}
+
+bool PluginManager::dispatchMessageToHandle(PluginHandle sender, u32 messageType, void * data, u32 dataLen, PluginHandle receiver)
+{
+	// also rejects kPluginHandle_Invalid, use Dispatch with no receiver to send to everyone
+	if (!g_pluginManager.isValidHandle(receiver))
+		return false;
+
+	_MESSAGE("dispatch message (%d) to plugin listeners", messageType);
+
+	return DispatchToListeners(sender, messageType, data, dataLen, receiver);
+}
+
+bool PluginManager::dispatchMessageAsync(PluginHandle sender, u32 messageType, const void * data, u32 dataLen, PluginHandle receiver)
+{
+	// the plugin list doesn't change after loading, so this is safe from any thread
+	if (!g_pluginManager.isValidHandle(sender))
+		return false;
+
+	if ((receiver != kPluginHandle_Invalid) && !g_pluginManager.isValidHandle(receiver))
+		return false;
+
+	if (dataLen && !data)
+		return false;
+
+	g_pluginMessageQueue.push(sender, receiver, messageType, data, dataLen);
+
+	return true;
+}
+
+bool PluginManager::dispatchPayloadAsync(PluginHandle sender, u32 messageType, void * payload, PluginHandle receiver)
+{
+	if (!g_pluginManager.isValidHandle(sender) || !payload)
+		return false;
+
+	if ((receiver != kPluginHandle_Invalid) && !g_pluginManager.isValidHandle(receiver))
+		return false;
+
+	g_pluginMessageQueue.pushPayload(sender, receiver, messageType, payload);
+
+	return true;
+}
+
+static void DeliverQueuedMessage(PluginMessageQueue::Message * msg)
+{
+	// no logging per message, this runs every frame
+	if (PluginManager::handleIndex(msg->sender) >= s_pluginListeners.size())
+		return;
+
+	// receiver may have been checked before it failed to load
+	if ((msg->receiver != kPluginHandle_Invalid) && !g_pluginManager.isValidHandle(msg->receiver))
+		return;
+
+	DispatchToListeners(msg->sender, msg->type, msg->data(), msg->dataLen, msg->receiver);
+}
+
+void PluginManager::dispatchQueuedMessages()
+{
+	u32 numDelivered = g_pluginMessageQueue.drain(DeliverQueuedMessage);
+
+	if (numDelivered)
+		_DMESSAGE("delivered %d queued messages", numDelivered);
+}
+
+PluginHandle PluginManager::lookupHandle(const char * name)
+{
+	if (!name)
+		return kPluginHandle_Invalid;
+
+	return g_pluginManager.lookupHandleFromName(name);
+}
+
+// only the record of this exact handle, a slot reused by another plugin doesn't match
+BranchTrampolineManager::PluginRecord * BranchTrampolineManager::getRecord(PluginHandle plugin)
+{
+	u32 index = PluginManager::handleIndex(plugin);
+	if (index >= kMaxPluginRecords) {
+		return nullptr;
+	}
+
+	auto record = &m_plugins[index];
+	if (record->handle.load(std::memory_order_acquire) != plugin) {
+		return nullptr;
+	}
+
+	return record;
+}
+
+// takes over the slot's record if it still belongs to a removed plugin
+BranchTrampolineManager::PluginRecord * BranchTrampolineManager::claimRecord(PluginHandle plugin)
+{
+	auto record = getRecord(plugin);
+	if (record) {
+		return record;
+	}
+
+	u32 index = PluginManager::handleIndex(plugin);
+	if (index >= kMaxPluginRecords || !g_pluginManager.isValidHandle(plugin)) {
+		return nullptr;
+	}
+
+	record = &m_plugins[index];
+
+	std::lock_guard<decltype(m_lock)> locker(m_lock);
+
+	PluginHandle oldHandle = record->handle.load(std::memory_order_relaxed);
+	if (oldHandle != plugin) {
+		// the old plugin's memory stays allocated, it may still be patched in to game code. only the
+		// bookkeeping is dropped
+		size_t oldBytes = record->bytes.exchange(0, std::memory_order_relaxed);
+		if (oldBytes) {
+			_WARNING("plugin %d is reusing the slot of removed plugin %d, which still held %lld trampoline bytes", plugin, oldHandle, oldBytes);
+		}
+
+		auto iter = record->blocks.exchange(nullptr, std::memory_order_acquire);
+		while (iter) {
+			auto next = iter->next;
+			delete iter;
+			iter = next;
+		}
+
+		record->handle.store(plugin, std::memory_order_release);
+	}
+
+	return record;
+}
+
+void * BranchTrampolineManager::allocate(PluginHandle plugin, size_t size, uintptr_t target)
 {
-	auto mem = m_trampoline.allocate(size);
+	auto mem = target ? m_trampoline.allocate(size, target) : m_trampoline.allocate(size);
 	if (mem) {
-		std::lock_guard<decltype(m_lock)> locker(m_lock);
+		auto record = claimRecord(plugin);
+		if (record) {
+			record->bytes.fetch_add(size, std::memory_order_relaxed);
 
-		auto findIt = m_stats.find(plugin);
-		if (findIt != m_stats.end()) {
-			findIt->second += size;
+			auto block = new Block;
+			block->ptr = uintptr_t(mem);
+			block->size = size;
+			block->next = record->blocks.load(std::memory_order_relaxed);
+
+			while (!record->blocks.compare_exchange_weak(block->next, block, std::memory_order_release, std::memory_order_relaxed)) {
+				// block->next was updated, retry
+			}
 		}
 		else {
-			auto insIt = m_stats.insert(std::make_pair(plugin, size));
-			ASSERT(insIt.second);   // insertion failed
+			_WARNING("plugin %d trampoline allocation not tracked, invalid handle", plugin);
 		}
 	}
 	else {
@@ -847,6 +1781,88 @@ inline void * BranchTrampolineManager::allocate(PluginHandle plugin, size_t size
 	return mem;
 }
 
+void BranchTrampolineManager::release(PluginHandle plugin, void * ptr, size_t size)
+{
+	auto record = getRecord(plugin);
+	if (record && size) {
+		std::lock_guard<decltype(m_lock)> locker(m_lock);
+
+		// newest first, so a block that was released and handed out again finds the live entry
+		Block * prev = nullptr;
+		for (auto iter = record->blocks.load(std::memory_order_acquire); iter; prev = iter, iter = iter->next) {
+			if (iter->ptr != uintptr_t(ptr) || iter->size != size) {
+				continue;
+			}
+
+			// allocate only ever pushes to the head, so anything past it can be unlinked directly. if the head
+			// moved, walk from the new one to find what now points at this block
+			if (!prev) {
+				Block * head = iter;
+				if (!record->blocks.compare_exchange_strong(head, iter->next, std::memory_order_acquire)) {
+					prev = head;
+					while (prev->next != iter) {
+						prev = prev->next;
+					}
+				}
+			}
+
+			if (prev) {
+				prev->next = iter->next;
+			}
+
+			delete iter;
+
+			record->bytes.fetch_sub(size, std::memory_order_relaxed);
+			m_trampoline.release(ptr, size);
+			return;
+		}
+	}
+
+	_ERROR("plugin %d released %016I64X (%lld bytes) which it doesn't own", plugin, ptr, size);
+}
+
+void BranchTrampolineManager::releaseAll(PluginHandle plugin)
+{
+	auto record = getRecord(plugin);
+	if (!record) {
+		return;
+	}
+
+	std::lock_guard<decltype(m_lock)> locker(m_lock);
+
+	auto iter = record->blocks.exchange(nullptr, std::memory_order_acquire);
+	while (iter) {
+		auto next = iter->next;
+
+		record->bytes.fetch_sub(iter->size, std::memory_order_relaxed);
+		m_trampoline.release((void *)iter->ptr, iter->size);
+
+		delete iter;
+		iter = next;
+	}
+}
+
+size_t BranchTrampolineManager::pluginUsage(PluginHandle plugin)
+{
+	auto record = getRecord(plugin);
+	return record ? record->bytes.load(std::memory_order_relaxed) : 0;
+}
+
+void BranchTrampolineManager::getStats(PluginHandle plugin, OBSETrampolineInterface::PoolStats * out)
+{
+	BranchTrampoline::Stats stats;
+	m_trampoline.getStats(&stats);
+
+	out->reserved = stats.reserved;
+	out->used = stats.used;
+	out->free = stats.free;
+	out->freeBlocks = stats.freeBlocks;
+	out->remain = stats.remain;
+	out->numRegions = stats.numRegions;
+	out->pluginUsed = pluginUsage(plugin);
+	out->sharedBranches = stats.sharedBranches;
+	out->sharedSaved = stats.sharedSaved;
+}
 
 void * AllocateFromOBSEBranchPool(PluginHandle plugin, size_t size)
 {
@@ -863,3 +1879,82 @@ void * AllocateFromOBSELocalPool(PluginHandle plugin, size_t size)
 	}
 	return g_localTrampolineManager.allocate(plugin, size);
 }
+
+void * AllocateFromOBSEBranchPoolNear(PluginHandle plugin, size_t size, const void * target)
+{
+	if (s_trampolineLog) {
+		_DMESSAGE("plugin %d allocated %lld bytes from branch pool near %016I64X", plugin, size, target);
+	}
+	return g_branchTrampolineManager.allocate(plugin, size, uintptr_t(target));
+}
+
+void ReleaseToOBSEBranchPool(PluginHandle plugin, void * ptr, size_t size)
+{
+	if (s_trampolineLog) {
+		_DMESSAGE("plugin %d released %lld bytes to branch pool", plugin, size);
+	}
+	g_branchTrampolineManager.release(plugin, ptr, size);
+}
+
+void ReleaseToOBSELocalPool(PluginHandle plugin, void * ptr, size_t size)
+{
+	if (s_trampolineLog) {
+		_DMESSAGE("plugin %d released %lld bytes to local pool", plugin, size);
+	}
+	g_localTrampolineManager.release(plugin, ptr, size);
+}
+
+void ReleaseAllFromOBSEPools(PluginHandle plugin)
+{
+	if (s_trampolineLog) {
+		_DMESSAGE("plugin %d released all trampoline memory", plugin);
+	}
+	g_branchTrampolineManager.releaseAll(plugin);
+	g_localTrampolineManager.releaseAll(plugin);
+}
+
+bool GetOBSEPoolStats(PluginHandle plugin, u32 pool, OBSETrampolineInterface::PoolStats * out)
+{
+	switch (pool) {
+	case OBSETrampolineInterface::kPool_Branch:
+		g_branchTrampolineManager.getStats(plugin, out);
+		return true;
+	case OBSETrampolineInterface::kPool_Local:
+		g_localTrampolineManager.getStats(plugin, out);
+		return true;
+	}
+	return false;
+}
+
+static BranchTrampoline * GetOBSEPool(u32 pool)
+{
+	switch (pool) {
+	case OBSETrampolineInterface::kPool_Branch:
+		return &g_branchTrampoline;
+	case OBSETrampolineInterface::kPool_Local:
+		return &g_localTrampoline;
+	}
+	return nullptr;
+}
+
+bool IsOBSEPoolWriteProtected(u32 pool)
+{
+	auto trampoline = GetOBSEPool(pool);
+	return trampoline ? trampoline->writeProtected() : false;
+}
+
+void BeginOBSEPoolWrite(u32 pool, const void * ptr, size_t size)
+{
+	auto trampoline = GetOBSEPool(pool);
+	if (trampoline) {
+		trampoline->beginWrite(ptr, size);
+	}
+}
+
+void EndOBSEPoolWrite(u32 pool, const void * ptr, size_t size)
+{
+	auto trampoline = GetOBSEPool(pool);
+	if (trampoline) {
+		trampoline->endWrite(ptr, size);
+	}
+}
@@ -3,6 +3,7 @@
 #include <string>
 #include <vector>
 #include <mutex>
+#include <atomic>
 #include <unordered_map>
 
 #include "obse64/PluginAPI.h"
@@ -35,6 +36,21 @@ public:
 	const char *	pluginNameFromHandle(PluginHandle handle) const;
 	PluginHandle	lookupHandleFromName(const char * pluginName) const;
 
+	// handles are a slot index in the low bits and that slot's generation above it. a handle stays the same
+	// while its plugin is loaded, and stops resolving once the plugin is removed even if the slot is reused
+	enum
+	{
+		kHandle_IndexBits =			16,
+		kHandle_IndexMask =			(1 << kHandle_IndexBits) - 1,
+		kHandle_GenerationMask =	0xFFFF,
+	};
+
+	// per-plugin tables can be indexed by this, 0 is OBSE
+	static u32	handleIndex(PluginHandle handle) { return handle & kHandle_IndexMask; }
+
+	u32		numSlots() const { return u32(m_slots.size()); }
+	bool	isValidHandle(PluginHandle handle) const { return !handle || lookupPlugin(handle); }
+
 	// interface handlers
 	static void *				queryInterface(u32 id);
 	static PluginHandle			getPluginHandle();
@@ -44,6 +60,14 @@ public:
 
 	static bool dispatchMessage(PluginHandle sender, u32 messageType, void * data, u32 dataLen, const char* receiver);
 	static bool	registerListener(PluginHandle listener, const char* sender, OBSEMessagingInterface::EventCallback handler);
+	static PluginHandle	lookupHandle(const char * name);
+	static bool	dispatchMessageToHandle(PluginHandle sender, u32 messageType, void * data, u32 dataLen, PluginHandle receiver);
+	static bool	registerListenerForTypes(PluginHandle listener, const char* sender, const u32 * types, u32 numTypes, OBSEMessagingInterface::EventCallback handler);
+	static bool	dispatchMessageAsync(PluginHandle sender, u32 messageType, const void * data, u32 dataLen, PluginHandle receiver);
+	static bool	dispatchPayloadAsync(PluginHandle sender, u32 messageType, void * payload, PluginHandle receiver);
+
+	// delivers everything sent with DispatchAsync, called once per frame on the game thread
+	static void	dispatchQueuedMessages();
 
 private:
 	struct LoadedPlugin
@@ -65,6 +89,30 @@ private:
 
 		bool	hasLoad = false;
 		bool	hasPreload = false;
+
+		u32		profileIdx = 0;	// in to m_profiles
+	};
+
+	// where startup time went for each dll, including the ones that didn't load. times are in QPC ticks
+	struct PluginProfile
+	{
+		std::string		dllName;
+		std::string		name;
+		std::string		status;				// empty if it loaded
+
+		PluginHandle	handle = kPluginHandle_Invalid;
+		bool			cached = false;		// scan result came from the plugin cache
+
+		u64				scanTicks = 0;
+		u64				loadLibraryTicks = 0;
+		u64				loadTicks[kPhase_Num] = { 0 };
+
+		u64		totalTicks() const { return scanTicks + loadLibraryTicks + loadTicks[kPhase_Preload] + loadTicks[kPhase_Load]; }
+	};
+
+	enum
+	{
+		kMaxScanThreads = 8,	// mostly waiting on the disk, more doesn't help
 	};
 
 	bool	findPluginDirectory(void);
@@ -78,21 +126,54 @@ private:
 
 	void			logPluginLoadError(const LoadedPlugin & plugin, const char * errStr, u32 errCode = 0, bool isError = true);
 	void			reportPluginErrors();
+	void			reportStartupProfile();
 	void			updateAddressLibraryPrompt();
 
+	struct PluginSlot
+	{
+		LoadedPlugin	plugin;
+		u32				generation = 0;
+		bool			live = false;
+	};
+
+	PluginHandle			addPlugin(const LoadedPlugin & plugin);
+	void					removePlugin(PluginHandle handle);
+	LoadedPlugin *			lookupPlugin(PluginHandle handle);
+	const LoadedPlugin *	lookupPlugin(PluginHandle handle) const;
+
+	// open addressed table of case-folded name hashes, rebuilt when the plugin list changes
+	// names are compared on a hash match, so collisions only cost a _stricmp
+	struct NameIndexEntry
+	{
+		u64				hash;
+		PluginHandle	handle;	// kPluginHandle_Invalid if empty
+	};
+
+	void	buildNameIndex();
+
 	typedef std::vector <LoadedPlugin>	LoadedPluginList;
 
 	std::string			m_pluginDirectory;
-	LoadedPluginList	m_plugins;
+
+	std::vector <PluginSlot>	m_slots;	// slot 0 is OBSE and is never live
+	std::vector <u32>			m_freeSlots;
+	u32							m_numPlugins = 0;
+
+	std::vector <NameIndexEntry>	m_nameIndex;	// power of two size
 
 	LoadedPluginList	m_erroredPlugins;
 
+	std::vector <PluginProfile>	m_profiles;
+	u64							m_scanTicks = 0;	// wall time for the whole scan
+
 	bool				m_oldAddressLibrary = false;
 
 	static LoadedPlugin		* s_currentLoadingPlugin;
 	static PluginHandle		s_currentPluginHandle;
 };
 
+// allocation is lock free, per-plugin accounting uses atomics
+// release, releaseAll and a plugin's first allocation serialize on m_lock, they're rare
 class BranchTrampolineManager
 {
 public:
@@ -100,12 +181,42 @@ public:
 		m_trampoline(trampoline)
 	{}
 
-	void* allocate(PluginHandle plugin, size_t size);
+	void* allocate(PluginHandle plugin, size_t size, uintptr_t target = 0);
+	void release(PluginHandle plugin, void * ptr, size_t size);
+	void releaseAll(PluginHandle plugin);
+
+	void getStats(PluginHandle plugin, OBSETrampolineInterface::PoolStats * out);
+
+	// bytes currently held by the plugin
+	size_t pluginUsage(PluginHandle plugin);
 
 private:
+	enum
+	{
+		kMaxPluginRecords = 1024,
+	};
+
+	struct Block
+	{
+		uintptr_t	ptr;
+		size_t		size;
+		Block		* next;
+	};
+
+	// records are per slot, handle says which plugin in that slot owns it
+	struct PluginRecord
+	{
+		std::atomic<PluginHandle>	handle;
+		std::atomic<size_t>			bytes;
+		std::atomic<Block *>		blocks;	// pushed outside of m_lock, only unlinked under it
+	};
+
+	PluginRecord * getRecord(PluginHandle plugin);
+	PluginRecord * claimRecord(PluginHandle plugin);
+
 	BranchTrampoline& m_trampoline;
 	std::mutex m_lock;
-	std::unordered_map<PluginHandle, size_t> m_stats;
+	PluginRecord m_plugins[kMaxPluginRecords];
 };
 
 extern BranchTrampolineManager g_branchTrampolineManager;
@@ -113,5 +224,13 @@ extern BranchTrampolineManager g_localTrampolineManager;
 
 void * AllocateFromOBSEBranchPool(PluginHandle plugin, size_t size);
 void * AllocateFromOBSELocalPool(PluginHandle plugin, size_t size);
+void * AllocateFromOBSEBranchPoolNear(PluginHandle plugin, size_t size, const void * target);
+void ReleaseToOBSEBranchPool(PluginHandle plugin, void * ptr, size_t size);
+void ReleaseToOBSELocalPool(PluginHandle plugin, void * ptr, size_t size);
+void ReleaseAllFromOBSEPools(PluginHandle plugin);
+bool GetOBSEPoolStats(PluginHandle plugin, u32 pool, OBSETrampolineInterface::PoolStats * out);
+bool IsOBSEPoolWriteProtected(u32 pool);
+void BeginOBSEPoolWrite(u32 pool, const void * ptr, size_t size);
+void EndOBSEPoolWrite(u32 pool, const void * ptr, size_t size);
 
 extern PluginManager	g_pluginManager;
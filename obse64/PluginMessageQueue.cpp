@@ -0,0 +1,143 @@
+#include "PluginMessageQueue.h"
+#include "obse64_common/PayloadPool.h"
+#include <cstring>
+#include <Windows.h>
+
+PluginMessageQueue g_pluginMessageQueue;
+
+PluginMessageQueue::PluginMessageQueue()
+	:m_active(0)
+	, m_head(nullptr)
+{
+	for(auto & arena : m_arenas)
+	{
+		arena.base = new u8[kArenaSize];
+		arena.used = 0;
+		arena.writers = 0;
+	}
+}
+
+PluginMessageQueue::~PluginMessageQueue()
+{
+	// anything still queued in the heap is leaked, the process is going away
+	for(auto & arena : m_arenas)
+		delete [] arena.base;
+}
+
+void PluginMessageQueue::push(PluginHandle sender, PluginHandle receiver, u32 type, const void * data, u32 dataLen)
+{
+	push(sender, receiver, type, data, dataLen, nullptr);
+}
+
+void PluginMessageQueue::pushPayload(PluginHandle sender, PluginHandle receiver, u32 type, void * payload)
+{
+	g_payloadPool.retain(payload);
+
+	push(sender, receiver, type, nullptr, g_payloadPool.size(payload), payload);
+}
+
+void PluginMessageQueue::push(PluginHandle sender, PluginHandle receiver, u32 type, const void * data, u32 dataLen, void * payload)
+{
+	size_t inlineLen = payload ? 0 : dataLen;
+	size_t size = (sizeof(Message) + inlineLen + (kAlignment - 1)) & ~size_t(kAlignment - 1);
+
+	// register as a writer of the active arena. if drain switched arenas in the meantime it may not have
+	// seen us, so back out and use the new one
+	Arena * arena;
+
+	while(true)
+	{
+		arena = &m_arenas[m_active.load()];
+
+		arena->writers++;
+
+		if(arena == &m_arenas[m_active.load()])
+			break;
+
+		arena->writers--;
+	}
+
+	Message * msg = nullptr;
+
+	size_t offset = arena->used.fetch_add(size);
+	if(offset + size <= kArenaSize)
+	{
+		msg = (Message *)(arena->base + offset);
+		msg->fromHeap = false;
+	}
+	else
+	{
+		msg = (Message *)new u8[size];
+		msg->fromHeap = true;
+	}
+
+	msg->sender = sender;
+	msg->receiver = receiver;
+	msg->type = type;
+	msg->dataLen = dataLen;
+	msg->payload = payload;
+
+	if(inlineLen)
+		memcpy(msg->data(), data, inlineLen);
+
+	msg->next = m_head.load(std::memory_order_relaxed);
+
+	while(!m_head.compare_exchange_weak(msg->next, msg, std::memory_order_release, std::memory_order_relaxed))
+	{
+		// msg->next was updated, retry
+	}
+
+	arena->writers--;
+}
+
+u32 PluginMessageQueue::drain(DeliverCallback deliver)
+{
+	// new messages go to the other arena from now on
+	u32 oldIdx = m_active.load();
+	Arena & oldArena = m_arenas[oldIdx];
+
+	m_active = oldIdx ^ 1;
+
+	// only ever a memcpy away from finishing
+	while(oldArena.writers.load())
+		YieldProcessor();
+
+	// everything in the old arena has been pushed now. messages in the new one may be included too,
+	// that's fine since it isn't reset until the next drain
+	Message * list = m_head.exchange(nullptr, std::memory_order_acquire);
+
+	// the list is newest first
+	Message * ordered = nullptr;
+
+	while(list)
+	{
+		Message * next = list->next;
+
+		list->next = ordered;
+		ordered = list;
+
+		list = next;
+	}
+
+	u32 numDelivered = 0;
+
+	while(ordered)
+	{
+		Message * next = ordered->next;
+
+		deliver(ordered);
+		numDelivered++;
+
+		if(ordered->payload)
+			g_payloadPool.release(ordered->payload);
+
+		if(ordered->fromHeap)
+			delete [] (u8 *)ordered;
+
+		ordered = next;
+	}
+
+	oldArena.used = 0;
+
+	return numDelivered;
+}
@@ -0,0 +1,65 @@
+#pragma once
+
+#include "obse64/PluginAPI.h"
+#include "obse64_common/Types.h"
+#include <atomic>
+
+// messages sent with DispatchAsync wait here until the game thread delivers them
+// any number of threads push, only the game thread drains. pushing never takes a lock: the message is
+// linked on to an atomic list head, and its payload is copied in to the current frame's arena
+// there are two arenas. draining switches senders to the other one, waits for anyone still copying in to
+// the old one, delivers everything and then resets the old arena, so payloads stay valid until delivered
+class PluginMessageQueue
+{
+public:
+	struct alignas(16) Message
+	{
+		Message			* next;
+		PluginHandle	sender;
+		PluginHandle	receiver;	// kPluginHandle_Invalid for every listener
+		u32				type;
+		u32				dataLen;
+		bool			fromHeap;	// arena was full
+		void			* payload;	// pooled payload sent without copying, the queue holds a reference
+
+		void *	data()	{ return payload ? payload : (dataLen ? (this + 1) : nullptr); }
+	};
+
+	typedef void (* DeliverCallback)(Message * msg);
+
+	PluginMessageQueue();
+	~PluginMessageQueue();
+
+	// copies data, safe to call from any thread
+	void	push(PluginHandle sender, PluginHandle receiver, u32 type, const void * data, u32 dataLen);
+	// retains payload (from g_payloadPool) until it has been delivered instead of copying it
+	void	pushPayload(PluginHandle sender, PluginHandle receiver, u32 type, void * payload);
+
+	// game thread only, delivers in the order messages were pushed. returns the number delivered
+	u32		drain(DeliverCallback deliver);
+
+private:
+	PluginMessageQueue(const PluginMessageQueue &) = delete;
+	PluginMessageQueue & operator=(const PluginMessageQueue &) = delete;
+
+	void	push(PluginHandle sender, PluginHandle receiver, u32 type, const void * data, u32 dataLen, void * payload);
+
+	enum
+	{
+		kArenaSize =	256 * 1024,
+		kAlignment =	16,
+	};
+
+	struct Arena
+	{
+		u8					* base;
+		std::atomic <size_t>	used;
+		std::atomic <u32>	writers;	// threads copying a message in
+	};
+
+	Arena					m_arenas[2];
+	std::atomic <u32>		m_active;
+	std::atomic <Message *>	m_head;		// newest first
+};
+
+extern PluginMessageQueue g_pluginMessageQueue;
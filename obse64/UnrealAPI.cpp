@@ -1,12 +1,12 @@
 #include "UnrealAPI.h"
 
-RelocPtr <UEngine> g_ueEngine(0x092B0E48);
+RELOC_STATIC StaticRelocPtr <UEngine> g_ueEngine(0x092B0E48);
 
 typedef void (* _FMemory_Free)(void * buf);
-RelocAddr <_FMemory_Free> FMemory_Free(0x00E30580);
+RELOC_STATIC StaticRelocAddr <_FMemory_Free> FMemory_Free(0x00E30580);
 
 typedef void * (*_FMemory_Alloc)(size_t size, u32 align);
-RelocAddr <_FMemory_Alloc> FMemory_Alloc(0x00E3CFC0);
+RELOC_STATIC StaticRelocAddr <_FMemory_Alloc> FMemory_Alloc(0x00E3CFC0);
 
 void FMemory::Free(void * buf)
 {
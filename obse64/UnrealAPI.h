@@ -18,7 +18,7 @@ class UEngine : public UObject, public FExec
 	// a bunch of stuff
 };
 
-extern RelocPtr <UEngine> g_ueEngine;
+extern StaticRelocPtr <UEngine> g_ueEngine;
 
 // unreal allocator, can be overridden at early startup
 struct FMemory
@@ -21,6 +21,6 @@ void FUObjectHashTable::Unlock()
 	LeaveCriticalSection((CRITICAL_SECTION *)&m_lock);
 }
 
-RelocPtr <FUObjectArray> g_uObjectArray(0x09145160);
+RELOC_STATIC StaticRelocPtr <FUObjectArray> g_uObjectArray(0x09145160);
 
-RelocPtr <FUObjectHashTable> g_uObjectHashTable(0x09145318);
+RELOC_STATIC StaticRelocPtr <FUObjectHashTable> g_uObjectHashTable(0x09145318);
@@ -84,7 +84,7 @@ public:
 
 static_assert(sizeof(FUObjectArray) == 0xB8);
 
-extern RelocPtr <FUObjectArray> g_uObjectArray;
+extern StaticRelocPtr <FUObjectArray> g_uObjectArray;
 
 // 30
 class UField : public UObject
@@ -195,4 +195,4 @@ public:
 
 static_assert(sizeof(FUObjectHashTable) == 0x260);
 
-extern RelocPtr <FUObjectHashTable> g_uObjectHashTable;
+extern StaticRelocPtr <FUObjectHashTable> g_uObjectHashTable;
@@ -83,7 +83,7 @@ public:
 	// more stuff I don't care about right now
 };
 
-extern RelocPtr <FNameStorage> g_fnameStorage;
+extern StaticRelocPtr <FNameStorage> g_fnameStorage;
 
 // 20
 class TBitArray
@@ -7,8 +7,11 @@
 #include "obse64_common/SafeWrite.h"
 #include "obse64_common/BranchTrampoline.h"
 #include "obse64_common/CoreInfo.h"
+#include "obse64_common/PatternScan.h"
+#include "obse64_common/PatchRegistry.h"
 #include "PluginManager.h"
 #include "SteamInit.h"
+#include "DetourManager.h"
 
 #include "Hooks_Script.h"
 #include "Hooks_Version.h"
@@ -105,6 +108,9 @@ void OBSE64_Preinit()
 	_MESSAGE("imagebase = %016I64X", g_moduleHandle);
 	_MESSAGE("reloc mgr imagebase = %016I64X", RelocationManager::s_baseAddr);
 
+	if(RelocationManager::validate())
+		_ERROR("some addresses are outside of the executable image, this build of OBSE64 probably doesn't match the runtime");
+
 #ifdef _DEBUG
 	SetPriorityClass(GetCurrentProcess(), IDLE_PRIORITY_CLASS);
 
@@ -124,9 +130,33 @@ void OBSE64_Preinit()
 		return;
 	}
 
+	// W^X, trampoline memory is only writable inside write windows. off by default, older plugins write to it directly
+	u32 writeProtect = 0;
+	if(getConfigOption_u32("Trampoline", "WriteProtect", &writeProtect) && writeProtect)
+	{
+		_MESSAGE("trampoline write protection enabled");
+
+		g_branchTrampoline.setWriteProtect(true);
+		g_localTrampoline.setWriteProtect(true);
+	}
+
+	// counts calls to every detoured function, for profiling. costs a locked increment per call
+	u32 countCalls = 0;
+	if(getConfigOption_u32("Detours", "CountCalls", &countCalls) && countCalls)
+	{
+		_MESSAGE("detour call counting enabled");
+
+		g_detourManager.setCountCalls(true);
+	}
+
+	// pattern results from the last run, dropped automatically if the executable changed
+	g_patternCache.open((getRuntimeDirectory() + "OBSE\\patterncache.bin").c_str());
+
 	// scan plugin folder
 	g_pluginManager.init();
 
+	g_patchRegistry.setOwnerNameCallback([](u32 owner) { return g_pluginManager.pluginNameFromHandle(owner); });
+
 	// preload plugins
 	g_pluginManager.installPlugins(PluginManager::kPhase_Preload);
 
@@ -141,15 +171,33 @@ void OBSE64_Initialize()
 
 	SteamInit(2623190);	// fixed appid?
 
-	// load plugins
-	g_pluginManager.installPlugins(PluginManager::kPhase_Load);
-	g_pluginManager.loadComplete();
+	{
+		// trampoline pages written by plugins and our hooks are only unprotected once, nothing runs through them yet
+		BranchTrampoline::WriteBatch branchBatch(g_branchTrampoline);
+		BranchTrampoline::WriteBatch localBatch(g_localTrampoline);
+
+		// load plugins
+		g_pluginManager.installPlugins(PluginManager::kPhase_Load);
+		g_pluginManager.loadComplete();
+
+		// one protection change per page for all of our patches, also flushes the instruction cache
+		PatchTransaction patches;
+
+		Hooks_Script_Apply();
+		Hooks_Version_Apply();
+		Hooks_Gameplay_Apply();
+
+		patches.commit();
+	}
+
+	g_patternCache.save();
 
-	Hooks_Script_Apply();
-	Hooks_Version_Apply();
-	Hooks_Gameplay_Apply();
+	u32 dumpPatches = 0;
+	if(getConfigOption_u32("Debug", "DumpPatches", &dumpPatches) && dumpPatches)
+		g_patchRegistry.dump();
 
-	FlushInstructionCache(GetCurrentProcess(), NULL, 0);
+	// prefill the vtable -> class name cache
+	indexObjectClassNames();
 
 	_MESSAGE("init complete");
 
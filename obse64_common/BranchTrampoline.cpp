@@ -1,6 +1,9 @@
 #include "BranchTrampoline.h"
 #include "SafeWrite.h"
+#include "PatchRegistry.h"
+#include <algorithm>
 #include <climits>
+#include <mutex>
 #include <Windows.h>
 #include "obse64_common/Log.h"
 #include "obse64_common/Errors.h"
@@ -8,32 +11,77 @@
 BranchTrampoline g_branchTrampoline;
 BranchTrampoline g_localTrampoline;
 
-BranchTrampoline::BranchTrampoline()
-	:m_base(nullptr)
-	, m_len(0)
-	, m_allocated(0)
-	, m_curAlloc(nullptr)
+// largest 32-bit displacement with 128MB scratch space
+static const uintptr_t kMaxDisplacement = 0x80000000 - (1024 * 1024 * 128);
+
+static bool IsInRange(uintptr_t target, uintptr_t start, uintptr_t end)
 {
-	//
+	uintptr_t low = (target >= kMaxDisplacement) ? target - kMaxDisplacement : 0;
+	uintptr_t high = target + kMaxDisplacement;
+
+	return (start >= low) && (end <= high);
 }
 
-BranchTrampoline::~BranchTrampoline()
+static size_t GetAllocationGranularity()
 {
-	destroy();
+	static size_t s_granularity = 0;
+
+	if (!s_granularity)
+	{
+		SYSTEM_INFO info;
+		GetSystemInfo(&info);
+
+		s_granularity = info.dwAllocationGranularity;
+	}
+
+	return s_granularity;
 }
 
-bool BranchTrampoline::create(size_t len, void * module)
+static size_t GetPageSize()
 {
-	if (!module) module = GetModuleHandle(NULL);
+	static size_t s_pageSize = 0;
+
+	if (!s_pageSize)
+	{
+		SYSTEM_INFO info;
+		GetSystemInfo(&info);
+
+		s_pageSize = info.dwPageSize;
+	}
+
+	return s_pageSize;
+}
+
+// pages are sorted, runs of adjacent pages are changed with one call
+static void ProtectPages(const std::vector <uintptr_t> & pages, DWORD protect)
+{
+	size_t pageSize = GetPageSize();
+
+	for (size_t i = 0; i < pages.size(); )
+	{
+		uintptr_t start = pages[i];
+		uintptr_t end = start + pageSize;
+
+		for (i++; (i < pages.size()) && (pages[i] == end); i++)
+			end += pageSize;
+
+		DWORD oldProtect;
+		if (!VirtualProtect((void *)start, end - start, protect, &oldProtect))
+			_ERROR("trampoline protect %016I64X (%016I64X bytes) failed (%08X)", start, end - start, GetLastError());
+	}
+}
+
+// find and map len bytes of free address space near target, first below then above it
+static void * AllocateNear(uintptr_t target, size_t len, DWORD protect)
+{
+	uintptr_t granularity = GetAllocationGranularity();
+	uintptr_t lowestOKAddress = (target >= kMaxDisplacement) ? target - kMaxDisplacement : 0;
+	uintptr_t highestOKAddress = target + kMaxDisplacement;
 
-	// search backwards from module base
-	uintptr_t moduleBase = uintptr_t(module);
-	uintptr_t addr = moduleBase;
-	uintptr_t maxDisplacement = 0x80000000 - (1024 * 1024 * 128); // largest 32-bit displacement with 128MB scratch space
-	uintptr_t lowestOKAddress = (moduleBase >= maxDisplacement) ? moduleBase - maxDisplacement : 0;
-	addr--;
+	// search backwards from target
+	uintptr_t addr = target - 1;
 
-	while (!m_base)
+	while (addr >= lowestOKAddress)
 	{
 		MEMORY_BASIC_INFORMATION info;
 
@@ -46,93 +94,713 @@ bool BranchTrampoline::create(size_t len, void * module)
 		if (info.State == MEM_FREE)
 		{
 			// free block, big enough?
-			if (info.RegionSize >= len)
+			uintptr_t blockStart = uintptr_t(info.BaseAddress);
+			uintptr_t allocAddr = (blockStart + info.RegionSize - len) & ~(granularity - 1);
+
+			if ((info.RegionSize >= len) && (allocAddr >= blockStart) && (allocAddr >= lowestOKAddress))
 			{
 				// try to allocate it
-				addr = ((uintptr_t)info.BaseAddress) + info.RegionSize - len;
-
-				m_base = (void *)VirtualAlloc((void *)addr, len, MEM_COMMIT | MEM_RESERVE, PAGE_EXECUTE_READWRITE);
-				if (m_base)
-				{
-					m_len = len;
-					m_allocated = 0;
-				}
-				else
-				{
-					_WARNING("trampoline alloc %016I64Xx%016I64X failed (%08X)", addr, len, GetLastError());
-				}
+				void * result = VirtualAlloc((void *)allocAddr, len, MEM_COMMIT | MEM_RESERVE, protect);
+				if (result)
+					return result;
+
+				_WARNING("trampoline alloc %016I64Xx%016I64X failed (%08X)", allocAddr, len, GetLastError());
 			}
 		}
 
 		// move back and try again
-		if (!m_base)
+		if (!info.BaseAddress)
+			break;
+
+		addr = uintptr_t(info.BaseAddress) - 1;
+	}
+
+	// then forwards
+	addr = (target + granularity - 1) & ~(granularity - 1);
+
+	while (addr + len <= highestOKAddress)
+	{
+		MEMORY_BASIC_INFORMATION info;
+
+		if (!VirtualQuery((void *)addr, &info, sizeof(info)))
 		{
-			addr = ((uintptr_t)info.BaseAddress) - 1;
+			_ERROR("VirtualQuery failed: %08X", GetLastError());
+			break;
 		}
 
-		if (addr < lowestOKAddress)
+		if (info.State == MEM_FREE)
 		{
-			_ERROR("couldn't allocate trampoline, no free space before image");
-			break;
+			uintptr_t allocAddr = (uintptr_t(info.BaseAddress) + granularity - 1) & ~(granularity - 1);
+
+			if ((allocAddr + len <= uintptr_t(info.BaseAddress) + info.RegionSize) && (allocAddr + len <= highestOKAddress))
+			{
+				void * result = VirtualAlloc((void *)allocAddr, len, MEM_COMMIT | MEM_RESERVE, protect);
+				if (result)
+					return result;
+
+				_WARNING("trampoline alloc %016I64Xx%016I64X failed (%08X)", allocAddr, len, GetLastError());
+			}
 		}
+
+		addr = uintptr_t(info.BaseAddress) + info.RegionSize;
 	}
 
-	return m_base != nullptr;
+	_ERROR("couldn't allocate trampoline, no free space within 2GB of %016I64X", target);
+
+	return nullptr;
+}
+
+// per-thread bump chunks, keyed by pool
+struct ThreadChunk
+{
+	const BranchTrampoline	* owner;
+	u32						generation;
+	u8						* cur;
+	u8						* end;
+};
+
+enum
+{
+	kMaxThreadChunks = 4,	// enough for the global pools plus a couple of plugin owned ones
+};
+
+static thread_local ThreadChunk s_threadChunks[kMaxThreadChunks];
+
+BranchTrampoline::BranchTrampoline()
+	:m_numRegions(0)
+	, m_freeBytes(0)
+	, m_sharedBranches(0)
+	, m_sharedSaved(0)
+	, m_batchDepth(0)
+	, m_writeProtect(false)
+	, m_generation(0)
+	, m_module(0)
+	, m_growLen(0)
+	, m_curAlloc(nullptr)
+	, m_curAllocEnd(nullptr)
+{
+	//
+}
+
+BranchTrampoline::~BranchTrampoline()
+{
+	destroy();
+}
+
+size_t BranchTrampoline::Region::used() const
+{
+	size_t result = allocated.load(std::memory_order_relaxed);
+
+	return (result < len) ? result : len;
+}
+
+bool BranchTrampoline::create(size_t len, void * module)
+{
+	if (!module) module = GetModuleHandle(NULL);
+
+	m_module = uintptr_t(module);
+	m_growLen = len;
+
+	return addRegion(m_module, len) != nullptr;
 }
 
+// not thread safe, nothing else can be using the pool
 void BranchTrampoline::destroy()
 {
-	if (m_base)
+	u32 numRegions = m_numRegions.load(std::memory_order_acquire);
+
+	for (u32 i = 0; i < numRegions; i++)
 	{
-		VirtualFree(m_base, 0, MEM_RELEASE);
-		m_base = nullptr;
+		Region & region = m_regions[i];
+
+		if (region.owned)
+			VirtualFree(region.base, 0, MEM_RELEASE);
 	}
+
+	m_numRegions.store(0, std::memory_order_release);
+	m_generation.fetch_add(1);
+
+	m_growLen = 0;
+	m_curAlloc = nullptr;
+	m_curAllocEnd = nullptr;
+
+	for (auto & list : m_freeLists)
+		list.clear();
+
+	m_freeLarge.clear();
+	m_freeBytes.store(0);
+
+	m_sharedSlots.clear();
+	m_sharedBranches.store(0);
+	m_sharedSaved.store(0);
+
+	m_writablePages.clear();
+	m_batchDepth = 0;
 }
 
 void BranchTrampoline::setBase(size_t len, void * base)
 {
-	ASSERT(!m_base);
-	m_base = base;
-	m_len = len;
-	m_allocated = 0;
+	ASSERT(!m_numRegions.load());
+
+	Region & region = m_regions[0];
+
+	region.base = (u8 *)base;
+	region.len = len;
+	region.allocated.store(0, std::memory_order_relaxed);
+	region.owned = false;
+
+	m_module = uintptr_t(base);
+	m_growLen = 0;
 	m_curAlloc = nullptr;
+	m_curAllocEnd = nullptr;
+
+	m_generation.fetch_add(1);
+	m_numRegions.store(1, std::memory_order_release);
+}
+
+// call with m_growLock held, or before the pool is shared
+BranchTrampoline::Region * BranchTrampoline::addRegion(uintptr_t target, size_t len)
+{
+	u32 numRegions = m_numRegions.load(std::memory_order_acquire);
+
+	if (numRegions >= kMaxRegions)
+	{
+		_ERROR("trampoline region limit reached");
+		return nullptr;
+	}
+
+	uintptr_t granularity = GetAllocationGranularity();
+	len = (len + granularity - 1) & ~(granularity - 1);
+
+	void * base = AllocateNear(target, len, m_writeProtect ? PAGE_EXECUTE_READ : PAGE_EXECUTE_READWRITE);
+	if (!base)
+		return nullptr;
+
+	Region & region = m_regions[numRegions];
+
+	region.base = (u8 *)base;
+	region.len = len;
+	region.allocated.store(0, std::memory_order_relaxed);
+	region.owned = true;
+
+	// publish
+	m_numRegions.store(numRegions + 1, std::memory_order_release);
+
+	if (numRegions)
+		_MESSAGE("added trampoline region %d at %016I64X (%016I64X bytes) for %016I64X", numRegions + 1, base, len, target);
+
+	return &region;
+}
+
+void BranchTrampoline::setWriteProtect(bool enable)
+{
+	std::lock_guard <std::mutex> lock(m_protectLock);
+
+	if (enable == m_writeProtect)
+		return;
+
+	ASSERT(m_writablePages.empty());
+
+	m_writeProtect = enable;
+
+	u32 numRegions = m_numRegions.load(std::memory_order_acquire);
+
+	for (u32 i = 0; i < numRegions; i++)
+	{
+		Region & region = m_regions[i];
+
+		DWORD oldProtect;
+		if (!VirtualProtect(region.base, region.len, enable ? PAGE_EXECUTE_READ : PAGE_EXECUTE_READWRITE, &oldProtect))
+			_ERROR("trampoline protect %016I64X (%016I64X bytes) failed (%08X)", region.base, region.len, GetLastError());
+	}
+}
+
+void BranchTrampoline::beginWrite(const void * ptr, size_t len)
+{
+	if (!m_writeProtect || !len)
+		return;
+
+	size_t pageSize = GetPageSize();
+	uintptr_t start = uintptr_t(ptr) & ~(pageSize - 1);
+	uintptr_t end = (uintptr_t(ptr) + len + pageSize - 1) & ~(pageSize - 1);
+
+	std::vector <uintptr_t> newPages;
+
+	std::lock_guard <std::mutex> lock(m_protectLock);
+
+	for (uintptr_t page = start; page < end; page += pageSize)
+	{
+		auto result = m_writablePages.emplace(page, 0);
+		if (result.second)
+			newPages.push_back(page);
+
+		result.first->second++;
+	}
+
+	ProtectPages(newPages, PAGE_EXECUTE_READWRITE);
+}
+
+void BranchTrampoline::endWrite(const void * ptr, size_t len)
+{
+	if (!m_writeProtect || !len)
+		return;
+
+	size_t pageSize = GetPageSize();
+	uintptr_t start = uintptr_t(ptr) & ~(pageSize - 1);
+	uintptr_t end = (uintptr_t(ptr) + len + pageSize - 1) & ~(pageSize - 1);
+
+	FlushInstructionCache(GetCurrentProcess(), ptr, len);
+
+	std::lock_guard <std::mutex> lock(m_protectLock);
+
+	for (uintptr_t page = start; page < end; page += pageSize)
+	{
+		auto iter = m_writablePages.find(page);
+
+		ASSERT((iter != m_writablePages.end()) && iter->second);
+
+		iter->second--;
+	}
+
+	if (!m_batchDepth)
+		restorePages_Locked();
 }
 
-void * BranchTrampoline::startAlloc()
+void BranchTrampoline::beginBatch()
 {
-	ASSERT(m_base);
+	std::lock_guard <std::mutex> lock(m_protectLock);
+
+	m_batchDepth++;
+}
+
+void BranchTrampoline::endBatch()
+{
+	std::lock_guard <std::mutex> lock(m_protectLock);
+
+	ASSERT(m_batchDepth);
+
+	if (!--m_batchDepth)
+		restorePages_Locked();
+}
+
+void BranchTrampoline::restorePages_Locked()
+{
+	std::vector <uintptr_t> pages;
+
+	for (auto iter = m_writablePages.begin(); iter != m_writablePages.end(); )
+	{
+		if (!iter->second)
+		{
+			pages.push_back(iter->first);
+			iter = m_writablePages.erase(iter);
+		}
+		else
+		{
+			++iter;
+		}
+	}
+
+	std::sort(pages.begin(), pages.end());
+
+	ProtectPages(pages, PAGE_EXECUTE_READ);
+}
+
+size_t BranchTrampoline::remain()
+{
+	size_t result = 0;
+	u32 numRegions = m_numRegions.load(std::memory_order_acquire);
+
+	for (u32 i = 0; i < numRegions; i++)
+		result += m_regions[i].len - m_regions[i].used();
+
+	return result;
+}
+
+void BranchTrampoline::getStats(Stats * out)
+{
+	u32 numRegions = m_numRegions.load(std::memory_order_acquire);
+
+	out->reserved = 0;
+	out->used = 0;
+	out->free = m_freeBytes.load();
+	out->freeBlocks = 0;
+	out->remain = 0;
+	out->numRegions = numRegions;
+	out->sharedBranches = m_sharedBranches.load();
+	out->sharedSaved = m_sharedSaved.load();
+
+	for (u32 i = 0; i < numRegions; i++)
+	{
+		size_t used = m_regions[i].used();
+
+		out->reserved += m_regions[i].len;
+		out->used += used;
+		out->remain += m_regions[i].len - used;
+	}
+
+	out->used -= out->free;
+
+	std::lock_guard <std::mutex> lock(m_freeLock);
+
+	out->freeBlocks = m_freeLarge.size();
+
+	for (auto & list : m_freeLists)
+		out->freeBlocks += list.size();
+}
+
+bool BranchTrampoline::isOwned(const void * ptr, size_t size)
+{
+	u32 numRegions = m_numRegions.load(std::memory_order_acquire);
+
+	for (u32 i = 0; i < numRegions; i++)
+	{
+		Region & region = m_regions[i];
+
+		if ((ptr >= region.base) && ((const u8 *)ptr + size <= region.base + region.used()))
+			return true;
+	}
+
+	return false;
+}
+
+size_t BranchTrampoline::roundSize(size_t size)
+{
+	if (size > kMaxClassSize)
+		return (size + 15) & ~size_t(15);
+
+	size_t result = kMinClassSize;
+	while (result < size)
+		result <<= 1;
+
+	return result;
+}
+
+u8 * BranchTrampoline::allocateFromRegion(Region & region, size_t size)
+{
+	size_t offset = region.allocated.fetch_add(size, std::memory_order_relaxed);
+
+	if (offset + size <= region.len)
+		return region.base + offset;
+
+	// this allocation filled the region, keep the tail
+	if (offset < region.len)
+		addFree(region.base + offset, region.len - offset);
+
+	return nullptr;
+}
+
+u8 * BranchTrampoline::allocateFromRegions(size_t size, uintptr_t target)
+{
+	u32 numRegions = m_numRegions.load(std::memory_order_acquire);
+
+	// newest regions are the most likely to have space
+	for (u32 i = numRegions; i > 0; i--)
+	{
+		Region & region = m_regions[i - 1];
+
+		if ((region.allocated.load(std::memory_order_relaxed) + size <= region.len) &&
+			IsInRange(target, uintptr_t(region.base), uintptr_t(region.base + region.len)))
+		{
+			u8 * result = allocateFromRegion(region, size);
+			if (result)
+				return result;
+		}
+	}
+
+	return nullptr;
+}
+
+u8 * BranchTrampoline::allocateFromThreadChunk(size_t size, uintptr_t target)
+{
+	u32 generation = m_generation.load(std::memory_order_relaxed);
+
+	// find our chunk, or the slot to replace
+	ThreadChunk * chunk = nullptr;
+
+	for (auto & iter : s_threadChunks)
+	{
+		if (iter.owner == this)
+		{
+			chunk = &iter;
+			break;
+		}
+
+		if (!chunk && !iter.owner)
+			chunk = &iter;
+	}
+
+	if (!chunk)
+		return nullptr;
+
+	if ((chunk->owner == this) && (chunk->generation == generation))
+	{
+		if ((chunk->cur + size <= chunk->end) && IsInRange(target, uintptr_t(chunk->cur), uintptr_t(chunk->cur + size)))
+		{
+			u8 * result = chunk->cur;
+			chunk->cur += size;
+
+			return result;
+		}
+
+		// out of space or out of range, give back what's left
+		if (chunk->cur < chunk->end)
+			addFree(chunk->cur, chunk->end - chunk->cur);
+	}
+
+	chunk->owner = nullptr;
+
+	u8 * base = allocateFromRegions(kThreadChunkSize, target);
+	if (!base)
+		return nullptr;
+
+	chunk->owner = this;
+	chunk->generation = generation;
+	chunk->cur = base + size;
+	chunk->end = base + kThreadChunkSize;
+
+	return base;
+}
+
+void BranchTrampoline::addFree(u8 * ptr, size_t size)
+{
+	std::lock_guard <std::mutex> lock(m_freeLock);
+
+	addFree_Locked(ptr, size);
+}
+
+// blocks are split in to the largest classes that fit, so odd sizes aren't lost
+void BranchTrampoline::addFree_Locked(u8 * ptr, size_t size)
+{
+	if (size > kMaxClassSize)
+	{
+		FreeBlock block = { ptr, size };
+		m_freeLarge.push_back(block);
+
+		m_freeBytes.fetch_add(size);
+		return;
+	}
+
+	while (size >= kMinClassSize)
+	{
+		u32 idx = kNumSizeClasses - 1;
+		while (size_t(kMinClassSize << idx) > size)
+			idx--;
+
+		size_t classSize = kMinClassSize << idx;
+
+		m_freeLists[idx].push_back(ptr);
+		m_freeBytes.fetch_add(classSize);
+
+		ptr += classSize;
+		size -= classSize;
+	}
+
+	// anything smaller than the minimum class can't be reused
+}
+
+void * BranchTrampoline::allocateFromFree(size_t size, uintptr_t target)
+{
+	std::lock_guard <std::mutex> lock(m_freeLock);
+
+	if (size <= kMaxClassSize)
+	{
+		u32 idx = 0;
+		while (size_t(kMinClassSize << idx) < size)
+			idx++;
+
+		auto & list = m_freeLists[idx];
+
+		// most recently released first
+		for (size_t i = list.size(); i > 0; i--)
+		{
+			u8 * ptr = list[i - 1];
+
+			if (IsInRange(target, uintptr_t(ptr), uintptr_t(ptr + size)))
+			{
+				list[i - 1] = list.back();
+				list.pop_back();
+
+				m_freeBytes.fetch_sub(size);
+
+				return ptr;
+			}
+		}
+	}
+	else
+	{
+		for (size_t i = 0; i < m_freeLarge.size(); i++)
+		{
+			FreeBlock block = m_freeLarge[i];
+
+			if ((block.size >= size) && IsInRange(target, uintptr_t(block.ptr), uintptr_t(block.ptr + size)))
+			{
+				m_freeLarge[i] = m_freeLarge.back();
+				m_freeLarge.pop_back();
+
+				m_freeBytes.fetch_sub(block.size);
+
+				// put back the tail
+				if (block.size > size)
+					addFree_Locked(block.ptr + size, block.size - size);
+
+				return block.ptr;
+			}
+		}
+	}
+
+	return nullptr;
+}
+
+void BranchTrampoline::release(void * ptr, size_t size)
+{
+	if (!ptr || !size)
+		return;
+
+	size = roundSize(size);
+
+	if (!isOwned(ptr, size))
+	{
+		_ERROR("trampoline release of %016I64X (%016I64X bytes) outside of any region", ptr, size);
+		return;
+	}
+
+	addFree((u8 *)ptr, size);
+}
+
+void * BranchTrampoline::startAlloc(size_t minSize)
+{
+	ASSERT(m_numRegions.load());
 	ASSERT(!m_curAlloc);
 
-	m_curAlloc = ((u8 *)m_base) + m_allocated;
+	std::lock_guard <std::mutex> lock(m_growLock);
+
+	// regions added by allocate(size, target) can be anywhere, only use the ones callers of this can reach
+	// the window takes everything left in the region, so concurrent sized allocations can't land in the middle
+	Region * region = nullptr;
+	size_t offset = 0;
+
+	Region * largest = nullptr;
+	size_t largestRemain = 0;
+
+	for (u32 i = m_numRegions.load(std::memory_order_acquire); i > 0; i--)
+	{
+		Region & candidate = m_regions[i - 1];
+
+		if (!IsInRange(m_module, uintptr_t(candidate.base), uintptr_t(candidate.base + candidate.len)))
+			continue;
+
+		size_t remain = candidate.len - candidate.used();
+
+		if (remain >= minSize)
+		{
+			offset = candidate.allocated.exchange(candidate.len);
+
+			// lost a race with a sized allocation, keep looking
+			if (offset + minSize <= candidate.len)
+			{
+				region = &candidate;
+				break;
+			}
+
+			if (offset < candidate.len)
+				addFree(candidate.base + offset, candidate.len - offset);
+		}
+		else if (remain > largestRemain)
+		{
+			largest = &candidate;
+			largestRemain = remain;
+		}
+	}
+
+	if (!region)
+	{
+		if (m_growLen)
+		{
+			region = addRegion(m_module, (minSize > m_growLen) ? minSize : m_growLen);
+			ASSERT(region);
+
+			offset = region->allocated.exchange(region->len);
+		}
+		else
+		{
+			// fixed size pool, take the most that's left
+			region = largest ? largest : &m_regions[0];
+
+			offset = region->allocated.exchange(region->len);
+			if (offset > region->len)
+				offset = region->len;
+		}
+	}
+
+	m_curAlloc = region->base + offset;
+	m_curAllocEnd = region->base + region->len;
 
 	return m_curAlloc;
 }
 
 void BranchTrampoline::endAlloc(const void * end)
 {
-	ASSERT(m_base);
 	ASSERT(m_curAlloc);
 
-	size_t len = uintptr_t(end) - uintptr_t(m_curAlloc);
-	ASSERT(len <= remain());
+	ASSERT((end >= m_curAlloc) && (end <= m_curAllocEnd));
+
+	// give back the unused part. callers end wherever their code did, blocks split from an unaligned tail would
+	// break the aligned slots and jump cells allocated from them later
+	u8 * tail = (u8 *)((uintptr_t(end) + 15) & ~uintptr_t(15));
+
+	if (tail < m_curAllocEnd)
+		addFree(tail, m_curAllocEnd - tail);
 
-	m_allocated += len;
 	m_curAlloc = nullptr;
+	m_curAllocEnd = nullptr;
 }
 
 void * BranchTrampoline::allocate(size_t size)
 {
-	ASSERT(m_base);
+	return allocate(size, m_module);
+}
+
+void * BranchTrampoline::allocate(size_t size, uintptr_t target)
+{
+	ASSERT(m_numRegions.load());
+
+	size = roundSize(size);
 
 	void * result = nullptr;
 
-	if (size <= remain())
+	if (m_freeBytes.load(std::memory_order_relaxed))
 	{
-		result = ((u8 *)m_base) + m_allocated;
-		m_allocated += size;
+		result = allocateFromFree(size, target);
+		if (result)
+			return result;
 	}
 
-	return result;
+	if (size <= kMaxThreadChunkAlloc)
+	{
+		result = allocateFromThreadChunk(size, target);
+		if (result)
+			return result;
+	}
+
+	result = allocateFromRegions(size, target);
+	if (result)
+		return result;
+
+	if (!m_growLen)
+		return nullptr;
+
+	std::lock_guard <std::mutex> lock(m_growLock);
+
+	// someone else may have grown the pool while we waited
+	result = allocateFromRegions(size, target);
+	if (result)
+		return result;
+
+	Region * region = addRegion(target, (size > m_growLen) ? size : m_growLen);
+	if (!region)
+		return nullptr;
+
+	return allocateFromRegion(*region, size);
 }
 
 bool BranchTrampoline::write6Branch(uintptr_t src, uintptr_t dst)
@@ -155,11 +823,68 @@ bool BranchTrampoline::write5Call(uintptr_t src, uintptr_t dst)
 	return write5Branch_Internal(src, dst, 0xE8);
 }
 
+// stubOut is null when looking for a slot, otherwise only stubs are considered
+uintptr_t * BranchTrampoline::findSharedSlot(uintptr_t src, uintptr_t dst, u8 ** stubOut)
+{
+	std::lock_guard <std::mutex> lock(m_sharedLock);
+
+	auto iter = m_sharedSlots.find(dst);
+	if (iter == m_sharedSlots.end())
+		return nullptr;
+
+	for (auto & entry : iter->second)
+	{
+		if (stubOut)
+		{
+			if (entry.stub && IsInRange(src, uintptr_t(entry.stub), uintptr_t(entry.stub) + 14))
+			{
+				*stubOut = entry.stub;
+				return entry.slot;
+			}
+		}
+		else if (IsInRange(src, uintptr_t(entry.slot), uintptr_t(entry.slot + 1)))
+		{
+			return entry.slot;
+		}
+	}
+
+	return nullptr;
+}
+
+void BranchTrampoline::addSharedSlot(uintptr_t dst, uintptr_t * slot, u8 * stub)
+{
+	std::lock_guard <std::mutex> lock(m_sharedLock);
+
+	SharedSlot entry = { slot, stub };
+	m_sharedSlots[dst].push_back(entry);
+}
+
 bool BranchTrampoline::write6Branch_Internal(uintptr_t src, uintptr_t dst, u8 op)
 {
 	bool result = false;
 
-	uintptr_t * trampoline = (uintptr_t *)allocate();
+	uintptr_t * trampoline = findSharedSlot(src, dst, nullptr);
+	if (trampoline)
+	{
+		m_sharedBranches.fetch_add(1);
+		m_sharedSaved.fetch_add(sizeof(uintptr_t));
+	}
+	else
+	{
+		trampoline = (uintptr_t *)allocate(sizeof(uintptr_t), src);
+		if (trampoline)
+		{
+			// fill in the slot before anything can branch through it
+			{
+				WriteWindow window(*this, trampoline, sizeof(*trampoline));
+
+				*trampoline = dst;
+			}
+
+			addSharedSlot(dst, trampoline, nullptr);
+		}
+	}
+
 	if (trampoline)
 	{
 		uintptr_t	trampolineAddr = (uintptr_t)trampoline;
@@ -175,9 +900,9 @@ bool BranchTrampoline::write6Branch_Internal(uintptr_t src, uintptr_t dst, u8 op
 			code[1] = op;
 			*((s32 *)&code[2]) = (s32)trampolineDispl;
 
-			safeWriteBuf(src, code, sizeof(code));
+			PatchRegistry::KindScope kind((op == 0x15) ? "call6" : "branch6");
 
-			*trampoline = dst;
+			safeWriteBuf(src, code, sizeof(code));
 
 			result = true;
 		}
@@ -230,11 +955,34 @@ bool BranchTrampoline::write5Branch_Internal(uintptr_t src, uintptr_t dst, u8 op
 	STATIC_ASSERT(sizeof(TrampolineCode) == 14);
 	STATIC_ASSERT(sizeof(HookCode) == 5);
 
-	TrampolineCode * trampolineCode = (TrampolineCode *)allocate(sizeof(TrampolineCode));
-	if (trampolineCode)
+	u8 * sharedStub = nullptr;
+	TrampolineCode * trampolineCode = nullptr;
+
+	if (findSharedSlot(src, dst, &sharedStub))
+	{
+		trampolineCode = (TrampolineCode *)sharedStub;
+
+		m_sharedBranches.fetch_add(1);
+		m_sharedSaved.fetch_add(sizeof(TrampolineCode));
+	}
+	else
 	{
-		trampolineCode->Init(dst);
+		trampolineCode = (TrampolineCode *)allocate(sizeof(TrampolineCode), src);
+		if (trampolineCode)
+		{
+			{
+				WriteWindow window(*this, trampolineCode, sizeof(*trampolineCode));
 
+				trampolineCode->Init(dst);
+			}
+
+			// the target address in the stub doubles as a slot for write6
+			addSharedSlot(dst, (uintptr_t *)&trampolineCode->dst, (u8 *)trampolineCode);
+		}
+	}
+
+	if (trampolineCode)
+	{
 		HookCode hookCode;
 
 		uintptr_t	trampolineAddr = uintptr_t(trampolineCode);
@@ -246,6 +994,8 @@ bool BranchTrampoline::write5Branch_Internal(uintptr_t src, uintptr_t dst, u8 op
 
 		hookCode.Init(trampolineDispl, op);
 
+		PatchRegistry::KindScope kind((op == 0xE8) ? "call5" : "branch5");
+
 		safeWriteBuf(src, &hookCode, sizeof(hookCode));
 
 		result = true;
@@ -1,24 +1,114 @@
 #pragma once
 
 #include "obse64_common/Types.h"
+#include <atomic>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
 
+// a pool of regions, each within +/- 2GB of the code that branches in to it
+// when no region in range has space, a new one is added near the target
+// sized allocations are rounded up to a size class so released blocks can be reused exactly
+// allocate and release are thread safe. small allocations come from per-thread chunks, everything else is an
+// atomic bump in a region, so locks are only taken to add a region or when released blocks are waiting
+// with write protection on, regions are read/execute and code must write to them inside a write window
 class BranchTrampoline
 {
 public:
+	// makes a range writable for the lifetime of the object
+	class WriteWindow
+	{
+	public:
+		WriteWindow(BranchTrampoline & owner, const void * ptr, size_t len)
+			:m_owner(owner), m_ptr(ptr), m_len(len) { m_owner.beginWrite(m_ptr, m_len); }
+		~WriteWindow() { m_owner.endWrite(m_ptr, m_len); }
+
+	private:
+		WriteWindow(const WriteWindow &) = delete;
+		WriteWindow & operator=(const WriteWindow &) = delete;
+
+		BranchTrampoline	& m_owner;
+		const void			* m_ptr;
+		size_t				m_len;
+	};
+
+	class WriteBatch
+	{
+	public:
+		explicit WriteBatch(BranchTrampoline & owner) :m_owner(owner) { m_owner.beginBatch(); }
+		~WriteBatch() { m_owner.endBatch(); }
+
+	private:
+		WriteBatch(const WriteBatch &) = delete;
+		WriteBatch & operator=(const WriteBatch &) = delete;
+
+		BranchTrampoline	& m_owner;
+	};
+
+	struct Stats
+	{
+		size_t	reserved;	// total size of all regions
+		size_t	used;		// handed out and not released, includes unused space in per-thread chunks
+		size_t	free;		// released and waiting to be reused
+		size_t	freeBlocks;
+		size_t	remain;		// never handed out
+		u32		numRegions;
+
+		size_t	sharedBranches;	// write5/write6 calls that reused an existing slot or stub
+		size_t	sharedSaved;	// bytes not allocated because of that
+	};
+
 	BranchTrampoline();
 	~BranchTrampoline();
 
+	// len is the size of the first region and of each region added later
 	bool create(size_t len, void * module = nullptr);
 	void destroy();
+
+	// use an existing block of memory. the pool won't grow past it
 	void setBase(size_t len, void* base);
 
-	// allocate unsized
-	void * startAlloc();
+	enum
+	{
+		kDefaultStartAllocSize = 4096,
+	};
+
+	// allocate unsized, claims the rest of a region reachable from the module passed to create until endAlloc
+	// the window is at least minSize bytes, a region is added if none has that much left. a fixed size pool
+	// returns whatever is left, which may be nothing
+	void * startAlloc(size_t minSize = kDefaultStartAllocSize);
 	void endAlloc(const void * end);
 
+	// reachable from the module passed to create
 	void * allocate(size_t size = sizeof(void *));
 
-	size_t remain() { return m_len - m_allocated; }
+	// reachable with a rel32 displacement from target
+	void * allocate(size_t size, uintptr_t target);
+
+	// size must match what was passed to allocate
+	void release(void * ptr, size_t size);
+
+	// total over all regions
+	size_t remain();
+	void getStats(Stats * out);
+	u32 numRegions() { return m_numRegions.load(std::memory_order_acquire); }
+
+	// W^X mode, regions stay read/execute outside of write windows. call before the pool is in use
+	void setWriteProtect(bool enable);
+	bool writeProtected() const { return m_writeProtect; }
+
+	// makes [ptr, ptr + len) writable until the matching endWrite, does nothing when write protection is off
+	// pages are reference counted, so nested and overlapping windows only change the protection once
+	// pages stay executable while writable, other code on the same page may be running
+	void beginWrite(const void * ptr, size_t len);
+	void endWrite(const void * ptr, size_t len);
+
+	// while a batch is open, pages stay writable after their last window closes and are restored together when
+	// the batch ends. any number of writes inside a batch costs at most one protection change per page
+	void beginBatch();
+	void endBatch();
+
+	// branches to the same dst share trampoline space when it's in range
 
 	// takes 6 bytes of space at src, 8 bytes in trampoline
 	bool write6Branch(uintptr_t src, uintptr_t dst);
@@ -35,11 +125,95 @@ private:
 	// takes 5 bytes of space at src, 14 bytes in trampoline
 	bool write5Branch_Internal(uintptr_t src, uintptr_t dst, u8 op);
 
-	void	* m_base;
-	size_t	m_len;			// bytes
-	size_t	m_allocated;	// bytes
+	enum
+	{
+		kMaxRegions = 64,
+
+		// 8 16 32 ... 4096, larger blocks are kept in one first fit list
+		kNumSizeClasses = 10,
+		kMinClassSize = 8,
+		kMaxClassSize = kMinClassSize << (kNumSizeClasses - 1),
+
+		// allocations up to this size come from per-thread chunks
+		kThreadChunkSize = 4096,
+		kMaxThreadChunkAlloc = 256,
+	};
+
+	struct FreeBlock
+	{
+		u8		* ptr;
+		size_t	size;
+	};
+
+	struct Region
+	{
+		u8		* base;
+		size_t	len;	// bytes
+		bool	owned;	// false for setBase
+
+		// bytes, may run past len when the region fills up
+		std::atomic <size_t>	allocated;
+
+		size_t	used() const;
+	};
+
+	Region	* addRegion(uintptr_t target, size_t len);
+	bool	isOwned(const void * ptr, size_t size);
+
+	static size_t	roundSize(size_t size);
+
+	// bump allocation only
+	u8		* allocateFromRegion(Region & region, size_t size);
+	u8		* allocateFromRegions(size_t size, uintptr_t target);
+	u8		* allocateFromThreadChunk(size_t size, uintptr_t target);
+
+	void	addFree(u8 * ptr, size_t size);
+	void	addFree_Locked(u8 * ptr, size_t size);
+	void	* allocateFromFree(size_t size, uintptr_t target);
+
+	// 8-byte absolute address slot, and the 14-byte jmp [rip] stub it's part of if there is one
+	struct SharedSlot
+	{
+		uintptr_t	* slot;
+		u8			* stub;
+	};
+
+	uintptr_t	* findSharedSlot(uintptr_t src, uintptr_t dst, u8 ** stubOut);
+	void		addSharedSlot(uintptr_t dst, uintptr_t * slot, u8 * stub);
+
+	// restores every page that isn't in an open window, call with m_protectLock held
+	void		restorePages_Locked();
+
+	Region					m_regions[kMaxRegions];
+	std::atomic <u32>		m_numRegions;	// regions are fully set up before this is incremented
+	std::mutex				m_growLock;
+
+	// free lists live outside of the regions so released code is never written to
+	std::mutex				m_freeLock;
+	std::vector <u8 *>		m_freeLists[kNumSizeClasses];
+	std::vector <FreeBlock>	m_freeLarge;
+	std::atomic <size_t>	m_freeBytes;	// readable without the lock so the fast path can skip it
+
+	// branch destination -> slots
+	std::mutex				m_sharedLock;
+	std::unordered_map <uintptr_t, std::vector <SharedSlot>>	m_sharedSlots;
+	std::atomic <size_t>	m_sharedBranches;
+	std::atomic <size_t>	m_sharedSaved;
+
+	// page -> number of open windows. pages with no windows stay here until the current batch ends
+	std::mutex				m_protectLock;
+	std::unordered_map <uintptr_t, u32>	m_writablePages;
+	u32						m_batchDepth;
+	bool					m_writeProtect;
+
+	// bumped whenever the pool is reset so stale per-thread chunks are dropped
+	std::atomic <u32>		m_generation;
+
+	uintptr_t	m_module;	// default target
+	size_t		m_growLen;	// 0 = fixed size
 
-	void	* m_curAlloc;	// currently active StartAlloc base
+	u8		* m_curAlloc;		// currently active StartAlloc base
+	u8		* m_curAllocEnd;
 };
 
 extern BranchTrampoline g_branchTrampoline;
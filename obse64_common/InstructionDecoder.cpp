@@ -0,0 +1,285 @@
+#include "InstructionDecoder.h"
+#include <cstring>
+
+// per-opcode operand layout
+enum
+{
+	X =		0,			// nothing after the opcode
+	M =		1 << 0,		// modrm
+	I8 =	1 << 1,		// imm8
+	I16 =	1 << 2,		// imm16
+	IZ =	1 << 3,		// imm16/32 by operand size
+	IV =	1 << 4,		// imm16/32/64 by operand size
+	IA =	1 << 5,		// moffs, 32/64 by address size
+	R8 =	1 << 6,		// rel8
+	R32 =	1 << 7,		// rel32
+	G3 =	1 << 8,		// F6/F7, immediate only for /0 and /1
+	BAD =	1 << 9,		// invalid in 64-bit mode
+	PFX =	1 << 10,	// legacy prefix
+	ESC =	1 << 11,	// escape, VEX or EVEX, handled separately
+};
+
+static const u16 kLegacyMap[256] =
+{
+	// 0x00
+	M,		M,		M,		M,		I8,		IZ,		BAD,	BAD,	M,		M,		M,		M,		I8,		IZ,		BAD,	ESC,
+	// 0x10
+	M,		M,		M,		M,		I8,		IZ,		BAD,	BAD,	M,		M,		M,		M,		I8,		IZ,		BAD,	BAD,
+	// 0x20
+	M,		M,		M,		M,		I8,		IZ,		PFX,	BAD,	M,		M,		M,		M,		I8,		IZ,		PFX,	BAD,
+	// 0x30
+	M,		M,		M,		M,		I8,		IZ,		PFX,	BAD,	M,		M,		M,		M,		I8,		IZ,		PFX,	BAD,
+	// 0x40 rex, handled before the table lookup
+	X,		X,		X,		X,		X,		X,		X,		X,		X,		X,		X,		X,		X,		X,		X,		X,
+	// 0x50
+	X,		X,		X,		X,		X,		X,		X,		X,		X,		X,		X,		X,		X,		X,		X,		X,
+	// 0x60
+	BAD,	BAD,	ESC,	M,		PFX,	PFX,	PFX,	PFX,	IZ,		M|IZ,	I8,		M|I8,	X,		X,		X,		X,
+	// 0x70
+	R8,		R8,		R8,		R8,		R8,		R8,		R8,		R8,		R8,		R8,		R8,		R8,		R8,		R8,		R8,		R8,
+	// 0x80
+	M|I8,	M|IZ,	BAD,	M|I8,	M,		M,		M,		M,		M,		M,		M,		M,		M,		M,		M,		M,
+	// 0x90
+	X,		X,		X,		X,		X,		X,		X,		X,		X,		X,		BAD,	X,		X,		X,		X,		X,
+	// 0xA0
+	IA,		IA,		IA,		IA,		X,		X,		X,		X,		I8,		IZ,		X,		X,		X,		X,		X,		X,
+	// 0xB0
+	I8,		I8,		I8,		I8,		I8,		I8,		I8,		I8,		IV,		IV,		IV,		IV,		IV,		IV,		IV,		IV,
+	// 0xC0
+	M|I8,	M|I8,	I16,	X,		ESC,	ESC,	M|I8,	M|IZ,	I16|I8,	X,		I16,	X,		X,		I8,		BAD,	X,
+	// 0xD0
+	M,		M,		M,		M,		BAD,	BAD,	BAD,	X,		M,		M,		M,		M,		M,		M,		M,		M,
+	// 0xE0
+	R8,		R8,		R8,		R8,		I8,		I8,		I8,		I8,		R32,	R32,	BAD,	R8,		X,		X,		X,		X,
+	// 0xF0
+	PFX,	X,		PFX,	PFX,	X,		X,		M|G3,	M|G3,	X,		X,		X,		X,		X,		X,		M,		M,
+};
+
+static const u16 k0FMap[256] =
+{
+	// 0x00
+	M,		M,		M,		M,		BAD,	X,		X,		X,		X,		X,		BAD,	X,		BAD,	M,		X,		M|I8,
+	// 0x10
+	M,		M,		M,		M,		M,		M,		M,		M,		M,		M,		M,		M,		M,		M,		M,		M,
+	// 0x20
+	M,		M,		M,		M,		BAD,	BAD,	BAD,	BAD,	M,		M,		M,		M,		M,		M,		M,		M,
+	// 0x30
+	X,		X,		X,		X,		X,		X,		BAD,	X,		ESC,	BAD,	ESC,	BAD,	BAD,	BAD,	BAD,	BAD,
+	// 0x40
+	M,		M,		M,		M,		M,		M,		M,		M,		M,		M,		M,		M,		M,		M,		M,		M,
+	// 0x50
+	M,		M,		M,		M,		M,		M,		M,		M,		M,		M,		M,		M,		M,		M,		M,		M,
+	// 0x60
+	M,		M,		M,		M,		M,		M,		M,		M,		M,		M,		M,		M,		M,		M,		M,		M,
+	// 0x70
+	M|I8,	M|I8,	M|I8,	M|I8,	M,		M,		M,		X,		M,		M,		BAD,	BAD,	M,		M,		M,		M,
+	// 0x80
+	R32,	R32,	R32,	R32,	R32,	R32,	R32,	R32,	R32,	R32,	R32,	R32,	R32,	R32,	R32,	R32,
+	// 0x90
+	M,		M,		M,		M,		M,		M,		M,		M,		M,		M,		M,		M,		M,		M,		M,		M,
+	// 0xA0
+	X,		X,		X,		M,		M|I8,	M,		BAD,	BAD,	X,		X,		X,		M,		M|I8,	M,		M,		M,
+	// 0xB0
+	M,		M,		M,		M,		M,		M,		M,		M,		M,		M,		M|I8,	M,		M,		M,		M,		M,
+	// 0xC0
+	M,		M,		M|I8,	M,		M|I8,	M|I8,	M|I8,	M,		X,		X,		X,		X,		X,		X,		X,		X,
+	// 0xD0
+	M,		M,		M,		M,		M,		M,		M,		M,		M,		M,		M,		M,		M,		M,		M,		M,
+	// 0xE0
+	M,		M,		M,		M,		M,		M,		M,		M,		M,		M,		M,		M,		M,		M,		M,		M,
+	// 0xF0
+	M,		M,		M,		M,		M,		M,		M,		M,		M,		M,		M,		M,		M,		M,		M,		M,
+};
+
+// VEX and EVEX only use modrm and an optional imm8
+static u16 GetVEXLayout(u32 map, u8 opcode)
+{
+	switch(map)
+	{
+		case DecodedInstruction::kMap_0F:
+			// vzeroupper/vzeroall
+			if(opcode == 0x77)
+				return X;
+
+			if(((opcode >= 0x70) && (opcode <= 0x73)) || (opcode == 0xC2) || ((opcode >= 0xC4) && (opcode <= 0xC6)))
+				return M|I8;
+
+			return M;
+
+		case DecodedInstruction::kMap_0F38:
+			return M;
+
+		case DecodedInstruction::kMap_0F3A:
+			return M|I8;
+
+		case 5:	// EVEX maps 5 and 6 (AVX512-FP16)
+		case 6:
+			return M;
+	}
+
+	return BAD;
+}
+
+bool decodeInstruction(const u8 * code, DecodedInstruction * out)
+{
+	const u32 kMaxLen = 15;
+
+	memset(out, 0, sizeof(*out));
+
+	u32 pos = 0;
+	bool operandSize16 = false;
+	bool addressSize32 = false;
+	bool rexW = false;
+
+	// legacy prefixes
+	while(kLegacyMap[code[pos]] & PFX)
+	{
+		if(code[pos] == 0x66) operandSize16 = true;
+		if(code[pos] == 0x67) addressSize32 = true;
+
+		if(++pos >= kMaxLen)
+			return false;
+	}
+
+	// rex, must come directly before the opcode
+	if((code[pos] & 0xF0) == 0x40)
+	{
+		rexW = (code[pos] & 0x08) != 0;
+		pos++;
+	}
+
+	u8 opcode = code[pos];
+	u16 layout = kLegacyMap[opcode];
+	u32 map = DecodedInstruction::kMap_Legacy;
+
+	if(opcode == 0x0F)
+	{
+		opcode = code[++pos];
+
+		if(opcode == 0x38)
+		{
+			map = DecodedInstruction::kMap_0F38;
+			opcode = code[++pos];
+			layout = M;
+		}
+		else if(opcode == 0x3A)
+		{
+			map = DecodedInstruction::kMap_0F3A;
+			opcode = code[++pos];
+			layout = M|I8;
+		}
+		else
+		{
+			map = DecodedInstruction::kMap_0F;
+			layout = k0FMap[opcode];
+		}
+	}
+	else if((opcode == 0xC4) || (opcode == 0xC5) || (opcode == 0x62))
+	{
+		// always VEX/EVEX in 64-bit mode
+		if(opcode == 0xC4)
+		{
+			map = code[pos + 1] & 0x1F;
+			pos += 3;
+		}
+		else if(opcode == 0xC5)
+		{
+			map = DecodedInstruction::kMap_0F;
+			pos += 2;
+		}
+		else
+		{
+			map = code[pos + 1] & 0x07;
+			pos += 4;
+		}
+
+		opcode = code[pos];
+		layout = GetVEXLayout(map, opcode);
+
+		out->flags |= DecodedInstruction::kFlag_VEX;
+	}
+
+	if(layout & (BAD | ESC))
+		return false;
+
+	out->map = map;
+	out->opcode = opcode;
+	out->opcodeOffset = pos;
+
+	pos++;
+
+	if(layout & M)
+	{
+		u8 modrm = code[pos++];
+		u8 mod = modrm >> 6;
+		u8 rm = modrm & 7;
+
+		out->modrm = modrm;
+		out->flags |= DecodedInstruction::kFlag_ModRM;
+
+		if(mod != 3)
+		{
+			u32 dispSize = 0;
+
+			if(rm == 4)
+			{
+				u8 sib = code[pos++];
+
+				if((mod == 0) && ((sib & 7) == 5))
+					dispSize = 4;
+			}
+			else if((mod == 0) && (rm == 5))
+			{
+				dispSize = 4;
+				out->flags |= DecodedInstruction::kFlag_RIPRelative;
+			}
+
+			if(mod == 1) dispSize = 1;
+			else if(mod == 2) dispSize = 4;
+
+			if(dispSize)
+			{
+				out->dispOffset = pos;
+				out->dispSize = dispSize;
+
+				pos += dispSize;
+			}
+		}
+
+		// test has an immediate, the rest of group 3 doesn't
+		if((layout & G3) && (((modrm >> 3) & 7) < 2))
+			layout |= (opcode == 0xF6) ? I8 : IZ;
+
+		// xbegin
+		if((map == DecodedInstruction::kMap_Legacy) && (opcode == 0xC7) && (modrm == 0xF8))
+			layout = M|R32;
+	}
+
+	u32 immSize = 0;
+
+	if(layout & I8)		immSize += 1;
+	if(layout & I16)	immSize += 2;
+	if(layout & IZ)		immSize += (operandSize16 && !rexW) ? 2 : 4;
+	if(layout & IV)		immSize += rexW ? 8 : (operandSize16 ? 2 : 4);
+	if(layout & IA)		immSize += addressSize32 ? 4 : 8;
+	if(layout & R8)		immSize += 1;
+	if(layout & R32)	immSize += 4;
+
+	if(layout & (R8 | R32))
+		out->flags |= DecodedInstruction::kFlag_RelBranch;
+
+	if(immSize)
+	{
+		out->immOffset = pos;
+		out->immSize = immSize;
+
+		pos += immSize;
+	}
+
+	if(pos > kMaxLen)
+		return false;
+
+	out->len = pos;
+
+	return true;
+}
@@ -0,0 +1,42 @@
+#pragma once
+
+#include "obse64_common/Types.h"
+
+// x86-64 instruction length decoder
+// only decodes as much as is needed to copy instructions somewhere else: total length, where the displacement
+// and immediate are, and whether either of them is relative to the instruction pointer
+struct DecodedInstruction
+{
+	enum
+	{
+		kMap_Legacy = 0,
+		kMap_0F,
+		kMap_0F38,
+		kMap_0F3A,
+	};
+
+	enum
+	{
+		kFlag_ModRM =		1 << 0,
+		kFlag_RIPRelative =	1 << 1,	// modrm disp32 is relative to the end of the instruction
+		kFlag_RelBranch =	1 << 2,	// immediate is a rel8/rel32 branch displacement
+		kFlag_VEX =			1 << 3,	// VEX or EVEX encoded
+	};
+
+	u8	len;
+	u8	flags;
+	u8	map;
+	u8	opcode;
+	u8	opcodeOffset;
+	u8	modrm;
+
+	u8	dispOffset;
+	u8	dispSize;
+	u8	immOffset;
+	u8	immSize;
+
+	bool	hasFlag(u8 flag) const { return (flags & flag) != 0; }
+};
+
+// returns false for invalid or unsupported encodings. reads at most 15 bytes from code
+bool decodeInstruction(const u8 * code, DecodedInstruction * out);
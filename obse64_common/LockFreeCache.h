@@ -0,0 +1,89 @@
+#pragma once
+
+#include "obse64_common/Types.h"
+#include <atomic>
+
+// fixed size, insert only open addressing table that any thread can read and add to without locking
+// keys and values are integers or pointers and zero is reserved in both: a zero key is an empty slot, a zero value
+// a slot that's been claimed but not published yet. a slot is claimed by CASing the key in and the value is stored
+// after that, so a reader that finds the key before the value is visible just misses and takes the slow path
+// the same key can be stored more than once with different values, lookup picks one with a match function
+// when every slot a key can probe is taken, it's never cached
+template <typename Key, typename Value, u32 kSizeBits, u32 kMaxProbes = 16>
+class LockFreeCache
+{
+public:
+	// hash is the caller's, its top bits pick the first slot so they should be well mixed
+	template <typename Match>
+	bool lookup(u64 hash, Key key, Match match, Value * out) const
+	{
+		u32 idx = index(hash);
+
+		for(u32 i = 0; i < kMaxProbes; i++)
+		{
+			auto & entry = m_entries[(idx + i) & kMask];
+
+			Key entryKey = entry.key.load(std::memory_order_acquire);
+			if(!entryKey)
+				break;
+
+			if(entryKey == key)
+			{
+				Value value = entry.value.load(std::memory_order_acquire);
+				if(value && match(value))
+				{
+					*out = value;
+					return true;
+				}
+			}
+		}
+
+		return false;
+	}
+
+	bool lookup(u64 hash, Key key, Value * out) const
+	{
+		return lookup(hash, key, [](Value) { return true; }, out);
+	}
+
+	// returns false if the neighborhood is full
+	bool insert(u64 hash, Key key, Value value)
+	{
+		u32 idx = index(hash);
+
+		for(u32 i = 0; i < kMaxProbes; i++)
+		{
+			auto & entry = m_entries[(idx + i) & kMask];
+
+			Key entryKey = Key();
+			if(entry.key.compare_exchange_strong(entryKey, key, std::memory_order_acq_rel))
+			{
+				entry.value.store(value, std::memory_order_release);
+				return true;
+			}
+
+			// already there. a racing insert of the same entry that isn't published yet may take a second slot
+			if((entryKey == key) && (entry.value.load(std::memory_order_acquire) == value))
+				return true;
+		}
+
+		return false;
+	}
+
+private:
+	enum : u32
+	{
+		kSize = 1u << kSizeBits,
+		kMask = kSize - 1,
+	};
+
+	struct Entry
+	{
+		std::atomic <Key>	key;
+		std::atomic <Value>	value;
+	};
+
+	static u32 index(u64 hash) { return u32(hash >> (64 - kSizeBits)); }
+
+	Entry	m_entries[kSize];
+};
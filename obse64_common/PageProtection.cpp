@@ -0,0 +1,174 @@
+#include "PageProtection.h"
+#include "obse64_common/Log.h"
+
+#ifdef _WIN32
+
+#include <Windows.h>
+
+size_t getPageSize()
+{
+	static size_t s_pageSize = 0;
+
+	if(!s_pageSize)
+	{
+		SYSTEM_INFO info;
+		GetSystemInfo(&info);
+
+		s_pageSize = info.dwPageSize;
+	}
+
+	return s_pageSize;
+}
+
+bool unprotectRange(uintptr_t base, size_t len, std::vector <ProtectedRange> * out)
+{
+	uintptr_t end = base + len;
+	bool result = true;
+
+	while(base < end)
+	{
+		MEMORY_BASIC_INFORMATION info;
+		size_t partLen = end - base;
+
+		if(VirtualQuery((void *)base, &info, sizeof(info)))
+		{
+			uintptr_t regionEnd = uintptr_t(info.BaseAddress) + info.RegionSize;
+			if(regionEnd < end)
+				partLen = regionEnd - base;
+		}
+
+		DWORD oldProtect;
+		if(VirtualProtect((void *)base, partLen, PAGE_EXECUTE_READWRITE, &oldProtect))
+		{
+			ProtectedRange range = { base, partLen, oldProtect };
+			out->push_back(range);
+		}
+		else
+		{
+			_ERROR("unprotectRange: couldn't unprotect %016I64X (%08X)", base, GetLastError());
+			result = false;
+		}
+
+		base += partLen;
+	}
+
+	return result;
+}
+
+void restoreRange(const ProtectedRange & range)
+{
+	DWORD oldProtect;
+	VirtualProtect((void *)range.base, range.len, range.oldProtect, &oldProtect);
+}
+
+void flushCode()
+{
+	FlushInstructionCache(GetCurrentProcess(), NULL, 0);
+}
+
+#else
+
+#include <sys/mman.h>
+#include <unistd.h>
+#include <cerrno>
+#include <cinttypes>
+#include <cstdio>
+
+size_t getPageSize()
+{
+	static size_t s_pageSize = 0;
+
+	if(!s_pageSize)
+		s_pageSize = size_t(sysconf(_SC_PAGESIZE));
+
+	return s_pageSize;
+}
+
+// finds the mapping containing addr, there's no VirtualQuery
+static bool QueryProtection(uintptr_t addr, uintptr_t * regionEnd, u32 * protect)
+{
+	FILE * maps = fopen("/proc/self/maps", "r");
+	if(!maps)
+		return false;
+
+	bool result = false;
+	char line[512];
+
+	while(fgets(line, sizeof(line), maps))
+	{
+		uintptr_t start, end;
+		char perms[5];
+
+		if(sscanf(line, "%" SCNxPTR "-%" SCNxPTR " %4s", &start, &end, perms) != 3)
+			continue;
+
+		if((addr >= start) && (addr < end))
+		{
+			*regionEnd = end;
+			*protect =
+				((perms[0] == 'r') ? PROT_READ : 0) |
+				((perms[1] == 'w') ? PROT_WRITE : 0) |
+				((perms[2] == 'x') ? PROT_EXEC : 0);
+
+			result = true;
+			break;
+		}
+	}
+
+	fclose(maps);
+
+	return result;
+}
+
+bool unprotectRange(uintptr_t base, size_t len, std::vector <ProtectedRange> * out)
+{
+	size_t pageSize = getPageSize();
+
+	// mprotect only takes whole pages, VirtualProtect rounds by itself
+	uintptr_t end = (base + len + pageSize - 1) & ~(pageSize - 1);
+	base &= ~(pageSize - 1);
+
+	bool result = true;
+
+	while(base < end)
+	{
+		uintptr_t regionEnd = end;
+		u32 protect = PROT_READ | PROT_EXEC;
+
+		if(!QueryProtection(base, &regionEnd, &protect))
+		{
+			_ERROR("unprotectRange: %" PRIxPTR " isn't mapped", base);
+			return false;
+		}
+
+		size_t partLen = ((regionEnd < end) ? regionEnd : end) - base;
+
+		if(!mprotect((void *)base, partLen, PROT_READ | PROT_WRITE | PROT_EXEC))
+		{
+			ProtectedRange range = { base, partLen, protect };
+			out->push_back(range);
+		}
+		else
+		{
+			_ERROR("unprotectRange: couldn't unprotect %" PRIxPTR " (%d)", base, errno);
+			result = false;
+		}
+
+		base += partLen;
+	}
+
+	return result;
+}
+
+void restoreRange(const ProtectedRange & range)
+{
+	mprotect((void *)range.base, range.len, int(range.oldProtect));
+}
+
+void flushCode()
+{
+	// x86 keeps instruction fetch coherent with stores, serializing before the code runs is enough. the tests
+	// patch and run code on the same thread
+}
+
+#endif
@@ -0,0 +1,27 @@
+#pragma once
+
+#include "obse64_common/Types.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// the platform specific part of patching code in memory
+// windows uses VirtualQuery/VirtualProtect, everything else /proc/self/maps and mprotect so the code built on
+// this can be tested there
+
+struct ProtectedRange
+{
+	uintptr_t	base;
+	size_t		len;
+	u32			oldProtect;	// platform protection flags, only meaningful to restoreRange
+};
+
+size_t getPageSize();
+
+// makes the pages covering [base, base + len) writable, they stay executable. the range is split by protection
+// region so each part can be restored to what it was. returns false if any part couldn't be changed
+bool unprotectRange(uintptr_t base, size_t len, std::vector <ProtectedRange> * out);
+void restoreRange(const ProtectedRange & range);
+
+// call once after writing code, before it can run
+void flushCode();
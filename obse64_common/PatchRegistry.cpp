@@ -0,0 +1,329 @@
+#include "PatchRegistry.h"
+#include "obse64_common/Log.h"
+#include <algorithm>
+#include <cstring>
+#include <Windows.h>
+
+PatchRegistry g_patchRegistry;
+
+static thread_local u32 s_currentOwner = PatchRegistry::kOwner_OBSE;
+static thread_local const char * s_currentKind = "write";
+
+u32 PatchRegistry::currentOwner()
+{
+	return s_currentOwner;
+}
+
+const char * PatchRegistry::currentKind()
+{
+	return s_currentKind;
+}
+
+PatchRegistry::OwnerScope::OwnerScope(u32 owner)
+	:m_prev(s_currentOwner)
+{
+	s_currentOwner = owner;
+}
+
+PatchRegistry::OwnerScope::~OwnerScope()
+{
+	s_currentOwner = m_prev;
+}
+
+PatchRegistry::KindScope::KindScope(const char * kind)
+	:m_prev(s_currentKind)
+{
+	s_currentKind = kind;
+}
+
+PatchRegistry::KindScope::~KindScope()
+{
+	s_currentKind = m_prev;
+}
+
+PatchRegistry::PatchRegistry()
+	:m_root(kNil)
+	, m_numConflicts(0)
+	, m_ownerName(nullptr)
+{
+	//
+}
+
+PatchRegistry::~PatchRegistry()
+{
+	//
+}
+
+void PatchRegistry::update(s32 node)
+{
+	Node & n = m_nodes[node];
+
+	n.height = 1 + (std::max)(height(n.left), height(n.right));
+	n.maxEnd = n.end;
+
+	if(n.left != kNil) n.maxEnd = (std::max)(n.maxEnd, m_nodes[n.left].maxEnd);
+	if(n.right != kNil) n.maxEnd = (std::max)(n.maxEnd, m_nodes[n.right].maxEnd);
+}
+
+s32 PatchRegistry::rotateLeft(s32 node)
+{
+	s32 pivot = m_nodes[node].right;
+
+	m_nodes[node].right = m_nodes[pivot].left;
+	m_nodes[pivot].left = node;
+
+	update(node);
+	update(pivot);
+
+	return pivot;
+}
+
+s32 PatchRegistry::rotateRight(s32 node)
+{
+	s32 pivot = m_nodes[node].left;
+
+	m_nodes[node].left = m_nodes[pivot].right;
+	m_nodes[pivot].right = node;
+
+	update(node);
+	update(pivot);
+
+	return pivot;
+}
+
+s32 PatchRegistry::rebalance(s32 node)
+{
+	update(node);
+
+	Node & n = m_nodes[node];
+	s32 balance = height(n.left) - height(n.right);
+
+	if(balance > 1)
+	{
+		if(height(m_nodes[n.left].left) < height(m_nodes[n.left].right))
+			n.left = rotateLeft(n.left);
+
+		return rotateRight(node);
+	}
+
+	if(balance < -1)
+	{
+		if(height(m_nodes[n.right].right) < height(m_nodes[n.right].left))
+			n.right = rotateRight(n.right);
+
+		return rotateLeft(node);
+	}
+
+	return node;
+}
+
+// ordered by start, then by recording order so equal ranges keep their history
+s32 PatchRegistry::insert(s32 node, s32 newNode)
+{
+	if(node == kNil)
+		return newNode;
+
+	if(m_nodes[newNode].start < m_nodes[node].start)
+	{
+		s32 child = insert(m_nodes[node].left, newNode);
+		m_nodes[node].left = child;
+	}
+	else
+	{
+		s32 child = insert(m_nodes[node].right, newNode);
+		m_nodes[node].right = child;
+	}
+
+	return rebalance(node);
+}
+
+void PatchRegistry::findOverlaps(s32 node, uintptr_t start, uintptr_t end, std::vector <s32> * out) const
+{
+	// nothing in this subtree ends after start
+	if((node == kNil) || (m_nodes[node].maxEnd <= start))
+		return;
+
+	const Node & n = m_nodes[node];
+
+	findOverlaps(n.left, start, end, out);
+
+	// everything to the right starts at or after this node
+	if(n.start >= end)
+		return;
+
+	if(n.end > start)
+		out->push_back(node);
+
+	findOverlaps(n.right, start, end, out);
+}
+
+void PatchRegistry::record(uintptr_t addr, const void * data, size_t len, u32 owner, const char * kind)
+{
+	if(!len)
+		return;
+
+	FILETIME now;
+	GetSystemTimeAsFileTime(&now);
+
+	std::lock_guard <std::mutex> lock(m_lock);
+
+	Node node;
+
+	node.start = addr;
+	node.end = addr + len;
+	node.maxEnd = node.end;
+	node.left = kNil;
+	node.right = kNil;
+	node.height = 1;
+	node.owner = owner;
+	node.seq = u32(m_nodes.size());
+	node.kind = kind;
+	node.time = (u64(now.dwHighDateTime) << 32) | now.dwLowDateTime;
+	node.dataOffset = m_data.size();
+
+	m_data.resize(m_data.size() + (len * 2));
+
+	u8 * original = &m_data[node.dataOffset];
+	memcpy(original, (const void *)addr, len);
+	memcpy(original + len, data, len);
+
+	std::vector <s32> overlaps;
+	findOverlaps(m_root, node.start, node.end, &overlaps);
+
+	if(!overlaps.empty())
+	{
+		std::sort(overlaps.begin(), overlaps.end());
+
+		for(s32 idx : overlaps)
+		{
+			const Node & other = m_nodes[idx];
+
+			if(other.owner != node.owner)
+			{
+				char ownerBuf[32], otherBuf[32];
+
+				_WARNING("patch conflict: %s (%s) patched %016I64X-%016I64X, overlapping %016I64X-%016I64X patched by %s (%s)",
+					ownerName(node.owner, ownerBuf, sizeof(ownerBuf)), node.kind, node.start, node.end,
+					other.start, other.end, ownerName(other.owner, otherBuf, sizeof(otherBuf)), other.kind);
+
+				m_numConflicts++;
+			}
+		}
+	}
+
+	m_nodes.push_back(node);
+
+	m_root = insert(m_root, s32(m_nodes.size() - 1));
+}
+
+void PatchRegistry::findPatches(uintptr_t addr, size_t len, std::vector <PatchInfo> * out)
+{
+	if(!len)
+		return;
+
+	std::lock_guard <std::mutex> lock(m_lock);
+
+	std::vector <s32> overlaps;
+	findOverlaps(m_root, addr, addr + len, &overlaps);
+
+	for(s32 idx : overlaps)
+	{
+		const Node & n = m_nodes[idx];
+
+		PatchInfo info;
+
+		info.start = n.start;
+		info.len = n.end - n.start;
+		info.owner = n.owner;
+		info.kind = n.kind;
+
+		out->push_back(info);
+	}
+}
+
+const char * PatchRegistry::ownerName(u32 owner, char * buf, size_t bufLen) const
+{
+	const char * name = m_ownerName ? m_ownerName(owner) : nullptr;
+	if(name)
+		return name;
+
+	if(owner == kOwner_OBSE)
+		return "OBSE";
+
+	sprintf_s(buf, bufLen, "plugin %d", owner);
+
+	return buf;
+}
+
+static void FormatBytes(const u8 * data, size_t len, char * buf, size_t bufLen)
+{
+	const size_t kMaxBytes = 16;
+
+	size_t shown = (std::min)(len, kMaxBytes);
+	char * dst = buf;
+
+	for(size_t i = 0; i < shown; i++)
+	{
+		sprintf_s(dst, bufLen - (dst - buf), (i ? " %02X" : "%02X"), data[i]);
+		dst += strlen(dst);
+	}
+
+	if(len > shown)
+		sprintf_s(dst, bufLen - (dst - buf), " ...");
+}
+
+void PatchRegistry::dump(s32 node) const
+{
+	if(node == kNil)
+		return;
+
+	const Node & n = m_nodes[node];
+
+	dump(n.left);
+
+	size_t len = n.end - n.start;
+	const u8 * original = &m_data[n.dataOffset];
+
+	char ownerBuf[32], originalBuf[64], newBuf[64];
+
+	FormatBytes(original, len, originalBuf, sizeof(originalBuf));
+	FormatBytes(original + len, len, newBuf, sizeof(newBuf));
+
+	FILETIME fileTime;
+	fileTime.dwLowDateTime = u32(n.time);
+	fileTime.dwHighDateTime = u32(n.time >> 32);
+
+	SYSTEMTIME time = { 0 };
+	FileTimeToSystemTime(&fileTime, &time);
+
+	_MESSAGE("\t%016I64X %4d %02d:%02d:%02d.%03d #%d %s (%s): %s -> %s",
+		n.start, u32(len),
+		time.wHour, time.wMinute, time.wSecond, time.wMilliseconds,
+		n.seq, ownerName(n.owner, ownerBuf, sizeof(ownerBuf)), n.kind,
+		originalBuf, newBuf);
+
+	dump(n.right);
+}
+
+void PatchRegistry::dump()
+{
+	std::lock_guard <std::mutex> lock(m_lock);
+
+	_MESSAGE("patch map: %d patches, %d conflicts", u32(m_nodes.size()), u32(m_numConflicts));
+
+	dump(m_root);
+}
+
+size_t PatchRegistry::numPatches()
+{
+	std::lock_guard <std::mutex> lock(m_lock);
+
+	return m_nodes.size();
+}
+
+size_t PatchRegistry::numConflicts()
+{
+	std::lock_guard <std::mutex> lock(m_lock);
+
+	return m_numConflicts;
+}
@@ -0,0 +1,118 @@
+#pragma once
+
+#include "obse64_common/Types.h"
+#include <mutex>
+#include <vector>
+
+// records every range patched through safeWriteBuf, with who patched it and the bytes before and after
+// ranges are kept in an interval tree (an AVL tree ordered by start address where each node also knows the
+// highest end address below it) so patches overlapping one from a different owner are reported as they happen
+class PatchRegistry
+{
+public:
+	enum
+	{
+		kOwner_OBSE = 0,	// matches the handle used while no plugin is loading
+	};
+
+	typedef const char * (* OwnerNameCallback)(u32 owner);
+
+	struct PatchInfo
+	{
+		uintptr_t	start;
+		size_t		len;
+		u32			owner;
+		const char	* kind;
+	};
+
+	PatchRegistry();
+	~PatchRegistry();
+
+	// call right before the write. data is the new contents, the original bytes are read from addr
+	void	record(uintptr_t addr, const void * data, size_t len, u32 owner, const char * kind);
+
+	// every recorded patch overlapping [addr, addr + len), by address then in recording order
+	void	findPatches(uintptr_t addr, size_t len, std::vector <PatchInfo> * out);
+
+	// logs every patch in address order
+	void	dump();
+
+	size_t	numPatches();
+	size_t	numConflicts();
+
+	// used by dump and the conflict warning, owners are printed as numbers otherwise
+	void	setOwnerNameCallback(OwnerNameCallback callback) { m_ownerName = callback; }
+
+	// owner and kind of patches made on this thread while the scopes below are open
+	static u32			currentOwner();
+	static const char *	currentKind();
+
+	class OwnerScope
+	{
+	public:
+		explicit OwnerScope(u32 owner);
+		~OwnerScope();
+
+	private:
+		u32	m_prev;
+	};
+
+	class KindScope
+	{
+	public:
+		explicit KindScope(const char * kind);
+		~KindScope();
+
+	private:
+		const char	* m_prev;
+	};
+
+private:
+	PatchRegistry(const PatchRegistry &) = delete;
+	PatchRegistry & operator=(const PatchRegistry &) = delete;
+
+	enum
+	{
+		kNil = -1,
+	};
+
+	struct Node
+	{
+		uintptr_t	start;
+		uintptr_t	end;
+		uintptr_t	maxEnd;	// highest end in this subtree
+
+		s32			left;
+		s32			right;
+		s32			height;
+
+		u32			owner;
+		u32			seq;		// order of recording
+		const char	* kind;
+		u64			time;		// FILETIME
+
+		size_t		dataOffset;	// original bytes then new bytes, in to m_data
+	};
+
+	s32		insert(s32 node, s32 newNode);
+	s32		rebalance(s32 node);
+	s32		rotateLeft(s32 node);
+	s32		rotateRight(s32 node);
+	void	update(s32 node);
+	s32		height(s32 node) const { return (node == kNil) ? 0 : m_nodes[node].height; }
+
+	void	findOverlaps(s32 node, uintptr_t start, uintptr_t end, std::vector <s32> * out) const;
+	void	dump(s32 node) const;
+
+	const char *	ownerName(u32 owner, char * buf, size_t bufLen) const;
+
+	std::mutex			m_lock;
+	std::vector <Node>	m_nodes;
+	std::vector <u8>	m_data;
+	s32					m_root;
+	size_t				m_numConflicts;
+
+	OwnerNameCallback	m_ownerName;
+};
+
+extern PatchRegistry g_patchRegistry;
@@ -0,0 +1,360 @@
+#include "PatternScan.h"
+#include "obse64_common/FileStream.h"
+#include "obse64_common/Relocation.h"
+#include "obse64_common/Utilities.h"
+#include "obse64_common/Log.h"
+#include <cstring>
+#include <Windows.h>
+
+PatternCache g_patternCache;
+
+static int HexDigit(char c)
+{
+	if((c >= '0') && (c <= '9')) return c - '0';
+	if((c >= 'a') && (c <= 'f')) return c - 'a' + 10;
+	if((c >= 'A') && (c <= 'F')) return c - 'A' + 10;
+
+	return -1;
+}
+
+BytePattern::BytePattern(const char * pattern)
+	:m_hash(0)
+{
+	for(const char * iter = pattern; *iter; )
+	{
+		if(*iter == ' ')
+		{
+			iter++;
+		}
+		else if(*iter == '?')
+		{
+			m_bytes.push_back(0);
+			m_mask.push_back(0);
+
+			iter++;
+			if(*iter == '?') iter++;
+		}
+		else
+		{
+			int hi = HexDigit(iter[0]);
+			int lo = (hi >= 0) ? HexDigit(iter[1]) : -1;
+
+			if((hi < 0) || (lo < 0))
+			{
+				_ERROR("BytePattern: bad pattern %s", pattern);
+
+				m_bytes.clear();
+				m_mask.clear();
+				return;
+			}
+
+			m_bytes.push_back(u8((hi << 4) | lo));
+			m_mask.push_back(0xFF);
+
+			iter += 2;
+		}
+	}
+
+	// hash the parsed form so formatting differences don't matter
+	if(!m_bytes.empty())
+	{
+		m_hash = hashMemory(m_bytes.data(), m_bytes.size());
+		m_hash = hashMemory(m_mask.data(), m_mask.size(), m_hash);
+	}
+}
+
+bool BytePattern::match(const u8 * data) const
+{
+	for(size_t i = 0; i < m_bytes.size(); i++)
+		if((data[i] & m_mask[i]) != m_bytes[i])
+			return false;
+
+	return true;
+}
+
+const u8 * BytePattern::find(const u8 * start, size_t len) const
+{
+	if(!valid() || (len < m_bytes.size()))
+		return nullptr;
+
+	// anchor on the first fixed byte so memchr does most of the work
+	size_t anchor = 0;
+	while((anchor < m_mask.size()) && !m_mask[anchor])
+		anchor++;
+
+	const u8 * end = start + len - m_bytes.size() + 1;
+
+	if(anchor == m_mask.size())
+		return start;	// all wildcards
+
+	const u8 * iter = start;
+	while(iter < end)
+	{
+		auto * candidate = (const u8 *)memchr(iter + anchor, m_bytes[anchor], end - iter);
+		if(!candidate)
+			break;
+
+		candidate -= anchor;
+
+		if(match(candidate))
+			return candidate;
+
+		iter = candidate + 1;
+	}
+
+	return nullptr;
+}
+
+PatternCache::PatternCache()
+	:m_exeSize(0)
+	, m_exeWriteTime(0)
+	, m_textHash(0)
+	, m_haveTextHash(false)
+	, m_valid(false)
+	, m_dirty(false)
+{
+	//
+}
+
+void PatternCache::open(const char * path)
+{
+	std::lock_guard <std::mutex> lock(m_lock);
+
+	m_path = path;
+	m_entries.clear();
+	m_dirty = false;
+	m_haveTextHash = false;
+
+	m_valid = identifyExecutable();
+	if(!m_valid)
+	{
+		_WARNING("PatternCache: couldn't identify executable, results won't be persisted");
+		return;
+	}
+
+	FileStream src;
+	if(!src.open(path))
+		return;
+
+	// read everything in one go
+	std::vector <u8> data(src.length());
+	if(data.size() < sizeof(Header) || (src.read(data.data(), data.size()) != data.size()))
+		return;
+
+	auto * header = (const Header *)data.data();
+
+	if((header->signature != kSignature) || (header->version != kVersion) ||
+		(data.size() != sizeof(Header) + (u64(header->numEntries) * sizeof(Entry))))
+	{
+		_MESSAGE("PatternCache: ignoring invalid cache file");
+		m_dirty = true;
+		return;
+	}
+
+	if((header->exeSize == m_exeSize) && (header->exeWriteTime == m_exeWriteTime))
+	{
+		m_textHash = header->textHash;
+		m_haveTextHash = true;
+	}
+	else
+	{
+		// the file was replaced or touched, only the code decides if the results still apply
+		if(!updateTextHash() || (header->textHash != m_textHash))
+		{
+			_MESSAGE("PatternCache: executable changed, discarding %d cached results", header->numEntries);
+			m_dirty = true;
+			return;
+		}
+
+		// same code, write the new size and time back
+		m_dirty = true;
+	}
+
+	auto * entries = (const Entry *)(header + 1);
+
+	m_entries.reserve(header->numEntries);
+
+	for(u32 i = 0; i < header->numEntries; i++)
+		m_entries[entries[i].patternHash] = entries[i].rva;
+
+	_MESSAGE("PatternCache: loaded %d results", header->numEntries);
+}
+
+void PatternCache::save()
+{
+	std::lock_guard <std::mutex> lock(m_lock);
+
+	if(!m_valid || !m_dirty || m_path.empty())
+		return;
+
+	if(!updateTextHash())
+	{
+		_WARNING("PatternCache: couldn't hash executable, results won't be persisted");
+		return;
+	}
+
+	FileStream dst;
+	if(!dst.create(m_path.c_str()))
+	{
+		_WARNING("PatternCache: couldn't write %s", m_path.c_str());
+		return;
+	}
+
+	Header header;
+
+	header.signature = kSignature;
+	header.version = kVersion;
+	header.exeSize = m_exeSize;
+	header.exeWriteTime = m_exeWriteTime;
+	header.textHash = m_textHash;
+	header.numEntries = (u32)m_entries.size();
+
+	std::vector <Entry> entries;
+	entries.reserve(m_entries.size());
+
+	for(auto & iter : m_entries)
+	{
+		Entry entry;
+
+		entry.patternHash = iter.first;
+		entry.rva = iter.second;
+
+		entries.push_back(entry);
+	}
+
+	dst.write(&header, sizeof(header));
+	dst.write(entries.data(), entries.size() * sizeof(Entry));
+
+	m_dirty = false;
+}
+
+uintptr_t PatternCache::find(const char * patternStr)
+{
+	BytePattern pattern(patternStr);
+	if(!pattern.valid())
+		return 0;
+
+	std::lock_guard <std::mutex> lock(m_lock);
+
+	auto iter = m_entries.find(pattern.hash());
+	if(iter != m_entries.end())
+	{
+		u32 rva = iter->second;
+
+		if(rva == kNotFound)
+			return 0;
+
+		// cheap sanity check, the key already tells us the executable hasn't changed
+		auto * section = getImageSection((const void *)RelocationManager::s_baseAddr, ".text");
+		if(section &&
+			(rva >= section->VirtualAddress) &&
+			(rva + pattern.size() <= section->VirtualAddress + section->Misc.VirtualSize) &&
+			pattern.match((const u8 *)(RelocationManager::s_baseAddr + rva)))
+		{
+			return RelocationManager::s_baseAddr + rva;
+		}
+
+		_WARNING("PatternCache: stale result for %s, rescanning", patternStr);
+	}
+
+	u32 rva = kNotFound;
+	scan(pattern, &rva);
+
+	m_entries[pattern.hash()] = rva;
+	m_dirty = true;
+
+	return (rva != kNotFound) ? RelocationManager::s_baseAddr + rva : 0;
+}
+
+// non-relocated image, kept separate from the caller because of __try
+static bool HashTextSection(const u8 * fileBase, u64 fileSize, u64 * out)
+{
+	__try
+	{
+		auto * section = getImageSection(fileBase, ".text");
+		if(section && (u64(section->PointerToRawData) + section->SizeOfRawData <= fileSize))
+		{
+			*out = hashMemory(fileBase + section->PointerToRawData, section->SizeOfRawData, section->SizeOfRawData);
+			return true;
+		}
+	}
+	__except(EXCEPTION_EXECUTE_HANDLER)
+	{
+		_ERROR("PatternCache: exception while hashing executable");
+	}
+
+	return false;
+}
+
+// cheap, doesn't read the file
+bool PatternCache::identifyExecutable()
+{
+	WIN32_FILE_ATTRIBUTE_DATA attributes;
+	if(!GetFileAttributesEx(getRuntimePath().c_str(), GetFileExInfoStandard, &attributes))
+		return false;
+
+	m_exeSize = (u64(attributes.nFileSizeHigh) << 32) | attributes.nFileSizeLow;
+	m_exeWriteTime = (u64(attributes.ftLastWriteTime.dwHighDateTime) << 32) | attributes.ftLastWriteTime.dwLowDateTime;
+
+	return true;
+}
+
+// hashed once, on the first call that needs it
+bool PatternCache::updateTextHash()
+{
+	if(!m_haveTextHash)
+		m_haveTextHash = hashExecutable(&m_textHash);
+
+	return m_haveTextHash;
+}
+
+bool PatternCache::hashExecutable(u64 * out)
+{
+	bool result = false;
+
+	// hash the file on disk rather than the loaded image, which may have been relocated
+	std::string path = getRuntimePath();
+
+	HANDLE file = CreateFile(path.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+	if(file == INVALID_HANDLE_VALUE)
+		return false;
+
+	LARGE_INTEGER fileSize;
+	if(GetFileSizeEx(file, &fileSize))
+	{
+		HANDLE mapping = CreateFileMapping(file, NULL, PAGE_READONLY, 0, 0, NULL);
+		if(mapping)
+		{
+			const u8 * fileBase = (const u8 *)MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+			if(fileBase)
+			{
+				result = HashTextSection(fileBase, fileSize.QuadPart, out);
+
+				UnmapViewOfFile(fileBase);
+			}
+
+			CloseHandle(mapping);
+		}
+	}
+
+	CloseHandle(file);
+
+	return result;
+}
+
+bool PatternCache::scan(const BytePattern & pattern, u32 * rvaOut)
+{
+	auto * section = getImageSection((const void *)RelocationManager::s_baseAddr, ".text");
+	if(!section)
+		return false;
+
+	auto * start = (const u8 *)(RelocationManager::s_baseAddr + section->VirtualAddress);
+
+	const u8 * result = pattern.find(start, section->Misc.VirtualSize);
+	if(!result)
+		return false;
+
+	*rvaOut = u32(uintptr_t(result) - RelocationManager::s_baseAddr);
+
+	return true;
+}
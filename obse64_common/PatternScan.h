@@ -0,0 +1,91 @@
+#pragma once
+
+#include "obse64_common/Types.h"
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// pattern format is hex bytes separated by spaces, ? or ?? is a wildcard
+// "48 8B 05 ?? ?? ?? ?? 48 85 C0"
+class BytePattern
+{
+public:
+	BytePattern(const char * pattern);
+
+	bool	valid() const { return !m_bytes.empty(); }
+	size_t	size() const { return m_bytes.size(); }
+	u64		hash() const { return m_hash; }
+
+	bool	match(const u8 * data) const;
+
+	// returns the first match in [start, start + len) or nullptr
+	const u8 *	find(const u8 * start, size_t len) const;
+
+private:
+	std::vector <u8>	m_bytes;
+	std::vector <u8>	m_mask;	// 0 = wildcard
+	u64					m_hash;
+};
+
+// persistent cache of pattern scan results for the main module
+// the file is keyed by the executable's size and write time. only when those change is its .text section hashed,
+// so a game update invalidates the whole file automatically while a copied or touched executable keeps it
+class PatternCache
+{
+public:
+	PatternCache();
+
+	// reads the cache file. entries from a different executable are dropped
+	void	open(const char * path);
+	void	save();
+
+	// returns the address of the first match in the main module's .text section, or 0
+	uintptr_t	find(const char * pattern);
+
+private:
+	enum
+	{
+		kSignature =	'GSBO',	// OBSG
+		kVersion =		2,
+
+		kNotFound =		0xFFFFFFFF,
+	};
+
+#pragma pack(push, 4)
+	struct Header
+	{
+		u32	signature;
+		u32	version;
+		u64	exeSize;
+		u64	exeWriteTime;
+		u64	textHash;
+		u32	numEntries;
+	};
+
+	struct Entry
+	{
+		u64	patternHash;
+		u32	rva;		// kNotFound if the pattern didn't match anything
+	};
+#pragma pack(pop)
+
+	bool	identifyExecutable();
+	bool	hashExecutable(u64 * out);
+	bool	updateTextHash();
+	bool	scan(const BytePattern & pattern, u32 * rvaOut);
+
+	std::mutex	m_lock;
+
+	std::string	m_path;
+	u64			m_exeSize;
+	u64			m_exeWriteTime;
+	u64			m_textHash;
+	bool		m_haveTextHash;
+	bool		m_valid;	// false if we couldn't identify the executable, disables persistence
+	bool		m_dirty;
+
+	std::unordered_map <u64, u32>	m_entries;	// pattern hash -> rva
+};
+
+extern PatternCache g_patternCache;
@@ -0,0 +1,106 @@
+#include "PayloadPool.h"
+#include "obse64_common/Errors.h"
+#include "obse64_common/Log.h"
+#include <malloc.h>
+#include <new>
+
+PayloadPool g_payloadPool;
+
+PayloadPool::PayloadPool()
+{
+	for(auto & list : m_free)
+		InitializeSListHead(&list);
+}
+
+PayloadPool::~PayloadPool()
+{
+	for(auto & list : m_free)
+	{
+		auto * entry = InterlockedFlushSList(&list);
+
+		while(entry)
+		{
+			auto * next = entry->Next;
+
+			_aligned_free(entry);
+
+			entry = next;
+		}
+	}
+}
+
+void * PayloadPool::allocate(u32 size)
+{
+	if(!size)
+		return nullptr;
+
+	u32 sizeClass = 0;
+	while((sizeClass < kNumClasses) && (size > (1u << (sizeClass + kMinClassShift))))
+		sizeClass++;
+
+	Header * result = nullptr;
+
+	if(sizeClass != kClass_Large)
+		result = (Header *)InterlockedPopEntrySList(&m_free[sizeClass]);
+
+	if(!result)
+	{
+		size_t capacity = (sizeClass != kClass_Large) ? (1u << (sizeClass + kMinClassShift)) : size;
+
+		result = (Header *)_aligned_malloc(sizeof(Header) + capacity, MEMORY_ALLOCATION_ALIGNMENT);
+		if(!result)
+			return nullptr;
+
+		new (&result->refs) std::atomic <u32>;
+	}
+
+	result->refs.store(1, std::memory_order_relaxed);
+	result->sizeClass = sizeClass;
+	result->size = size;
+	result->magic = kMagic;
+
+	return result + 1;
+}
+
+PayloadPool::Header * PayloadPool::header(const void * payload)
+{
+	auto * result = ((Header *)payload) - 1;
+
+	// catches pointers that didn't come from allocate and buffers that were already freed
+	ASSERT(result->magic == kMagic);
+
+	return result;
+}
+
+void PayloadPool::retain(void * payload)
+{
+	header(payload)->refs.fetch_add(1, std::memory_order_relaxed);
+}
+
+void PayloadPool::release(void * payload)
+{
+	if(!payload)
+		return;
+
+	auto * info = header(payload);
+
+	// acq_rel so the last owner sees every write made through the other references
+	if(info->refs.fetch_sub(1, std::memory_order_acq_rel) != 1)
+		return;
+
+	info->magic = 0;
+
+	if((info->sizeClass != kClass_Large) && (QueryDepthSList(&m_free[info->sizeClass]) < kMaxCachedPerClass))
+	{
+		InterlockedPushEntrySList(&m_free[info->sizeClass], &info->entry);
+	}
+	else
+	{
+		_aligned_free(info);
+	}
+}
+
+u32 PayloadPool::size(const void * payload) const
+{
+	return payload ? header(payload)->size : 0;
+}
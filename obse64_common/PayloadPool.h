@@ -0,0 +1,56 @@
+#pragma once
+
+#include "obse64_common/Types.h"
+#include <atomic>
+#include <Windows.h>
+
+// refcounted buffers for message payloads, so a receiver can keep one without copying it
+// sizes are rounded up to a power of two class. freed buffers go on that class's lock free list (an SLIST)
+// and are handed out again, anything bigger than the largest class comes from the heap and goes back to it
+class PayloadPool
+{
+public:
+	PayloadPool();
+	~PayloadPool();
+
+	// refcount starts at 1, null if size is 0 or the allocation failed
+	void *	allocate(u32 size);
+
+	void	retain(void * payload);
+	void	release(void * payload);
+
+	// the size passed to allocate
+	u32		size(const void * payload) const;
+
+private:
+	PayloadPool(const PayloadPool &) = delete;
+	PayloadPool & operator=(const PayloadPool &) = delete;
+
+	enum
+	{
+		kMinClassShift =	6,	// 64 bytes
+		kMaxClassShift =	16,	// 64k
+		kNumClasses =		kMaxClassShift - kMinClassShift + 1,
+		kClass_Large =		kNumClasses,
+
+		kMaxCachedPerClass =	256,
+
+		kMagic =	'DLYP',	// PYLD
+	};
+
+	// SLIST entries need MEMORY_ALLOCATION_ALIGNMENT, which also keeps the payload after this aligned
+	struct alignas(16) Header
+	{
+		SLIST_ENTRY			entry;	// only used while on a free list
+		std::atomic <u32>	refs;
+		u32					sizeClass;
+		u32					size;
+		u32					magic;
+	};
+
+	static Header *	header(const void * payload);
+
+	SLIST_HEADER	m_free[kNumClasses];
+};
+
+extern PayloadPool g_payloadPool;
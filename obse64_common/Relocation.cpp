@@ -1,4 +1,6 @@
 #include "Relocation.h"
+#include "obse64_common/Types.h"
+#include "obse64_common/Log.h"
 #include <Windows.h>
 
 // the goal of this file is to support pointers in to a relocated binary with as little runtime overhead, code bloat, and hassle as possible
@@ -16,16 +18,92 @@
 // 
 // the problem can't be solved further without moving the RelocPtr constructors in to init_seg(lib), which doesn't appear to be possible
 // without forcing all pointers to be defined in a file with init_seg(lib). that is really ugly and doesn't seem like a good idea.
+// 
+// StaticRelocPtr/StaticRelocAddr get around this differently. they have constexpr constructors, so they are written to the image
+// already holding their offset and never touch the static init table. RELOC_STATIC places all of them in one section, bracketed
+// by the markers below, and the RelocationManager constructor adds the load address to the entire section in one pass. since that
+// happens in init_seg(lib), they are also safe to use from other static constructors.
 
 // anything in this file will initialized after the crt but before any user code
 #pragma warning(disable: 4073)	// yes this is intentional
 #pragma init_seg(lib)
 
+// sections are sorted by the name after the $, so these bracket every RELOC_STATIC entry
+#pragma section("OBSERel$A", read, write)
+#pragma section("OBSERel$Z", read, write)
+__declspec(allocate("OBSERel$A")) static uintptr_t s_staticRelocStart = 0;
+__declspec(allocate("OBSERel$Z")) static uintptr_t s_staticRelocEnd = 0;
+
 static RelocationManager s_relocMgr;
 
 uintptr_t RelocationManager::s_baseAddr = 0;
 
+static uintptr_t * StaticRelocBegin()
+{
+	return (uintptr_t *)(uintptr_t(&s_staticRelocStart) + sizeof(uintptr_t));
+}
+
+static uintptr_t * StaticRelocEnd()
+{
+	return (uintptr_t *)uintptr_t(&s_staticRelocEnd);
+}
+
 RelocationManager::RelocationManager()
 {
 	s_baseAddr = reinterpret_cast<uintptr_t>(GetModuleHandle(NULL));
+
+	uintptr_t * end = StaticRelocEnd();
+
+	// the linker may pad between contributions from different objects with zeroes, skip those
+	// branchless so the compiler can vectorize it
+	for(uintptr_t * iter = StaticRelocBegin(); iter < end; ++iter)
+	{
+		uintptr_t offset = *iter;
+
+		*iter = offset + (s_baseAddr & (0 - uintptr_t(offset != 0)));
+	}
+}
+
+std::uint32_t RelocationManager::validate()
+{
+	auto * base = (const u8 *)s_baseAddr;
+	auto * dosHeader = (const IMAGE_DOS_HEADER *)base;
+	auto * ntHeader = (const IMAGE_NT_HEADERS *)(base + dosHeader->e_lfanew);
+	auto * sectionHeader = IMAGE_FIRST_SECTION(ntHeader);
+	u32 numSections = ntHeader->FileHeader.NumberOfSections;
+
+	u32 numEntries = 0;
+	u32 numBad = 0;
+
+	for(uintptr_t * iter = StaticRelocBegin(); iter < StaticRelocEnd(); ++iter)
+	{
+		if(!*iter)
+			continue;
+
+		numEntries++;
+
+		uintptr_t rva = *iter - s_baseAddr;
+		bool found = false;
+
+		for(u32 i = 0; i < numSections; i++)
+		{
+			auto * section = &sectionHeader[i];
+
+			if((rva >= section->VirtualAddress) && (rva < section->VirtualAddress + section->Misc.VirtualSize))
+			{
+				found = true;
+				break;
+			}
+		}
+
+		if(!found)
+		{
+			_ERROR("static relocation %016I64X (offset %08I64X) is outside of the image", *iter, rva);
+			numBad++;
+		}
+	}
+
+	_MESSAGE("validated %d static relocations, %d bad", numEntries, numBad);
+
+	return numBad;
 }
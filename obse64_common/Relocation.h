@@ -8,8 +8,17 @@ public:
 	RelocationManager();
 
 	static uintptr_t	s_baseAddr;
+
+	// range checks every static relocation against the image's sections, returns the number of bad entries
+	static std::uint32_t	validate();
 };
 
+// StaticRelocPtr/StaticRelocAddr must be defined with RELOC_STATIC, which puts them in a dedicated section
+// they are constant initialized with their offset, then RelocationManager fixes up the whole section in one pass
+// before any other static initializer runs. no entry in the static init table is needed per object
+#pragma section("OBSERel$M", read, write)
+#define RELOC_STATIC	__declspec(allocate("OBSERel$M"))
+
 // use this for addresses that represent pointers to a type T
 template <typename T>
 class RelocPtr
@@ -89,3 +98,79 @@ private:
 	RelocAddr(RelocAddr & rhs) = delete;
 	RelocAddr & operator=(RelocAddr & rhs) = delete;
 };
+
+// RelocPtr without the static initializer, define with RELOC_STATIC
+template <typename T>
+class StaticRelocPtr
+{
+public:
+	constexpr StaticRelocPtr(uintptr_t offset)
+		:m_addr(offset)
+	{
+		//
+	}
+
+	operator T *() const
+	{
+		return getPtr();
+	}
+
+	T * operator->() const
+	{
+		return getPtr();
+	}
+
+	T * getPtr() const
+	{
+		return reinterpret_cast <T *>(m_addr);
+	}
+
+	const T * getConst() const
+	{
+		return reinterpret_cast <T *>(m_addr);
+	}
+
+	uintptr_t getUIntPtr() const
+	{
+		return m_addr;
+	}
+
+private:
+	uintptr_t	m_addr;	// offset until RelocationManager runs
+
+	// hide
+	StaticRelocPtr() = delete;
+	StaticRelocPtr(StaticRelocPtr & rhs) = delete;
+	StaticRelocPtr & operator=(StaticRelocPtr & rhs) = delete;
+};
+
+// RelocAddr without the static initializer, define with RELOC_STATIC
+template <typename T>
+class StaticRelocAddr
+{
+public:
+	constexpr StaticRelocAddr(uintptr_t offset)
+		:m_addr(offset)
+	{
+		//
+	}
+
+	operator T() const
+	{
+		// c-style cast works for both pointer and integer types
+		return (T)m_addr;
+	}
+
+	uintptr_t getUIntPtr() const
+	{
+		return m_addr;
+	}
+
+private:
+	uintptr_t	m_addr;	// offset until RelocationManager runs
+
+	// hide
+	StaticRelocAddr() = delete;
+	StaticRelocAddr(StaticRelocAddr & rhs) = delete;
+	StaticRelocAddr & operator=(StaticRelocAddr & rhs) = delete;
+};
@@ -1,14 +1,202 @@
 #include "SafeWrite.h"
-#include <Windows.h>
+#include "PageProtection.h"
+#include "PatchRegistry.h"
+#include <algorithm>
+#include <climits>
+#include <cstring>
 #include "obse64_common/Errors.h"
+#include "obse64_common/Log.h"
+
+static thread_local PatchTransaction * s_activeTransaction = nullptr;
+
+static SafeWriteRedirect s_redirect = { 0 };
+
+void redirectSafeWrite(const SafeWriteRedirect & redirect)
+{
+	s_redirect = redirect;
+}
+
+PatchTransaction::PatchTransaction()
+	:m_prev(s_activeTransaction)
+	, m_open(true)
+	, m_redirected(s_redirect.beginTransaction != nullptr)
+{
+	// OBSE's transaction is active on this thread until commit, safeWriteBuf reaches it through the redirect
+	if(m_redirected)
+		s_redirect.beginTransaction();
+	else
+		s_activeTransaction = this;
+}
+
+PatchTransaction::~PatchTransaction()
+{
+	commit();
+}
+
+PatchTransaction * PatchTransaction::active()
+{
+	return s_activeTransaction;
+}
+
+void PatchTransaction::write(uintptr_t addr, const void * data, size_t len)
+{
+	if(!len)
+		return;
+
+	ASSERT(m_open);
+
+	if(m_redirected)
+	{
+		s_redirect.write(s_redirect.owner, addr, data, len);
+		return;
+	}
+
+	Write entry;
+
+	entry.addr = addr;
+	entry.len = len;
+	entry.dataOffset = m_data.size();
+	entry.owner = PatchRegistry::currentOwner();
+	entry.kind = PatchRegistry::currentKind();
+
+	m_writes.push_back(entry);
+	m_data.insert(m_data.end(), (const u8 *)data, (const u8 *)data + len);
+}
+
+void PatchTransaction::close()
+{
+	if(!m_open)
+		return;
+
+	m_open = false;
+
+	if(m_redirected)
+		return;
+
+	// transactions are scoped, so this one is always innermost
+	ASSERT(s_activeTransaction == this);
+	s_activeTransaction = m_prev;
+}
+
+void PatchTransaction::commit()
+{
+	if(m_redirected)
+	{
+		if(m_open)
+			s_redirect.commitTransaction();
+
+		close();
+		return;
+	}
+
+	close();
+
+	if(m_writes.empty())
+		return;
+
+	size_t pageSize = getPageSize();
+
+	// page aligned spans, sorted and merged
+	std::vector <std::pair <uintptr_t, uintptr_t>> spans;
+	spans.reserve(m_writes.size());
+
+	for(auto & entry : m_writes)
+	{
+		uintptr_t start = entry.addr & ~(pageSize - 1);
+		uintptr_t end = (entry.addr + entry.len + pageSize - 1) & ~(pageSize - 1);
+
+		spans.push_back(std::make_pair(start, end));
+	}
+
+	std::sort(spans.begin(), spans.end());
+
+	std::vector <ProtectedRange> ranges;
+	bool unprotected = true;
+
+	for(size_t i = 0; i < spans.size(); )
+	{
+		uintptr_t start = spans[i].first;
+		uintptr_t end = spans[i].second;
+
+		for(i++; (i < spans.size()) && (spans[i].first <= end); i++)
+			end = (std::max)(end, spans[i].second);
+
+		if(!unprotectRange(start, end - start, &ranges))
+			unprotected = false;
+	}
+
+	// all or nothing, a hook that's only partly written is worse than one that's missing
+	if(!unprotected)
+	{
+		_ERROR("PatchTransaction: couldn't unprotect every page, dropping %d writes", u32(m_writes.size()));
+
+		for(auto & range : ranges)
+			restoreRange(range);
+
+		m_writes.clear();
+		m_data.clear();
+
+		return;
+	}
+
+	// in submission order so later writes to the same bytes win. each one is recorded right before it's made, so
+	// the registry sees the bytes it replaces and cancelled writes never show up
+	for(auto & entry : m_writes)
+	{
+		const u8 * data = &m_data[entry.dataOffset];
+
+		g_patchRegistry.record(entry.addr, data, entry.len, entry.owner, entry.kind);
+		memcpy((void *)entry.addr, data, entry.len);
+	}
+
+	for(auto & range : ranges)
+		restoreRange(range);
+
+	flushCode();
+
+	m_writes.clear();
+	m_data.clear();
+}
+
+void PatchTransaction::cancel()
+{
+	if(m_redirected && m_open)
+		s_redirect.cancelTransaction();
+
+	close();
+
+	m_writes.clear();
+	m_data.clear();
+}
 
 void safeWriteBuf(uintptr_t addr, void * data, size_t len)
 {
-	DWORD oldProtect;
+	if(s_redirect.write)
+	{
+		s_redirect.write(s_redirect.owner, addr, data, len);
+		return;
+	}
+
+	if(s_activeTransaction)
+	{
+		s_activeTransaction->write(addr, data, len);
+		return;
+	}
+
+	std::vector <ProtectedRange> ranges;
+
+	if(unprotectRange(addr, len, &ranges))
+	{
+		g_patchRegistry.record(addr, data, len, PatchRegistry::currentOwner(), PatchRegistry::currentKind());
+		memcpy((void *)addr, data, len);
+	}
+	else
+	{
+		_ERROR("safeWriteBuf: skipped write to %016I64X (%d bytes)", addr, u32(len));
+	}
 
-	VirtualProtect((void *)addr, len, PAGE_EXECUTE_READWRITE, &oldProtect);
-	memcpy((void *)addr, data, len);
-	VirtualProtect((void *)addr, len, oldProtect, &oldProtect);
+	for(auto & range : ranges)
+		restoreRange(range);
 }
 
 void safeWrite8(uintptr_t addr, u8 data)
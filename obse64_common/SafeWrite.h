@@ -1,6 +1,8 @@
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
+#include <vector>
 #include "obse64_common/Types.h"
 
 void safeWriteBuf(uintptr_t addr, void * data, size_t len);
@@ -14,3 +16,63 @@ void safeWrite64(uintptr_t addr, u64 data);
 // 5 bytes written to src
 bool safeWriteJump(uintptr_t src, uintptr_t dst);
 bool safeWriteCall(uintptr_t src, uintptr_t dst);
+
+// collects patches and applies them with one protection change per page, then flushes the instruction cache once
+// while a transaction is open, safeWriteBuf (and everything built on it) on the same thread is redirected in to it
+// nothing is written until commit, so code inside the transaction must not read back what it patched
+class PatchTransaction
+{
+public:
+	PatchTransaction();
+	~PatchTransaction();	// commits anything outstanding
+
+	void	write(uintptr_t addr, const void * data, size_t len);
+
+	void	commit();
+	void	cancel();
+
+	size_t	numWrites() const { return m_writes.size(); }
+
+	// innermost open transaction on this thread, or nullptr
+	static PatchTransaction *	active();
+
+private:
+	PatchTransaction(const PatchTransaction &) = delete;
+	PatchTransaction & operator=(const PatchTransaction &) = delete;
+
+	struct Write
+	{
+		uintptr_t	addr;
+		size_t		len;
+		size_t		dataOffset;	// in to m_data
+
+		// patch registry owner and kind when the write was made, it's recorded on commit
+		u32			owner;
+		const char	* kind;
+	};
+
+	void	close();
+
+	std::vector <Write>	m_writes;
+	std::vector <u8>	m_data;
+
+	PatchTransaction	* m_prev;	// previously active transaction
+	bool				m_open;
+	bool				m_redirected;	// the transaction is OBSE's, see redirectSafeWrite
+};
+
+// plugins link their own copy of obse64_common, so their writes and transactions would stay local to the plugin:
+// never batched with OBSE's, and missing from its patch map. pass the functions from OBSEPatchInterface here
+// (query kInterface_Patch in your load function) and safeWriteBuf and PatchTransaction go through OBSE instead
+struct SafeWriteRedirect
+{
+	u32		owner;	// your plugin handle
+
+	void	(* write)(u32 owner, uintptr_t addr, const void * data, size_t len);
+	void	(* beginTransaction)(void);
+	void	(* commitTransaction)(void);
+	void	(* cancelTransaction)(void);
+};
+
+// set once before patching anything. OBSE itself never calls this
+void redirectSafeWrite(const SafeWriteRedirect & redirect);
@@ -0,0 +1,357 @@
+#include "TaskPool.h"
+
+struct ContinuationLink
+{
+	TaskPool::Task		* task;
+	ContinuationLink	* next;
+};
+
+struct TaskPool::Task
+{
+	TaskFn		fn;
+	void		* ctx;
+
+	std::atomic <u32>	refs;			// handle and scheduler
+	std::atomic <u32>	dependencies;	// unfinished predecessors, plus one while being set up
+	std::atomic <bool>	done;
+
+	// tasks to schedule once this one finishes. set to kContinuationsClosed when it does
+	std::atomic <ContinuationLink *>	continuations;
+};
+
+static ContinuationLink s_closedLink;
+static ContinuationLink * const kContinuationsClosed = &s_closedLink;
+
+// which queue the current thread owns, if it's one of our workers
+static thread_local const TaskPool * s_workerPool = nullptr;
+static thread_local u32 s_workerQueue = 0;
+
+TaskPool::TaskPool(u32 numWorkers)
+	:m_nextQueue(0)
+	, m_pending(0)
+	, m_numSleeping(0)
+	, m_quit(false)
+{
+	// one queue even without workers, callers of wait/parallelFor drain it
+	u32 numQueues = numWorkers ? numWorkers : 1;
+
+	for(u32 i = 0; i < numQueues; i++)
+		m_queues.emplace_back(new Queue);
+
+	for(u32 i = 0; i < numWorkers; i++)
+		m_threads.emplace_back(&TaskPool::workerLoop, this, i);
+}
+
+TaskPool::~TaskPool()
+{
+	{
+		std::lock_guard <std::mutex> lock(m_sleepLock);
+		m_quit = true;
+	}
+
+	m_sleepCond.notify_all();
+
+	for(auto & thread : m_threads)
+		thread.join();
+
+	// nothing left if there were workers
+	while(runOne())
+		;
+}
+
+TaskPool::Task * TaskPool::create(TaskFn fn, void * ctx, u32 refs, u32 dependencies)
+{
+	Task * task = new Task;
+
+	task->fn = fn;
+	task->ctx = ctx;
+	task->refs = refs;
+	task->dependencies = dependencies;
+	task->done = false;
+	task->continuations = nullptr;
+
+	return task;
+}
+
+TaskPool::Task * TaskPool::submit(TaskFn fn, void * ctx)
+{
+	Task * task = create(fn, ctx, 2, 0);
+
+	schedule(task);
+
+	return task;
+}
+
+TaskPool::Task * TaskPool::then(Task * predecessor, TaskFn fn, void * ctx)
+{
+	return whenAll(&predecessor, 1, fn, ctx);
+}
+
+TaskPool::Task * TaskPool::whenAll(Task * const * predecessors, u32 numPredecessors, TaskFn fn, void * ctx)
+{
+	// the extra dependency keeps it from being scheduled before every link is added
+	Task * task = create(fn, ctx, 2, numPredecessors + 1);
+
+	for(u32 i = 0; i < numPredecessors; i++)
+		addContinuation(predecessors[i], task);
+
+	dependencyDone(task);
+
+	return task;
+}
+
+void TaskPool::addContinuation(Task * predecessor, Task * continuation)
+{
+	ContinuationLink * link = new ContinuationLink;
+	link->task = continuation;
+	link->next = predecessor->continuations.load(std::memory_order_acquire);
+
+	while(link->next != kContinuationsClosed)
+	{
+		if(predecessor->continuations.compare_exchange_weak(link->next, link, std::memory_order_acq_rel, std::memory_order_acquire))
+			return;
+	}
+
+	// already finished
+	delete link;
+
+	dependencyDone(continuation);
+}
+
+void TaskPool::dependencyDone(Task * task)
+{
+	if(task->dependencies.fetch_sub(1, std::memory_order_acq_rel) == 1)
+		schedule(task);
+}
+
+void TaskPool::schedule(Task * task)
+{
+	u32 queueIdx = (s_workerPool == this) ? s_workerQueue : (m_nextQueue++ % m_queues.size());
+	Queue & queue = *m_queues[queueIdx];
+
+	{
+		std::lock_guard <std::mutex> lock(queue.lock);
+		queue.tasks.push_back(task);
+	}
+
+	m_pending++;
+
+	// a worker going to sleep bumps m_numSleeping before checking m_pending, so one of us sees the other
+	if(m_numSleeping.load())
+	{
+		{
+			std::lock_guard <std::mutex> lock(m_sleepLock);
+		}
+
+		m_sleepCond.notify_one();
+	}
+}
+
+void TaskPool::execute(Task * task)
+{
+	task->fn(task->ctx);
+
+	task->done.store(true, std::memory_order_release);
+
+	ContinuationLink * link = task->continuations.exchange(kContinuationsClosed, std::memory_order_acq_rel);
+
+	while(link)
+	{
+		ContinuationLink * next = link->next;
+
+		dependencyDone(link->task);
+		delete link;
+
+		link = next;
+	}
+
+	// scheduler reference
+	release(task);
+}
+
+void TaskPool::release(Task * task)
+{
+	if(task && (task->refs.fetch_sub(1, std::memory_order_acq_rel) == 1))
+		delete task;
+}
+
+bool TaskPool::isDone(const Task * task) const
+{
+	return task->done.load(std::memory_order_acquire);
+}
+
+void TaskPool::wait(Task * task)
+{
+	while(!isDone(task))
+	{
+		if(!runOne())
+			std::this_thread::yield();
+	}
+}
+
+TaskPool::Task * TaskPool::pop(u32 queueIdx)
+{
+	Queue & queue = *m_queues[queueIdx];
+
+	std::lock_guard <std::mutex> lock(queue.lock);
+
+	if(queue.tasks.empty())
+		return nullptr;
+
+	// newest first, its data is most likely still in cache
+	Task * task = queue.tasks.back();
+	queue.tasks.pop_back();
+
+	m_pending--;
+
+	return task;
+}
+
+TaskPool::Task * TaskPool::steal(u32 queueIdx)
+{
+	u32 numQueues = u32(m_queues.size());
+
+	for(u32 i = 0; i < numQueues; i++)
+	{
+		Queue & queue = *m_queues[(queueIdx + i) % numQueues];
+
+		std::lock_guard <std::mutex> lock(queue.lock);
+
+		if(!queue.tasks.empty())
+		{
+			// oldest first, it's usually the biggest piece of work
+			Task * task = queue.tasks.front();
+			queue.tasks.pop_front();
+
+			m_pending--;
+
+			return task;
+		}
+	}
+
+	return nullptr;
+}
+
+bool TaskPool::runOne()
+{
+	Task * task = nullptr;
+
+	if(s_workerPool == this)
+	{
+		task = pop(s_workerQueue);
+		if(!task)
+			task = steal(s_workerQueue + 1);
+	}
+	else if(m_pending.load())
+	{
+		task = steal(m_nextQueue.load());
+	}
+
+	if(!task)
+		return false;
+
+	execute(task);
+
+	return true;
+}
+
+void TaskPool::workerLoop(u32 queueIdx)
+{
+	s_workerPool = this;
+	s_workerQueue = queueIdx;
+
+	while(true)
+	{
+		if(runOne())
+			continue;
+
+		std::unique_lock <std::mutex> lock(m_sleepLock);
+
+		m_numSleeping++;
+
+		m_sleepCond.wait(lock, [this]() { return m_quit || m_pending.load(); });
+
+		m_numSleeping--;
+
+		if(m_quit && !m_pending.load())
+			break;
+	}
+
+	s_workerPool = nullptr;
+}
+
+struct ParallelForState
+{
+	TaskPool::RangeFn	fn;
+	void				* ctx;
+};
+
+struct ParallelForChunk
+{
+	ParallelForState	* state;
+	u64					begin;
+	u64					end;
+};
+
+static void RunParallelForChunk(void * ctx)
+{
+	auto * chunk = (ParallelForChunk *)ctx;
+
+	chunk->state->fn(chunk->state->ctx, chunk->begin, chunk->end);
+}
+
+void TaskPool::parallelFor(u64 begin, u64 end, u64 grain, RangeFn fn, void * ctx)
+{
+	if(end <= begin)
+		return;
+
+	u64 count = end - begin;
+
+	// a few chunks per thread so stealing can even out uneven work
+	if(!grain)
+	{
+		u64 numThreads = m_threads.size() + 1;
+
+		grain = count / (numThreads * 4);
+		if(!grain)
+			grain = 1;
+	}
+
+	// so begin + grain can't pass end
+	if(grain > count)
+		grain = count;
+
+	// count + grain - 1 would overflow for large grains
+	u64 numChunks = (count / grain) + ((count % grain) != 0);
+
+	if(numChunks == 1)
+	{
+		fn(ctx, begin, end);
+		return;
+	}
+
+	ParallelForState state = { fn, ctx };
+
+	std::vector <ParallelForChunk>	chunks(size_t(numChunks - 1));
+	std::vector <Task *>			tasks(chunks.size());
+
+	// the calling thread takes the first chunk itself
+	for(size_t i = 0; i < chunks.size(); i++)
+	{
+		auto & chunk = chunks[i];
+
+		chunk.state = &state;
+		chunk.begin = begin + ((i + 1) * grain);
+		chunk.end = ((end - chunk.begin) > grain) ? (chunk.begin + grain) : end;
+
+		tasks[i] = submit(RunParallelForChunk, &chunk);
+	}
+
+	fn(ctx, begin, begin + grain);
+
+	for(auto * task : tasks)
+	{
+		wait(task);
+		release(task);
+	}
+}
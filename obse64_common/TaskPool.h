@@ -0,0 +1,75 @@
+#pragma once
+
+#include "obse64_common/Types.h"
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// work stealing thread pool, standard library only
+// every worker has its own queue. workers take their newest task first and steal the oldest task from another
+// queue when theirs is empty. threads outside the pool add to the queues round robin, and help run tasks while
+// they wait, so the pool also works with no workers at all
+// tasks are reference counted. submit/then/whenAll return a handle that has to be released, continuations are
+// scheduled when the last task they depend on finishes
+class TaskPool
+{
+public:
+	typedef void (* TaskFn)(void * ctx);
+	typedef void (* RangeFn)(void * ctx, u64 begin, u64 end);
+
+	struct Task;
+
+	explicit TaskPool(u32 numWorkers);
+	~TaskPool();	// runs everything still queued, then joins the workers
+
+	u32		numWorkers() const { return u32(m_threads.size()); }
+
+	Task *	submit(TaskFn fn, void * ctx);
+	Task *	then(Task * predecessor, TaskFn fn, void * ctx);
+	Task *	whenAll(Task * const * predecessors, u32 numPredecessors, TaskFn fn, void * ctx);
+
+	// runs other tasks until task is done
+	void	wait(Task * task);
+	bool	isDone(const Task * task) const;
+	void	release(Task * task);
+
+	// calls fn on [begin, end) in chunks of about grain items (0 picks one) and returns once all are done
+	void	parallelFor(u64 begin, u64 end, u64 grain, RangeFn fn, void * ctx);
+
+private:
+	TaskPool(const TaskPool &) = delete;
+	TaskPool & operator=(const TaskPool &) = delete;
+
+	struct Queue
+	{
+		std::mutex			lock;
+		std::deque <Task *>	tasks;
+	};
+
+	Task *	create(TaskFn fn, void * ctx, u32 refs, u32 dependencies);
+	void	schedule(Task * task);
+	void	execute(Task * task);
+	void	addContinuation(Task * predecessor, Task * continuation);
+	void	dependencyDone(Task * task);
+
+	Task *	pop(u32 queueIdx);
+	Task *	steal(u32 queueIdx);
+	bool	runOne();
+
+	void	workerLoop(u32 queueIdx);
+
+	std::vector <std::unique_ptr <Queue>>	m_queues;
+	std::vector <std::thread>				m_threads;
+
+	std::atomic <u32>	m_nextQueue;
+	std::atomic <u32>	m_pending;		// queued and not yet taken
+	std::atomic <u32>	m_numSleeping;
+	bool				m_quit;
+
+	std::mutex				m_sleepLock;
+	std::condition_variable	m_sleepCond;
+};
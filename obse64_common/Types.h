@@ -1,5 +1,7 @@
 #pragma once
 
+#ifdef _MSC_VER
+
 #include <intrin.h>
 
 typedef unsigned __int8		u8;
@@ -10,15 +12,37 @@ typedef signed __int8		s8;
 typedef signed __int16		s16;
 typedef signed __int32		s32;
 typedef signed __int64		s64;
+
+#else
+
+// the portable parts of obse64_common are also built for the tests on other platforms
+#include <cstdint>
+
+typedef std::uint8_t		u8;
+typedef std::uint16_t		u16;
+typedef std::uint32_t		u32;
+typedef std::uint64_t		u64;
+typedef std::int8_t			s8;
+typedef std::int16_t		s16;
+typedef std::int32_t		s32;
+typedef std::int64_t		s64;
+
+#endif
+
 typedef float				f32;
 typedef double				f64;
-typedef u64					uint;
+
+#ifdef _MSC_VER
+typedef u64					uint;	// glibc already has a 32 bit uint
+#endif
 
 typedef u8	unk8;
 typedef u16	unk16;
 typedef u32	unk32;
 typedef u64	unk64;
 
+#ifdef _MSC_VER
+
 inline u16 swap16(u16 a)
 {
 	return _byteswap_ushort(a);
@@ -33,3 +57,22 @@ inline u64 swap64(u64 a)
 {
 	return _byteswap_uint64(a);
 }
+
+#else
+
+inline u16 swap16(u16 a)
+{
+	return __builtin_bswap16(a);
+}
+
+inline u32 swap32(u32 a)
+{
+	return __builtin_bswap32(a);
+}
+
+inline u64 swap64(u64 a)
+{
+	return __builtin_bswap64(a);
+}
+
+#endif
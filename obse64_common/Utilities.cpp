@@ -1,7 +1,10 @@
 #include "Utilities.h"
 #include "obse64_common/Log.h"
 #include "obse64_common/Errors.h"
+#include "obse64_common/LockFreeCache.h"
 #include <string>
+#include <mutex>
+#include <vector>
 #include <Windows.h>
 
 std::string getRuntimePath()
@@ -208,6 +211,217 @@ bool is64BitDLL(const void * module)
 	return ntHeader->FileHeader.Machine == IMAGE_FILE_MACHINE_AMD64;
 }
 
+const IMAGE_SECTION_HEADER * getImageSection(const void * module, const char * name)
+{
+	auto * base = (const u8 *)module;
+	auto * dosHeader = (const IMAGE_DOS_HEADER *)base;
+	auto * ntHeader = (const IMAGE_NT_HEADERS *)(base + dosHeader->e_lfanew);
+	auto * sectionHeader = IMAGE_FIRST_SECTION(ntHeader);
+
+	for(u32 i = 0; i < ntHeader->FileHeader.NumberOfSections; i++)
+	{
+		auto * section = &sectionHeader[i];
+
+		// section names are only null terminated when shorter than 8 chars
+		if(!strncmp((const char *)section->Name, name, IMAGE_SIZEOF_SHORT_NAME))
+		{
+			return section;
+		}
+	}
+
+	return nullptr;
+}
+
+static const IMAGE_NT_HEADERS * GetMappedFileNTHeader(const void * fileBase, u64 fileSize)
+{
+	auto * base = (const u8 *)fileBase;
+
+	if(fileSize < sizeof(IMAGE_DOS_HEADER))
+		return nullptr;
+
+	auto * dosHeader = (const IMAGE_DOS_HEADER *)base;
+	if((dosHeader->e_magic != IMAGE_DOS_SIGNATURE) || (dosHeader->e_lfanew < 0) ||
+		(u64(dosHeader->e_lfanew) + sizeof(IMAGE_NT_HEADERS) > fileSize))
+		return nullptr;
+
+	auto * ntHeader = (const IMAGE_NT_HEADERS *)(base + dosHeader->e_lfanew);
+	if(ntHeader->Signature != IMAGE_NT_SIGNATURE)
+		return nullptr;
+
+	return ntHeader;
+}
+
+bool is64BitMappedFile(const void * fileBase, u64 fileSize)
+{
+	auto * ntHeader = GetMappedFileNTHeader(fileBase, fileSize);
+
+	return ntHeader && (ntHeader->FileHeader.Machine == IMAGE_FILE_MACHINE_AMD64) &&
+		(ntHeader->OptionalHeader.Magic == IMAGE_NT_OPTIONAL_HDR64_MAGIC);
+}
+
+const void * getMappedFileRVAPointer(const void * fileBase, u64 fileSize, u32 rva, u32 len)
+{
+	auto * ntHeader = GetMappedFileNTHeader(fileBase, fileSize);
+	if(!ntHeader)
+		return nullptr;
+
+	auto * sectionHeader = IMAGE_FIRST_SECTION(ntHeader);
+	u32 numSections = ntHeader->FileHeader.NumberOfSections;
+
+	if(u64((const u8 *)(sectionHeader + numSections) - (const u8 *)fileBase) > fileSize)
+		return nullptr;
+
+	for(u32 i = 0; i < numSections; i++)
+	{
+		auto * section = &sectionHeader[i];
+
+		// only the part of the section that's backed by the file
+		u64 offset = u64(rva) - section->VirtualAddress;
+		if((rva >= section->VirtualAddress) && (offset + len <= section->SizeOfRawData))
+		{
+			u64 fileOffset = section->PointerToRawData + offset;
+			if(fileOffset + len > fileSize)
+				return nullptr;
+
+			return (const u8 *)fileBase + fileOffset;
+		}
+	}
+
+	return nullptr;
+}
+
+// same as getResourceLibraryProcAddress, but the export table is found through the section headers
+const void * getMappedFileExport(const void * fileBase, u64 fileSize, const char * exportName, u32 len)
+{
+	auto * ntHeader = GetMappedFileNTHeader(fileBase, fileSize);
+	if(!ntHeader || (ntHeader->OptionalHeader.Magic != IMAGE_NT_OPTIONAL_HDR64_MAGIC))
+		return nullptr;
+
+	auto & dir = ntHeader->OptionalHeader.DataDirectory[IMAGE_DIRECTORY_ENTRY_EXPORT];
+	if(!dir.VirtualAddress)
+		return nullptr;
+
+	auto * exportTable = (const IMAGE_EXPORT_DIRECTORY *)getMappedFileRVAPointer(fileBase, fileSize, dir.VirtualAddress, sizeof(IMAGE_EXPORT_DIRECTORY));
+	if(!exportTable)
+		return nullptr;
+
+	u32 numNames = exportTable->NumberOfNames;
+
+	// keeps the size calculations below from overflowing
+	if((numNames > 0xFFFFFF) || (exportTable->NumberOfFunctions > 0xFFFFFF))
+		return nullptr;
+
+	auto * exportAddresses = (const u32 *)getMappedFileRVAPointer(fileBase, fileSize, exportTable->AddressOfFunctions, exportTable->NumberOfFunctions * sizeof(u32));
+	auto * exportNameOrdinals = (const u16 *)getMappedFileRVAPointer(fileBase, fileSize, exportTable->AddressOfNameOrdinals, numNames * sizeof(u16));
+	auto * exportNames = (const u32 *)getMappedFileRVAPointer(fileBase, fileSize, exportTable->AddressOfNames, numNames * sizeof(u32));
+
+	if(!exportAddresses || !exportNameOrdinals || !exportNames)
+		return nullptr;
+
+	size_t nameLen = strlen(exportName) + 1;
+
+	for(u32 i = 0; i < numNames; i++)
+	{
+		auto * name = (const char *)getMappedFileRVAPointer(fileBase, fileSize, exportNames[i], u32(nameLen));
+
+		if(name && !memcmp(exportName, name, nameLen))
+		{
+			u32 addrIdx = exportNameOrdinals[i];
+			if(addrIdx < exportTable->NumberOfFunctions)
+				return getMappedFileRVAPointer(fileBase, fileSize, exportAddresses[addrIdx], len);
+
+			break;
+		}
+	}
+
+	return nullptr;
+}
+
+u32 getPhysicalCoreCount()
+{
+	static u32 s_numCores = 0;
+
+	if(!s_numCores)
+	{
+		DWORD len = 0;
+		GetLogicalProcessorInformation(nullptr, &len);
+
+		std::vector <SYSTEM_LOGICAL_PROCESSOR_INFORMATION> info(len / sizeof(SYSTEM_LOGICAL_PROCESSOR_INFORMATION));
+
+		u32 numCores = 0;
+
+		if(!info.empty() && GetLogicalProcessorInformation(info.data(), &len))
+		{
+			for(auto & entry : info)
+				if(entry.Relationship == RelationProcessorCore)
+					numCores++;
+		}
+
+		if(!numCores)
+		{
+			SYSTEM_INFO sysInfo;
+			GetSystemInfo(&sysInfo);
+
+			numCores = sysInfo.dwNumberOfProcessors;
+		}
+
+		s_numCores = numCores ? numCores : 1;
+	}
+
+	return s_numCores;
+}
+
+u64 hashMemory(const void * data, size_t len, u64 seed)
+{
+	const u64 kMul = 0x9E3779B97F4A7C15;
+
+	auto * src = (const u8 *)data;
+
+	// four independent lanes so the multiplies can overlap
+	u64 lanes[4] = { seed ^ kMul, seed + kMul, seed ^ (kMul >> 1), seed - kMul };
+
+	while(len >= 32)
+	{
+		for(u32 i = 0; i < 4; i++)
+		{
+			u64 word;
+			memcpy(&word, src + i * 8, sizeof(word));
+
+			lanes[i] = (lanes[i] ^ word) * kMul;
+			lanes[i] ^= lanes[i] >> 29;
+		}
+
+		src += 32;
+		len -= 32;
+	}
+
+	u64 result = len;
+
+	for(u32 i = 0; i < 4; i++)
+		result = (result ^ lanes[i]) * kMul;
+
+	for(; len >= 8; src += 8, len -= 8)
+	{
+		u64 word;
+		memcpy(&word, src, sizeof(word));
+
+		result = (result ^ word) * kMul;
+		result ^= result >> 29;
+	}
+
+	for(; len; src++, len--)
+		result = (result ^ *src) * kMul;
+
+	// splitmix64 finalizer
+	result ^= result >> 30;
+	result *= 0xBF58476D1CE4E5B9;
+	result ^= result >> 27;
+	result *= 0x94D049BB133111EB;
+	result ^= result >> 31;
+
+	return result;
+}
+
 #pragma warning (push)
 #pragma warning (disable : 4200)
 struct RTTIType
@@ -222,9 +436,41 @@ struct RTTILocator
 	u32		sig, offset, cdOffset;
 	u32		typeDesc;
 	u32		classDesc;
+	u32		self;
 };
 #pragma warning (pop)
 
+// vtable -> class name cache
+static LockFreeCache <uintptr_t, const char *, 16> s_classNameCache;
+static std::once_flag s_classNameIndexOnce;
+
+static u64 ClassNameCache_Hash(uintptr_t vtbl)
+{
+	return u64(vtbl >> 3) * 0x9E3779B97F4A7C15;
+}
+
+// returns the undecorated class name or nullptr
+static const char * GetLocatorClassName(const RTTILocator * rtti)
+{
+	RelocPtr<RTTIType> type(rtti->typeDesc);
+
+	// starts with ,?
+	if((type->name[0] == '.') && (type->name[1] == '?'))
+	{
+		// is at most 100 chars long
+		for(u32 i = 0; i < 100; i++)
+		{
+			if(type->name[i] == 0)
+			{
+				// remove the .?AV
+				return type->name + 4;
+			}
+		}
+	}
+
+	return nullptr;
+}
+
 // use the RTTI information to return an object's class name
 const char * getObjectClassName(void * objBase)
 {
@@ -233,24 +479,17 @@ const char * getObjectClassName(void * objBase)
 	{
 		void		** obj = (void **)objBase;
 		RTTILocator	** vtbl = (RTTILocator **)obj[0];
-		RTTILocator	* rtti = vtbl[-1];
-		u64 typeDesc = rtti->typeDesc;
-		RelocPtr<RTTIType> type(typeDesc);
 
-		// starts with ,?
-		if((type->name[0] == '.') && (type->name[1] == '?'))
+		const char * name = nullptr;
+		if(!s_classNameCache.lookup(ClassNameCache_Hash(uintptr_t(vtbl)), uintptr_t(vtbl), &name))
 		{
-			// is at most 100 chars long
-			for(u32 i = 0; i < 100; i++)
-			{
-				if(type->name[i] == 0)
-				{
-					// remove the .?AV
-					result = type->name + 4;
-					break;
-				}
-			}
+			name = GetLocatorClassName(vtbl[-1]);
+			if(name)
+				s_classNameCache.insert(ClassNameCache_Hash(uintptr_t(vtbl)), uintptr_t(vtbl), name);
 		}
+
+		if(name)
+			result = name;
 	}
 	__except(EXCEPTION_EXECUTE_HANDLER)
 	{
@@ -259,3 +498,54 @@ const char * getObjectClassName(void * objBase)
 
 	return result;
 }
+
+static void IndexRDataClassNames(const u8 * start, const u8 * end, u32 * numIndexed)
+{
+	__try
+	{
+		// vtables are preceded by a pointer to their complete object locator
+		// on x64 the locator has signature 1 and contains its own RVA, which rules out almost every false positive
+		for(auto * iter = (const uintptr_t *)start; iter + 1 < (const uintptr_t *)end; ++iter)
+		{
+			uintptr_t ptr = *iter;
+
+			if((ptr < uintptr_t(start)) || (ptr + sizeof(RTTILocator) > uintptr_t(end)) || (ptr & 3))
+				continue;
+
+			auto * rtti = (const RTTILocator *)ptr;
+
+			if((rtti->sig != 1) || (rtti->self != ptr - RelocationManager::s_baseAddr))
+				continue;
+
+			const char * name = GetLocatorClassName(rtti);
+			if(name)
+			{
+				s_classNameCache.insert(ClassNameCache_Hash(uintptr_t(iter + 1)), uintptr_t(iter + 1), name);
+				(*numIndexed)++;
+			}
+		}
+	}
+	__except(EXCEPTION_EXECUTE_HANDLER)
+	{
+		_ERROR("indexObjectClassNames: exception while scanning .rdata");
+	}
+}
+
+void indexObjectClassNames()
+{
+	// one scan, other callers wait for it to finish
+	std::call_once(s_classNameIndexOnce, []()
+	{
+		auto * section = getImageSection((const void *)RelocationManager::s_baseAddr, ".rdata");
+		if(!section)
+			return;
+
+		auto * start = (const u8 *)(RelocationManager::s_baseAddr + section->VirtualAddress);
+		auto * end = start + section->Misc.VirtualSize;
+
+		u32 numIndexed = 0;
+		IndexRDataClassNames(start, end, &numIndexed);
+
+		_MESSAGE("indexed %d vtables", numIndexed);
+	});
+}
@@ -3,6 +3,9 @@
 #include "obse64_common/Types.h"
 #include "obse64_common/Relocation.h"
 #include <string>
+#include <utility>
+
+struct _IMAGE_SECTION_HEADER;
 
 // this has been tested to work for non-varargs functions
 // varargs functions end up with 'this' passed as the last parameter (ie. probably broken)
@@ -62,117 +65,78 @@
 	((*(obj)).*(*((obj)->_##fn##_GetPtr())))
 
 // Using the original implementation does very broken things in a Release build
+#ifdef _MSC_VER
 #define FORCE_INLINE  __forceinline
-#define DEFINE_MEMBER_FN_0(fnName, retnType, addr)											\
-	static const std::uintptr_t fnName##_Address = addr;									\
-	FORCE_INLINE retnType fnName() {														\
-	struct empty_struct {};																	\
-	typedef retnType(empty_struct::*_##fnName##_type)();									\
-	const static uintptr_t address = fnName##_Address + RelocationManager::s_baseAddr;		\
-	_##fnName##_type fn = *(_##fnName##_type*)&address;										\
-	return (reinterpret_cast<empty_struct*>(this)->*fn)();									\
-	}
-#define DEFINE_MEMBER_FN_1(fnName, retnType, addr, ...)										\
-	static const std::uintptr_t fnName##_Address = addr;									\
-	template<typename T1>																	\
-	FORCE_INLINE retnType fnName(T1 && t1) {												\
-	struct empty_struct {};																	\
-	typedef retnType(empty_struct::*_##fnName##_type)(__VA_ARGS__);							\
-	const static uintptr_t address =  fnName##_Address + RelocationManager::s_baseAddr;		\
-	_##fnName##_type fn = *(_##fnName##_type*)&address;										\
-	return (reinterpret_cast<empty_struct*>(this)->*fn)(t1);								\
-	}
-#define DEFINE_MEMBER_FN_2(fnName, retnType, addr, ...)										\
-	static const std::uintptr_t fnName##_Address = addr;									\
-	template<typename T1, typename T2>														\
-	FORCE_INLINE retnType fnName(T1 && t1, T2 && t2) {										\
-	struct empty_struct {};																	\
-	typedef retnType(empty_struct::*_##fnName##_type)(__VA_ARGS__);							\
-	const static uintptr_t address = fnName##_Address + RelocationManager::s_baseAddr;		\
-	_##fnName##_type fn = *(_##fnName##_type*)&address;										\
-	return (reinterpret_cast<empty_struct*>(this)->*fn)(t1, t2);							\
-	}
-#define DEFINE_MEMBER_FN_3(fnName, retnType, addr, ...)										\
-	static const std::uintptr_t fnName##_Address = addr;									\
-	template<typename T1, typename T2, typename T3>											\
-	FORCE_INLINE retnType fnName(T1 && t1, T2 && t2, T3 && t3) {							\
-	struct empty_struct {};																	\
-	typedef retnType(empty_struct::*_##fnName##_type)(__VA_ARGS__);							\
-	const static uintptr_t address = fnName##_Address + RelocationManager::s_baseAddr;		\
-	_##fnName##_type fn = *(_##fnName##_type*)&address;										\
-	return (reinterpret_cast<empty_struct*>(this)->*fn)(t1, t2, t3);						\
-	}
-#define DEFINE_MEMBER_FN_4(fnName, retnType, addr, ...)										\
-	static const std::uintptr_t fnName##_Address = addr;									\
-	template<typename T1, typename T2, typename T3, typename T4>							\
-	FORCE_INLINE retnType fnName(T1 && t1, T2 && t2, T3 && t3, T4 && t4) {					\
-	struct empty_struct {};																	\
-	typedef retnType(empty_struct::*_##fnName##_type)(__VA_ARGS__);							\
-	const static uintptr_t address = fnName##_Address + RelocationManager::s_baseAddr;		\
-	_##fnName##_type fn = *(_##fnName##_type*)&address;										\
-	return (reinterpret_cast<empty_struct*>(this)->*fn)(t1, t2, t3, t4);					\
-	}
-#define DEFINE_MEMBER_FN_5(fnName, retnType, addr, ...)										\
-	static const std::uintptr_t fnName##_Address = addr;									\
-	template<typename T1, typename T2, typename T3, typename T4, typename T5>				\
-	FORCE_INLINE retnType fnName(T1 && t1, T2 && t2, T3 && t3, T4 && t4, T5 && t5) {		\
-	struct empty_struct {};																	\
-	typedef retnType(empty_struct::*_##fnName##_type)(__VA_ARGS__);							\
-	const static uintptr_t address = fnName##_Address + RelocationManager::s_baseAddr;		\
-	_##fnName##_type fn = *(_##fnName##_type*)&address;										\
-	return (reinterpret_cast<empty_struct*>(this)->*fn)(t1, t2, t3, t4, t5);				\
-	}
-#define DEFINE_MEMBER_FN_6(fnName, retnType, addr, ...)											\
-	static const std::uintptr_t fnName##_Address = addr;										\
-	template<typename T1, typename T2, typename T3, typename T4, typename T5, typename T6>		\
-	FORCE_INLINE retnType fnName(T1 && t1, T2 && t2, T3 && t3, T4 && t4, T5 && t5, T6 && t6) {	\
-	struct empty_struct {};																		\
-	typedef retnType(empty_struct::*_##fnName##_type)(__VA_ARGS__);								\
-	const static uintptr_t address = fnName##_Address + RelocationManager::s_baseAddr;			\
-	_##fnName##_type fn = *(_##fnName##_type*)&address;											\
-	return (reinterpret_cast<empty_struct*>(this)->*fn)(t1, t2, t3, t4, t5, t6);				\
-	}
-#define DEFINE_MEMBER_FN_7(fnName, retnType, addr, ...)														\
-	static const std::uintptr_t fnName##_Address = addr;													\
-	template<typename T1, typename T2, typename T3, typename T4, typename T5, typename T6, typename T7>		\
-	FORCE_INLINE retnType fnName(T1 && t1, T2 && t2, T3 && t3, T4 && t4, T5 && t5, T6 && t6, T7 && t7) {	\
-	struct empty_struct {};																					\
-	typedef retnType(empty_struct::*_##fnName##_type)(__VA_ARGS__);											\
-	const static uintptr_t address = fnName##_Address + RelocationManager::s_baseAddr;						\
-	_##fnName##_type fn = *(_##fnName##_type*)&address;														\
-	return (reinterpret_cast<empty_struct*>(this)->*fn)(t1, t2, t3, t4, t5, t6, t7);						\
-	}
-#define DEFINE_MEMBER_FN_8(fnName, retnType, addr, ...)																	\
-	static const std::uintptr_t fnName##_Address = addr;																\
-	template<typename T1, typename T2, typename T3, typename T4, typename T5, typename T6, typename T7, typename T8>	\
-	FORCE_INLINE retnType fnName(T1 && t1, T2 && t2, T3 && t3, T4 && t4, T5 && t5, T6 && t6, T7 && t7, T8 && t8) {		\
-	struct empty_struct {};																								\
-	typedef retnType(empty_struct::*_##fnName##_type)(__VA_ARGS__);														\
-	const static uintptr_t address = fnName##_Address + RelocationManager::s_baseAddr;									\
-	_##fnName##_type fn = *(_##fnName##_type*)&address;																	\
-	return (reinterpret_cast<empty_struct*>(this)->*fn)(t1, t2, t3, t4, t5, t6, t7, t8);								\
+#else
+#define FORCE_INLINE  inline __attribute__((always_inline))
+#endif
+
+struct MemberFnThunkClass { };
+
+// the address is computed from RelocationManager::s_baseAddr, which is resolved once at startup, so each call is a load
+// and an add with no function-local static or init guard to check. calling through a pointer-to-member keeps the
+// member calling convention (hidden return buffer comes after 'this'), which a plain function pointer would get wrong
+template <typename Sig>
+struct MemberFnThunk;
+
+template <typename Ret, typename... Params>
+struct MemberFnThunk <Ret(Params...)>
+{
+#ifdef _MSC_VER
+	typedef Ret (MemberFnThunkClass::* FnType)(Params...);
+
+	static_assert(sizeof(FnType) == sizeof(std::uintptr_t), "pointer-to-member must be a plain code pointer");
+
+	template <typename... Args>
+	static FORCE_INLINE Ret call(std::uintptr_t offset, const void * obj, Args &&... args)
+	{
+		union
+		{
+			std::uintptr_t	u;
+			FnType			fn;
+		} data;
+
+		data.u = offset + RelocationManager::s_baseAddr;
+
+		return (reinterpret_cast <MemberFnThunkClass *>(const_cast <void *>(obj))->*data.fn)(std::forward <Args>(args)...);
 	}
-#define DEFINE_MEMBER_FN_9(fnName, retnType, addr, ...)																				\
-	static const std::uintptr_t fnName##_Address = addr;																			\
-	template<typename T1, typename T2, typename T3, typename T4, typename T5, typename T6, typename T7, typename T8, typename T9>	\
-	FORCE_INLINE retnType fnName(T1 && t1, T2 && t2, T3 && t3, T4 && t4, T5 && t5, T6 && t6, T7 && t7, T8 && t8, T9 && t9) {		\
-	struct empty_struct {};																											\
-	typedef retnType(empty_struct::*_##fnName##_type)(__VA_ARGS__);																	\
-	const static uintptr_t address = fnName##_Address + RelocationManager::s_baseAddr;												\
-	_##fnName##_type fn = *(_##fnName##_type*)&address;																				\
-	return (reinterpret_cast<empty_struct*>(this)->*fn)(t1, t2, t3, t4, t5, t6, t7, t8, t9);										\
+#else
+	// itanium member pointers are two words, and member functions are called exactly like free functions
+	// taking 'this' first (the hidden return buffer goes before it either way). only used by the tests, which
+	// check the calls behave but say nothing about the code msvc generates for the branch above
+	typedef Ret (* FnType)(void *, Params...);
+
+	template <typename... Args>
+	static FORCE_INLINE Ret call(std::uintptr_t offset, const void * obj, Args &&... args)
+	{
+		auto fn = reinterpret_cast <FnType>(offset + RelocationManager::s_baseAddr);
+
+		return fn(const_cast <void *>(obj), std::forward <Args>(args)...);
 	}
-#define DEFINE_MEMBER_FN_10(fnName, retnType, addr, ...)																						\
-	static const std::uintptr_t fnName##_Address = addr;																						\
-	template<typename T1, typename T2, typename T3, typename T4, typename T5, typename T6, typename T7, typename T8, typename T9, typename T10>	\
-	FORCE_INLINE retnType fnName(T1 && t1, T2 && t2, T3 && t3, T4 && t4, T5 && t5, T6 && t6, T7 && t7, T8 && t8, T9 && t9, T10 && t10) {		\
-	struct empty_struct {};																														\
-	typedef retnType(empty_struct::*_##fnName##_type)(__VA_ARGS__);																				\
-	const static uintptr_t address = fnName##_Address + RelocationManager::s_baseAddr;															\
-	_##fnName##_type fn = *(_##fnName##_type*)&address;																							\
-	return (reinterpret_cast<empty_struct*>(this)->*fn)(t1, t2, t3, t4, t5, t6, t7, t8, t9, t10);												\
+#endif
+};
+
+// parameter types go in the variadic part, arguments are perfectly forwarded and converted at the call
+#define DEFINE_MEMBER_FN_N(fnName, retnType, addr, ...)																\
+	static const std::uintptr_t fnName##_Address = addr;															\
+	template <typename... Args>																						\
+	FORCE_INLINE retnType fnName(Args &&... args) {																	\
+	return MemberFnThunk <retnType(__VA_ARGS__)>::call(fnName##_Address, this, std::forward <Args>(args)...);		\
 	}
 
+// numbered versions kept so existing code doesn't need to change
+#define DEFINE_MEMBER_FN_0(fnName, retnType, addr)			DEFINE_MEMBER_FN_N(fnName, retnType, addr)
+#define DEFINE_MEMBER_FN_1(fnName, retnType, addr, ...)		DEFINE_MEMBER_FN_N(fnName, retnType, addr, __VA_ARGS__)
+#define DEFINE_MEMBER_FN_2(fnName, retnType, addr, ...)		DEFINE_MEMBER_FN_N(fnName, retnType, addr, __VA_ARGS__)
+#define DEFINE_MEMBER_FN_3(fnName, retnType, addr, ...)		DEFINE_MEMBER_FN_N(fnName, retnType, addr, __VA_ARGS__)
+#define DEFINE_MEMBER_FN_4(fnName, retnType, addr, ...)		DEFINE_MEMBER_FN_N(fnName, retnType, addr, __VA_ARGS__)
+#define DEFINE_MEMBER_FN_5(fnName, retnType, addr, ...)		DEFINE_MEMBER_FN_N(fnName, retnType, addr, __VA_ARGS__)
+#define DEFINE_MEMBER_FN_6(fnName, retnType, addr, ...)		DEFINE_MEMBER_FN_N(fnName, retnType, addr, __VA_ARGS__)
+#define DEFINE_MEMBER_FN_7(fnName, retnType, addr, ...)		DEFINE_MEMBER_FN_N(fnName, retnType, addr, __VA_ARGS__)
+#define DEFINE_MEMBER_FN_8(fnName, retnType, addr, ...)		DEFINE_MEMBER_FN_N(fnName, retnType, addr, __VA_ARGS__)
+#define DEFINE_MEMBER_FN_9(fnName, retnType, addr, ...)		DEFINE_MEMBER_FN_N(fnName, retnType, addr, __VA_ARGS__)
+#define DEFINE_MEMBER_FN_10(fnName, retnType, addr, ...)	DEFINE_MEMBER_FN_N(fnName, retnType, addr, __VA_ARGS__)
+
 // this is the solution to getting a pointer-to-member-function pointer
 template <typename T>
 uintptr_t getFnAddr(T src)
@@ -202,4 +166,24 @@ void * getIATAddr(void * module, const char * searchDllName, const char * search
 const void * getResourceLibraryProcAddress(const void * module, const char * exportName);
 bool is64BitDLL(const void * module);
 
+// works on both loaded and non-relocated (file mapped) images, the header layout is the same
+const _IMAGE_SECTION_HEADER * getImageSection(const void * module, const char * name);
+
+// for dlls mapped as plain files, without the loader. everything is checked against fileSize, so a truncated or
+// malformed file returns nullptr/false instead of reading past the mapping
+const void * getMappedFileRVAPointer(const void * fileBase, u64 fileSize, u32 rva, u32 len);
+const void * getMappedFileExport(const void * fileBase, u64 fileSize, const char * exportName, u32 len);
+bool is64BitMappedFile(const void * fileBase, u64 fileSize);
+
+// cores, not hardware threads. at least 1
+u32 getPhysicalCoreCount();
+
+// fast non-cryptographic hash, good for change detection and table keys
+u64 hashMemory(const void * data, size_t len, u64 seed = 0);
+
+// results are cached per vtable, so repeated lookups are one hash probe
 const char * getObjectClassName(void * objBase);
+
+// optionally prefill the cache with every vtable in the main module's .rdata. safe to call from any thread,
+// the scan only happens once
+void indexObjectClassNames();
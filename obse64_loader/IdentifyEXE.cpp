@@ -2,6 +2,7 @@
 #include "LoaderError.h"
 #include "obse64_common/obse64_version.h"
 #include "obse64_common/Log.h"
+#include "obse64_common/Utilities.h"
 #include <string>
 #include <Windows.h>
 
@@ -156,26 +157,6 @@ void DumpVersionInfo(const VS_FIXEDFILEINFO &info)
 	_MESSAGE("dwFileDateLS = %08X", info.dwFileDateLS);
 }
 
-// non-relocated image
-const IMAGE_SECTION_HEADER *GetImageSection(const u8 *base, const char *name)
-{
-	const IMAGE_DOS_HEADER *dosHeader = (IMAGE_DOS_HEADER *)base;
-	const IMAGE_NT_HEADERS *ntHeader = (IMAGE_NT_HEADERS *)(base + dosHeader->e_lfanew);
-	const IMAGE_SECTION_HEADER *sectionHeader = IMAGE_FIRST_SECTION(ntHeader);
-
-	for (u32 i = 0; i < ntHeader->FileHeader.NumberOfSections; i++)
-	{
-		const IMAGE_SECTION_HEADER *section = &sectionHeader[i];
-
-		if (!strcmp((const char *)section->Name, name))
-		{
-			return section;
-		}
-	}
-
-	return NULL;
-}
-
 // non-relocated image
 bool HasImportedLibrary(const u8 *base, const char *name)
 {
@@ -224,12 +205,12 @@ bool HasImportedLibrary(const u8 *base, const char *name)
 // steam EXE will have the .bind section
 static bool IsSteamImage(const u8 *base)
 {
-	return GetImageSection(base, ".bind") != NULL;
+	return getImageSection(base, ".bind") != NULL;
 }
 
 static bool IsUPXImage(const u8 *base)
 {
-	return GetImageSection(base, "UPX0") != NULL;
+	return getImageSection(base, "UPX0") != NULL;
 }
 
 static bool IsWinStoreImage(const u8 *base)
@@ -0,0 +1,77 @@
+#include "Test.h"
+#include "obse64_common/BranchTrampoline.h"
+#include <sys/mman.h>
+
+static u8 * MapPool(size_t len)
+{
+	void * result = mmap(nullptr, len, PROT_READ | PROT_WRITE | PROT_EXEC, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+	return (result == MAP_FAILED) ? nullptr : (u8 *)result;
+}
+
+// what's left after an unsized allocation ends at an odd address is split up for sized allocations, which
+// have to come back aligned for slots and jump cells to be retargeted atomically
+static void TestEndAllocAlignment()
+{
+	const size_t kPoolSize = 4096;
+
+	u8 * base = MapPool(kPoolSize);
+	CHECK(base);
+
+	BranchTrampoline pool;
+	pool.setBase(kPoolSize, base);
+
+	u8 * window = (u8 *)pool.startAlloc(64);
+	CHECK(window == base);
+
+	pool.endAlloc(window + 3);
+
+	// every block is at least the size of its class, so each one is aligned to 16 or to its size
+	u32 numAllocated = 0;
+
+	for(size_t size = 2048; size >= 8; size /= 2)
+	{
+		u8 * ptr = (u8 *)pool.allocate(size);
+		if(!ptr)
+			continue;
+
+		numAllocated++;
+
+		size_t alignment = (size < 16) ? size : 16;
+
+		CHECK_EQ(uintptr_t(ptr) & (alignment - 1), 0);
+		CHECK(ptr >= window + 3);
+		CHECK(ptr + size <= base + kPoolSize);
+	}
+
+	CHECK(numAllocated >= 8);
+
+	munmap(base, kPoolSize);
+}
+
+// an unused window goes back whole
+static void TestEndAllocUnused()
+{
+	const size_t kPoolSize = 4096;
+
+	u8 * base = MapPool(kPoolSize);
+	CHECK(base);
+
+	BranchTrampoline pool;
+	pool.setBase(kPoolSize, base);
+
+	u8 * window = (u8 *)pool.startAlloc(64);
+	pool.endAlloc(window);
+
+	CHECK(pool.allocate(kPoolSize) == base);
+
+	munmap(base, kPoolSize);
+}
+
+int main()
+{
+	TestEndAllocAlignment();
+	TestEndAllocUnused();
+
+	return testResult();
+}
@@ -0,0 +1,235 @@
+#include "Test.h"
+#include "obse64/Detours.h"
+#include "obse64_common/BranchTrampoline.h"
+#include "xbyak/xbyak.h"
+#include <sys/mman.h>
+#include <cstring>
+
+// relocates small hand assembled functions and runs the copies
+// the functions only touch eax/ecx/edi and the stack, so they can be called like normal functions with one int
+// argument in edi
+
+typedef int (* TestFn)(int arg);
+
+static const size_t kMemSize = 64 * 1024;
+
+static u8 * s_mem = nullptr;
+
+static u8 * Src(u32 idx)	{ return s_mem + (idx * 0x100); }	// functions being moved
+static u8 * Far()			{ return s_mem + 0x4000; }			// branch targets outside of them
+static u8 * Data()			{ return s_mem + 0x5000; }
+static u8 * Pool()			{ return s_mem + 0x6000; }			// for WriteDetour
+static u8 * Out()			{ return s_mem + 0x8000; }			// relocated code
+
+static void Put(u8 * dst, const char * bytes, size_t len)
+{
+	memcpy(dst, bytes, len);
+}
+
+static void PutRel32(u8 * dst, const u8 * target)
+{
+	s32 displ = s32(target - (dst + 4));
+	memcpy(dst, &displ, sizeof(displ));
+}
+
+// mov eax, value; ret
+static void PutReturn(u8 * dst, s32 value)
+{
+	dst[0] = 0xB8;
+	memcpy(dst + 1, &value, sizeof(value));
+	dst[5] = 0xC3;
+}
+
+static size_t Relocate(const u8 * src)
+{
+	memset(Out(), 0xCC, 0x100);
+
+	Xbyak::CodeGenerator code(0x100, Out());
+
+	return RelocateInstructions(code, uintptr_t(src), 5);
+}
+
+static int Run(int arg)
+{
+	return ((TestFn)Out())(arg);
+}
+
+static void TestPlain()
+{
+	// mov eax, 3; ret. the mov is moved, the copy jumps back to the ret
+	u8 * src = Src(0);
+	PutReturn(src, 3);
+
+	CHECK_EQ(Relocate(src), 5);
+	CHECK(!memcmp(Out(), src, 5));
+	CHECK_EQ(Run(0), 3);
+}
+
+static void TestRIPRelative()
+{
+	// mov eax, [rip+data]; ret
+	u8 * src = Src(1);
+	Put(src, "\x8B\x05", 2);
+	PutRel32(src + 2, Data());
+	src[6] = 0xC3;
+
+	s32 value = 0x12345678;
+	memcpy(Data(), &value, sizeof(value));
+
+	CHECK_EQ(Relocate(src), 6);
+
+	s32 displ;
+	memcpy(&displ, Out() + 2, sizeof(displ));
+
+	CHECK_EQ(Out() + 6 + displ, Data());
+	CHECK_EQ(Run(0), 0x12345678);
+}
+
+static void TestJmpRel32()
+{
+	// jmp far
+	u8 * src = Src(2);
+	src[0] = 0xE9;
+	PutRel32(src + 1, Far());
+	PutReturn(Far(), 1);
+
+	CHECK_EQ(Relocate(src), 5);
+	CHECK_EQ(Run(0), 1);
+}
+
+static void TestJccRel8()
+{
+	// test edi, edi; je +0x1C; nop. falls through to return 2, the branch goes to return 1
+	u8 * src = Src(3);
+	Put(src, "\x85\xFF\x74\x1C\x90", 5);
+	PutReturn(src + 5, 2);
+	PutReturn(src + 0x20, 1);
+
+	CHECK_EQ(Relocate(src), 5);
+	CHECK_EQ(Run(0), 1);
+	CHECK_EQ(Run(5), 2);
+}
+
+static void TestJccRel32()
+{
+	// test edi, edi; je far
+	u8 * src = Src(4);
+	Put(src, "\x85\xFF\x0F\x84", 4);
+	PutRel32(src + 4, Far());
+	PutReturn(src + 8, 2);
+	PutReturn(Far(), 1);
+
+	CHECK_EQ(Relocate(src), 8);
+	CHECK_EQ(Run(0), 1);
+	CHECK_EQ(Run(5), 2);
+}
+
+static void TestCallRel32()
+{
+	// call far; add eax, 1; ret
+	u8 * src = Src(5);
+	src[0] = 0xE8;
+	PutRel32(src + 1, Far());
+	Put(src + 5, "\x83\xC0\x01\xC3", 4);
+	PutReturn(Far(), 5);
+
+	CHECK_EQ(Relocate(src), 5);
+	CHECK_EQ(Run(0), 6);
+}
+
+static void TestCounterBranches()
+{
+	// mov rcx, rdi; jrcxz +0x1B
+	u8 * src = Src(6);
+	Put(src, "\x48\x89\xF9\xE3\x1B", 5);
+	PutReturn(src + 5, 2);
+	PutReturn(src + 0x20, 1);
+
+	CHECK_EQ(Relocate(src), 5);
+	CHECK_EQ(Run(0), 1);
+	CHECK_EQ(Run(7), 2);
+
+	// mov rcx, rdi; loop +0x1B
+	src = Src(7);
+	Put(src, "\x48\x89\xF9\xE2\x1B", 5);
+	PutReturn(src + 5, 2);
+	PutReturn(src + 0x20, 1);
+
+	CHECK_EQ(Relocate(src), 5);
+	CHECK_EQ(Run(1), 2);
+	CHECK_EQ(Run(2), 1);
+}
+
+static void TestRejected()
+{
+	// je back to the first byte, which will hold the detour jmp
+	u8 * src = Src(8);
+	Put(src, "\x85\xFF\x74\xFC\x90\xC3", 6);
+	CHECK_EQ(Relocate(src), 0);
+
+	// je in to the middle of the moved code
+	Put(src, "\x85\xFF\x74\xFD\x90\xC3", 6);
+	CHECK_EQ(Relocate(src), 0);
+
+	// the first byte after the moved code is fine, it doesn't move
+	Put(src, "\x85\xFF\x74\x01\x90", 5);
+	PutReturn(src + 5, 2);
+	CHECK_EQ(Relocate(src), 5);
+	CHECK_EQ(Run(0), 2);
+
+	// function ends before 5 bytes
+	Put(src, "\xC3\xCC\xCC\xCC\xCC", 5);
+	CHECK_EQ(Relocate(src), 0);
+}
+
+static void TestWriteDetour()
+{
+	BranchTrampoline pool;
+	pool.setBase(0x1000, Pool());
+
+	u8 * src = Src(9);
+	PutReturn(src, 3);
+
+	u8 * dst = Src(10);
+	PutReturn(dst, 9);
+
+	auto original = (TestFn)WriteDetour(pool, uintptr_t(src), uintptr_t(dst));
+	CHECK(original);
+
+	if(original)
+	{
+		CHECK_EQ(((TestFn)src)(0), 9);
+		CHECK_EQ(original(0), 3);
+	}
+
+	// nothing is written when the code can't be moved
+	u8 * shortFn = Src(11);
+	Put(shortFn, "\xC3\xCC\xCC\xCC\xCC", 5);
+
+	CHECK(!WriteDetour(pool, uintptr_t(shortFn), uintptr_t(dst)));
+	CHECK_EQ(shortFn[0], 0xC3);
+}
+
+int main()
+{
+	void * mem = mmap(nullptr, kMemSize, PROT_READ | PROT_WRITE | PROT_EXEC, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+	if(mem == MAP_FAILED)
+		return 1;
+
+	s_mem = (u8 *)mem;
+	memset(s_mem, 0xCC, kMemSize);
+
+	TestPlain();
+	TestRIPRelative();
+	TestJmpRel32();
+	TestJccRel8();
+	TestJccRel32();
+	TestCallRel32();
+	TestCounterBranches();
+	TestRejected();
+	TestWriteDetour();
+
+	munmap(mem, kMemSize);
+
+	return testResult();
+}
@@ -0,0 +1,365 @@
+#include "Test.h"
+#include "obse64/HookThunks.h"
+#include "obse64_common/BranchTrampoline.h"
+#include "xbyak/xbyak.h"
+#include <sys/mman.h>
+#include <cstring>
+
+// runs thunks from GenerateHookThunk in RWX memory. they use the Win64 calling convention, so everything they
+// call or are called from here is ms_abi
+
+#define WINAPI_ABI	__attribute__((ms_abi))
+
+// the real pool is windows only. CreateHookThunk only needs allocate/release and write windows
+static u8 * s_codeBase = nullptr;
+static size_t s_codeUsed = 0;
+
+static const size_t kCodeSize = 64 * 1024;
+
+BranchTrampoline g_branchTrampoline;
+
+BranchTrampoline::BranchTrampoline()
+{
+	//
+}
+
+BranchTrampoline::~BranchTrampoline()
+{
+	//
+}
+
+void * BranchTrampoline::allocate(size_t size)
+{
+	if(!s_codeBase)
+	{
+		void * base = mmap(nullptr, kCodeSize, PROT_READ | PROT_WRITE | PROT_EXEC, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+		if(base == MAP_FAILED)
+			return nullptr;
+
+		s_codeBase = (u8 *)base;
+	}
+
+	size = (size + 15) & ~size_t(15);
+	if(s_codeUsed + size > kCodeSize)
+		return nullptr;
+
+	u8 * result = s_codeBase + s_codeUsed;
+	s_codeUsed += size;
+
+	return result;
+}
+
+void BranchTrampoline::release(void * ptr, size_t size)
+{
+	//
+}
+
+void BranchTrampoline::beginWrite(const void * ptr, size_t len)
+{
+	//
+}
+
+void BranchTrampoline::endWrite(const void * ptr, size_t len)
+{
+	//
+}
+
+// records rsp on entry, then jumps to fn with every register untouched except rax
+static uintptr_t MakeProbe(const void * fn, u64 * rspOut)
+{
+	void * buf = g_branchTrampoline.allocate(64);
+	Xbyak::CodeGenerator code(64, buf);
+
+	code.mov(code.rax, uintptr_t(rspOut));
+	code.mov(code.ptr[code.rax], code.rsp);
+	code.mov(code.rax, uintptr_t(fn));
+	code.jmp(code.rax);
+
+	return uintptr_t(buf);
+}
+
+static HookThunkFunctionEntry * s_functionEntry = nullptr;
+
+static uintptr_t MakeThunk(const HookThunkDesc & desc, uintptr_t original)
+{
+	u64 * origSlot = nullptr;
+
+	uintptr_t thunk = CreateHookThunk(desc, &origSlot, &s_functionEntry);
+	CHECK(thunk);
+	CHECK(origSlot);
+
+	if(origSlot)
+		*origSlot = original;
+
+	return thunk;
+}
+
+// rsp seen on entry to each function, 0 if it wasn't called
+static u64 s_thunkRsp, s_preRsp, s_origRsp, s_postRsp;
+
+static void ResetRsp()
+{
+	s_thunkRsp = s_preRsp = s_origRsp = s_postRsp = 0;
+}
+
+// after a call, rsp is 8 past a 16 byte boundary
+static bool CalledAligned(u64 rsp)
+{
+	return rsp && ((rsp & 15) == 8);
+}
+
+// the unwind data has to describe the frame the thunk really had when it called something. calleeRsp is rsp on
+// entry to a function called from inside the frame
+static void CheckUnwind(uintptr_t thunk, u64 calleeRsp)
+{
+	CHECK(s_functionEntry);
+	if(!s_functionEntry)
+		return;
+
+	CHECK_EQ(s_functionEntry->begin, 0);
+	CHECK(s_functionEntry->end <= kHookThunk_MaxSize);
+	CHECK_EQ(s_functionEntry->unwindInfo & 3, 0);
+
+	const u8 * code = (const u8 *)thunk;
+	const u8 * info = code + s_functionEntry->unwindInfo;
+
+	u32 prologSize = info[1];
+	u32 numCodes = info[2];
+
+	CHECK_EQ(info[0], 1);
+	CHECK_EQ(info[3], 0);
+	CHECK(prologSize && (prologSize < s_functionEntry->end));
+
+	// sub rsp, imm
+	CHECK_EQ(code[0], 0x48);
+	CHECK((code[1] == 0x83) || (code[1] == 0x81));
+	CHECK_EQ(code[2], 0xEC);
+
+	// one alloc op, ending with the prolog
+	CHECK_EQ(info[4], prologSize);
+
+	u32 op = info[5] & 15;
+	u64 allocSize = 0;
+
+	if(op == 2)
+	{
+		CHECK_EQ(numCodes, 1);
+		allocSize = ((info[5] >> 4) + 1) * 8;
+	}
+	else
+	{
+		CHECK_EQ(op, 1);
+		CHECK_EQ(info[5] >> 4, 0);
+		CHECK_EQ(numCodes, 2);
+		allocSize = (info[6] | (info[7] << 8)) * 8;
+	}
+
+	CHECK_EQ(allocSize, s_thunkRsp - calleeRsp - 8);
+}
+
+// ---- integer arguments, some on the stack ----
+
+static s64 s_preArgs[7];
+static s64 s_origArgs[7];
+static s64 s_postArg;
+
+// arguments past this one aren't passed on by the thunk and hold whatever was left in the register or stack slot
+static u32 s_numArgs = 7;
+
+typedef s64 (WINAPI_ABI * IntFn7)(s64, s64, s64, s64, s64, s64, s64);
+
+static void WINAPI_ABI Pre7(s64 a, s64 b, s64 c, s64 d, s64 e, s64 f, s64 g)
+{
+	s64 args[7] = { a, b, c, d, e, f, g };
+	memcpy(s_preArgs, args, sizeof(args));
+}
+
+static s64 WINAPI_ABI Orig7(s64 a, s64 b, s64 c, s64 d, s64 e, s64 f, s64 g)
+{
+	s64 args[7] = { a, b, c, d, e, f, g };
+	memcpy(s_origArgs, args, sizeof(args));
+
+	s64 result = 0;
+	for(u32 i = 0; i < s_numArgs; i++)
+		result += args[i];
+
+	return result;
+}
+
+static s64 WINAPI_ABI Post(s64 ret)
+{
+	s_postArg = ret;
+
+	return ret * 2;
+}
+
+// 5 to 7 arguments put an odd and an even number of them on the stack
+static void TestIntArgs(u32 numArgs, bool withPre, bool withPost)
+{
+	HookThunkDesc desc = {};
+
+	desc.numArgs = numArgs;
+	desc.pre = withPre ? MakeProbe((void *)Pre7, &s_preRsp) : 0;
+	desc.post = withPost ? MakeProbe((void *)Post, &s_postRsp) : 0;
+
+	uintptr_t thunk = MakeThunk(desc, MakeProbe((void *)Orig7, &s_origRsp));
+	if(!thunk)
+		return;
+
+	auto fn = (IntFn7)MakeProbe((void *)thunk, &s_thunkRsp);
+
+	memset(s_preArgs, 0, sizeof(s_preArgs));
+	memset(s_origArgs, 0, sizeof(s_origArgs));
+	s_postArg = 0;
+	ResetRsp();
+
+	s_numArgs = numArgs;
+
+	s64 args[7] = { 0 };
+	s64 expected = 0;
+
+	for(u32 i = 0; i < numArgs; i++)
+	{
+		args[i] = 0x1000000000 + (i + 1) * 0x111;
+		expected += args[i];
+	}
+
+	s64 result = fn(args[0], args[1], args[2], args[3], args[4], args[5], args[6]);
+
+	CHECK(CalledAligned(s_thunkRsp));
+	CHECK(CalledAligned(s_origRsp));
+
+	for(u32 i = 0; i < numArgs; i++)
+	{
+		CHECK_EQ(s_origArgs[i], args[i]);
+
+		if(withPre)
+			CHECK_EQ(s_preArgs[i], args[i]);
+	}
+
+	if(withPre)
+	{
+		CHECK(CalledAligned(s_preRsp));
+		CheckUnwind(thunk, s_preRsp);
+	}
+	else
+	{
+		CHECK_EQ(s_preRsp, 0);
+	}
+
+	if(withPost)
+	{
+		CHECK(CalledAligned(s_postRsp));
+		CHECK_EQ(s_postArg, expected);
+		CHECK_EQ(result, expected * 2);
+
+		// the thunk's frame is still there when the function runs
+		CHECK(s_origRsp < s_thunkRsp);
+		CheckUnwind(thunk, s_origRsp);
+	}
+	else
+	{
+		CHECK_EQ(s_postRsp, 0);
+		CHECK_EQ(result, expected);
+
+		// tail call, the function returns straight to our caller
+		CHECK_EQ(s_origRsp, s_thunkRsp);
+	}
+}
+
+// ---- float arguments and return ----
+
+static double s_preFloat[2];
+static s64 s_preInt[2];
+
+typedef double (WINAPI_ABI * MixedFn)(double, s64, double, s64);
+
+static void WINAPI_ABI PreMixed(double a, s64 b, double c, s64 d)
+{
+	s_preFloat[0] = a;
+	s_preInt[0] = b;
+	s_preFloat[1] = c;
+	s_preInt[1] = d;
+}
+
+static double WINAPI_ABI OrigMixed(double a, s64 b, double c, s64 d)
+{
+	return a * b + c * d;
+}
+
+static double WINAPI_ABI PostFloat(double ret)
+{
+	return ret + 0.5;
+}
+
+static void TestFloatArgs()
+{
+	HookThunkDesc desc = {};
+
+	desc.numArgs = 4;
+	desc.floatArgs = (1 << 0) | (1 << 2);
+	desc.floatReturn = true;
+	desc.pre = MakeProbe((void *)PreMixed, &s_preRsp);
+	desc.post = MakeProbe((void *)PostFloat, &s_postRsp);
+
+	uintptr_t thunk = MakeThunk(desc, MakeProbe((void *)OrigMixed, &s_origRsp));
+	if(!thunk)
+		return;
+
+	auto fn = (MixedFn)thunk;
+
+	ResetRsp();
+
+	double result = fn(1.5, 4, 2.25, 8);
+
+	// pre may clobber the argument registers, the thunk has to restore them from its home area
+	CHECK(s_preFloat[0] == 1.5);
+	CHECK(s_preFloat[1] == 2.25);
+	CHECK_EQ(s_preInt[0], 4);
+	CHECK_EQ(s_preInt[1], 8);
+	CHECK(result == (1.5 * 4 + 2.25 * 8 + 0.5));
+
+	CHECK(CalledAligned(s_preRsp));
+	CHECK(CalledAligned(s_origRsp));
+	CHECK(CalledAligned(s_postRsp));
+}
+
+// ---- no pre or post ----
+
+static void TestPassThrough()
+{
+	HookThunkDesc desc = {};
+
+	desc.numArgs = 7;
+	s_numArgs = 7;
+
+	uintptr_t thunk = MakeThunk(desc, MakeProbe((void *)Orig7, &s_origRsp));
+	if(!thunk)
+		return;
+
+	auto fn = (IntFn7)MakeProbe((void *)thunk, &s_thunkRsp);
+
+	ResetRsp();
+
+	CHECK_EQ(fn(1, 2, 3, 4, 5, 6, 7), 28);
+	CHECK_EQ(s_origRsp, s_thunkRsp);
+	CHECK_EQ(s_origArgs[6], 7);
+
+	// a plain jmp, no frame to describe
+	CHECK(!s_functionEntry);
+}
+
+int main(int argc, char ** argv)
+{
+	for(u32 numArgs = 0; numArgs <= 7; numArgs++)
+	{
+		TestIntArgs(numArgs, true, true);
+		TestIntArgs(numArgs, true, false);
+		TestIntArgs(numArgs, false, true);
+	}
+
+	TestFloatArgs();
+	TestPassThrough();
+
+	return testResult();
+}
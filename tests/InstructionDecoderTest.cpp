@@ -0,0 +1,152 @@
+#include "Test.h"
+#include "obse64_common/InstructionDecoder.h"
+#include <cstdlib>
+#include <cstring>
+
+// checks decodeInstruction against fixtures/x64_corpus.txt, see gen_x64_corpus.py for how it was made
+// every line is: hex bytes, length, kind, displacement, objdump text
+
+static bool ParseHex(const char * hex, u8 * out, u32 * lenOut)
+{
+	u32 len = 0;
+
+	while(hex[0] && hex[1] && (len < 15))
+	{
+		char byteStr[3] = { hex[0], hex[1], 0 };
+		char * end;
+
+		out[len++] = u8(strtoul(byteStr, &end, 16));
+		if(*end)
+			return false;
+
+		hex += 2;
+	}
+
+	*lenOut = len;
+
+	return !hex[0];
+}
+
+static s64 ReadSigned(const u8 * code, u32 size)
+{
+	switch(size)
+	{
+		case 1:	return s8(code[0]);
+		case 2:	{ s16 val; memcpy(&val, code, 2); return val; }
+		case 4:	{ s32 val; memcpy(&val, code, 4); return val; }
+	}
+
+	return 0x7FFFFFFFFFFFFFFF;
+}
+
+static u32 s_numChecked = 0;
+static u32 s_numFailed = 0;
+
+static void Fail(const char * text, const char * why)
+{
+	// one line per instruction, the rest would just be noise
+	if(s_numFailed++ < 50)
+		fprintf(stderr, "%s: %s\n", text, why);
+
+	testFailures()++;
+}
+
+static void CheckLine(char * line)
+{
+	char * fields[5];
+	u32 numFields = 0;
+
+	for(char * tok = strtok(line, "\t\n"); tok && (numFields < 5); tok = strtok(nullptr, numFields < 4 ? "\t\n" : "\n"))
+		fields[numFields++] = tok;
+
+	if(numFields != 5)
+	{
+		Fail(line, "malformed line");
+		return;
+	}
+
+	u8 code[16] = { 0 };
+	u32 codeLen;
+
+	if(!ParseHex(fields[0], code, &codeLen) || (codeLen != u32(atoi(fields[1]))))
+	{
+		Fail(fields[4], "bad bytes");
+		return;
+	}
+
+	const char * kind = fields[2];
+	s64 disp = strtoll(fields[3], nullptr, 10);
+	const char * text = fields[4];
+
+	s_numChecked++;
+
+	DecodedInstruction insn;
+	if(!decodeInstruction(code, &insn))
+	{
+		Fail(text, "not decoded");
+		return;
+	}
+
+	if(insn.len != codeLen)
+	{
+		Fail(text, "wrong length");
+		return;
+	}
+
+	bool ripRelative = insn.hasFlag(DecodedInstruction::kFlag_RIPRelative);
+	bool relBranch = insn.hasFlag(DecodedInstruction::kFlag_RelBranch);
+
+	if(!strcmp(kind, "rip"))
+	{
+		if(!ripRelative || (insn.dispSize != 4))
+			Fail(text, "not rip relative");
+		else if(ReadSigned(code + insn.dispOffset, 4) != disp)
+			Fail(text, "wrong displacement offset");
+	}
+	else if(!strcmp(kind, "rel"))
+	{
+		if(!relBranch)
+			Fail(text, "not a relative branch");
+		else if(ReadSigned(code + insn.immOffset, insn.immSize) != disp)
+			Fail(text, "wrong branch displacement offset");
+	}
+	else
+	{
+		if(ripRelative || relBranch)
+			Fail(text, "wrongly marked relative");
+	}
+}
+
+int main(int argc, char ** argv)
+{
+	if(argc < 2)
+	{
+		fprintf(stderr, "usage: InstructionDecoderTest x64_corpus.txt\n");
+		return 1;
+	}
+
+	FILE * src = fopen(argv[1], "r");
+	if(!src)
+	{
+		fprintf(stderr, "couldn't open %s\n", argv[1]);
+		return 1;
+	}
+
+	char line[1024];
+
+	while(fgets(line, sizeof(line), src))
+	{
+		if((line[0] == '#') || (line[0] == '\n'))
+			continue;
+
+		CheckLine(line);
+	}
+
+	fclose(src);
+
+	CHECK(s_numChecked > 0);
+
+	printf("%u instructions checked, %u failed\n", s_numChecked, s_numFailed);
+
+	return testResult();
+}
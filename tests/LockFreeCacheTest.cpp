@@ -0,0 +1,111 @@
+#include "Test.h"
+#include "obse64_common/LockFreeCache.h"
+#include <thread>
+#include <vector>
+
+typedef LockFreeCache <u64, u64, 8, 4> TestCache;
+
+static u64 Hash(u64 key)
+{
+	return key * 0x9E3779B97F4A7C15;
+}
+
+static void TestInsertLookup()
+{
+	static TestCache cache;
+
+	u64 value = 0;
+	CHECK(!cache.lookup(Hash(1), 1, &value));
+
+	CHECK(cache.insert(Hash(1), 1, 100));
+	CHECK(cache.lookup(Hash(1), 1, &value));
+	CHECK_EQ(value, 100);
+
+	// inserting it again doesn't take another slot
+	CHECK(cache.insert(Hash(1), 1, 100));
+
+	// the same key with other values, told apart by the match function
+	CHECK(cache.insert(Hash(1), 1, 200));
+	CHECK(cache.lookup(Hash(1), 1, [](u64 entry) { return entry == 200; }, &value));
+	CHECK_EQ(value, 200);
+	CHECK(!cache.lookup(Hash(1), 1, [](u64 entry) { return entry == 300; }, &value));
+}
+
+static void TestFullNeighborhood()
+{
+	static TestCache cache;
+
+	// every key starts probing at the same slot, only kMaxProbes of them fit
+	const u64 kHash = 0;
+
+	for(u64 key = 1; key <= 4; key++)
+		CHECK(cache.insert(kHash, key, key * 10));
+
+	CHECK(!cache.insert(kHash, 5, 50));
+
+	u64 value = 0;
+	CHECK(!cache.lookup(kHash, 5, &value));
+
+	for(u64 key = 1; key <= 4; key++)
+	{
+		CHECK(cache.lookup(kHash, key, &value));
+		CHECK_EQ(value, key * 10);
+	}
+}
+
+// threads inserting overlapping keys while others look them up. a lookup only ever sees a complete entry
+static void TestConcurrent()
+{
+	static LockFreeCache <u64, u64, 12> cache;
+
+	const u32 kNumThreads = 4;
+	const u64 kNumKeys = 1000;
+
+	std::vector <std::thread> threads;
+	std::vector <u32> numBad(kNumThreads, 0);
+
+	for(u32 t = 0; t < kNumThreads; t++)
+	{
+		threads.emplace_back([t, &numBad]()
+		{
+			for(u64 key = 1; key <= kNumKeys; key++)
+			{
+				u64 value = 0;
+				if(cache.lookup(Hash(key), key, &value) && (value != key + 1))
+					numBad[t]++;
+
+				cache.insert(Hash(key), key, key + 1);
+			}
+		});
+	}
+
+	for(auto & thread : threads)
+		thread.join();
+
+	for(u32 bad : numBad)
+		CHECK_EQ(bad, 0);
+
+	u32 numFound = 0;
+
+	for(u64 key = 1; key <= kNumKeys; key++)
+	{
+		u64 value = 0;
+		if(cache.lookup(Hash(key), key, &value))
+		{
+			CHECK_EQ(value, key + 1);
+			numFound++;
+		}
+	}
+
+	// a quarter full, nothing should have been dropped
+	CHECK_EQ(numFound, kNumKeys);
+}
+
+int main()
+{
+	TestInsertLookup();
+	TestFullNeighborhood();
+	TestConcurrent();
+
+	return testResult();
+}
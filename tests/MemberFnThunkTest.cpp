@@ -0,0 +1,126 @@
+#include "Test.h"
+#include "obse64_common/Utilities.h"
+#include <cstring>
+
+// stands in for game code. the thunks only ever see an offset, the base is moved so offset + base lands on these
+struct Big
+{
+	u64	a, b, c;	// too big for rax, returned through a hidden buffer
+};
+
+class GameObject
+{
+public:
+	u64	value;
+
+	u64 Get()
+	{
+		return value;
+	}
+
+	u64 Add(u64 a, u32 b)
+	{
+		value += a + b;
+		return value;
+	}
+
+	Big MakeBig(u64 scale)
+	{
+		Big result = { value * scale, value * scale * 2, value * scale * 3 };
+		return result;
+	}
+
+	void Increment(u64 & counter)
+	{
+		counter += value;
+	}
+
+	u64 Sum6(u64 a, u64 b, u64 c, u64 d, u64 e, u64 f)
+	{
+		return value + a + (b * 2) + (c * 3) + (d * 4) + (e * 5) + (f * 6);
+	}
+
+	double Scale(double a, float b)
+	{
+		return (value * a) + b;
+	}
+};
+
+enum
+{
+	kOffset_Get = 0x100,
+	kOffset_Add = 0x200,
+	kOffset_MakeBig = 0x300,
+	kOffset_Increment = 0x400,
+	kOffset_Sum6 = 0x500,
+	kOffset_Scale = 0x600,
+};
+
+// same layout as GameObject, calls go through DEFINE_MEMBER_FN
+class HookedObject
+{
+public:
+	u64	value;
+
+	DEFINE_MEMBER_FN_0(Get, u64, kOffset_Get);
+	DEFINE_MEMBER_FN_2(Add, u64, kOffset_Add, u64, u32);
+	DEFINE_MEMBER_FN_1(MakeBig, Big, kOffset_MakeBig, u64);
+	DEFINE_MEMBER_FN_1(Increment, void, kOffset_Increment, u64 &);
+	DEFINE_MEMBER_FN_N(Sum6, u64, kOffset_Sum6, u64, u64, u64, u64, u64, u64);
+	DEFINE_MEMBER_FN_N(Scale, double, kOffset_Scale, double, float);
+};
+
+template <typename T>
+static uintptr_t CodeAddr(T fn)
+{
+	// first word of the member pointer is the code address for non-virtual functions
+	uintptr_t result;
+	memcpy(&result, &fn, sizeof(result));
+
+	return result;
+}
+
+template <typename T>
+static void SetTarget(T fn, uintptr_t offset)
+{
+	RelocationManager::s_baseAddr = CodeAddr(fn) - offset;
+}
+
+int main()
+{
+	HookedObject obj;
+	obj.value = 5;
+
+	SetTarget(&GameObject::Get, kOffset_Get);
+	CHECK_EQ(obj.Get(), 5);
+
+	SetTarget(&GameObject::Add, kOffset_Add);
+	CHECK_EQ(obj.Add(10, 20u), 35);
+	CHECK_EQ(obj.value, 35);
+
+	// converted at the call
+	CHECK_EQ(obj.Add(1, 1), 37);
+
+	obj.value = 2;
+
+	SetTarget(&GameObject::MakeBig, kOffset_MakeBig);
+	Big big = obj.MakeBig(10);
+	CHECK_EQ(big.a, 20);
+	CHECK_EQ(big.b, 40);
+	CHECK_EQ(big.c, 60);
+
+	// references are forwarded, not copied
+	SetTarget(&GameObject::Increment, kOffset_Increment);
+	u64 counter = 1;
+	obj.Increment(counter);
+	obj.Increment(counter);
+	CHECK_EQ(counter, 5);
+
+	SetTarget(&GameObject::Sum6, kOffset_Sum6);
+	CHECK_EQ(obj.Sum6(1, 1, 1, 1, 1, 1), 2 + 21);
+
+	SetTarget(&GameObject::Scale, kOffset_Scale);
+	CHECK(obj.Scale(1.5, 0.25f) == 3.25);
+
+	return testResult();
+}
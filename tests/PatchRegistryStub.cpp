@@ -0,0 +1,44 @@
+#include "obse64_common/PatchRegistry.h"
+
+// the real registry is windows only. for tests that patch code but don't look at what was recorded
+
+PatchRegistry g_patchRegistry;
+
+PatchRegistry::PatchRegistry()
+	:m_root(kNil)
+	, m_numConflicts(0)
+	, m_ownerName(nullptr)
+{
+	//
+}
+
+PatchRegistry::~PatchRegistry()
+{
+	//
+}
+
+void PatchRegistry::record(uintptr_t addr, const void * data, size_t len, u32 owner, const char * kind)
+{
+	//
+}
+
+u32 PatchRegistry::currentOwner()
+{
+	return kOwner_OBSE;
+}
+
+const char * PatchRegistry::currentKind()
+{
+	return "write";
+}
+
+PatchRegistry::KindScope::KindScope(const char * kind)
+	:m_prev(nullptr)
+{
+	//
+}
+
+PatchRegistry::KindScope::~KindScope()
+{
+	//
+}
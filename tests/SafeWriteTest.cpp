@@ -0,0 +1,443 @@
+#include "Test.h"
+#include "obse64_common/SafeWrite.h"
+#include "obse64_common/PageProtection.h"
+#include "obse64_common/PatchRegistry.h"
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <cerrno>
+#include <cinttypes>
+#include <cstring>
+#include <vector>
+
+// counts protection changes. calls from the tested code bind to this instead of libc's
+static u32 s_numProtects = 0;
+
+// making this page writable fails, like VirtualProtect on memory we aren't allowed to touch
+static void * s_failProtect = nullptr;
+
+extern "C" int mprotect(void * addr, size_t len, int prot)
+{
+	s_numProtects++;
+
+	if(s_failProtect && (prot & PROT_WRITE) && (addr <= s_failProtect) && (s_failProtect < (u8 *)addr + len))
+	{
+		errno = EACCES;
+		return -1;
+	}
+
+	return int(syscall(SYS_mprotect, addr, len, prot));
+}
+
+// the real registry is windows only, this one just keeps what was recorded
+struct RecordedPatch
+{
+	uintptr_t	addr;
+	size_t		len;
+	u8			original;	// first byte in memory when it was recorded
+	u32			owner;
+};
+
+static std::vector <RecordedPatch> s_recorded;
+static u32 s_currentOwner = PatchRegistry::kOwner_OBSE;
+
+PatchRegistry g_patchRegistry;
+
+PatchRegistry::PatchRegistry()
+	:m_root(kNil)
+	, m_numConflicts(0)
+	, m_ownerName(nullptr)
+{
+	//
+}
+
+PatchRegistry::~PatchRegistry()
+{
+	//
+}
+
+void PatchRegistry::record(uintptr_t addr, const void * data, size_t len, u32 owner, const char * kind)
+{
+	RecordedPatch patch = { addr, len, *(const u8 *)addr, owner };
+	s_recorded.push_back(patch);
+}
+
+u32 PatchRegistry::currentOwner()
+{
+	return s_currentOwner;
+}
+
+const char * PatchRegistry::currentKind()
+{
+	return "write";
+}
+
+static int GetProtection(const void * addr)
+{
+	FILE * maps = fopen("/proc/self/maps", "r");
+	char line[512];
+	int result = -1;
+
+	while(maps && fgets(line, sizeof(line), maps))
+	{
+		uintptr_t start, end;
+		char perms[5];
+
+		if((sscanf(line, "%" SCNxPTR "-%" SCNxPTR " %4s", &start, &end, perms) == 3) && (uintptr_t(addr) >= start) && (uintptr_t(addr) < end))
+		{
+			result =
+				((perms[0] == 'r') ? PROT_READ : 0) |
+				((perms[1] == 'w') ? PROT_WRITE : 0) |
+				((perms[2] == 'x') ? PROT_EXEC : 0);
+			break;
+		}
+	}
+
+	if(maps)
+		fclose(maps);
+
+	return result;
+}
+
+// read/execute pages, like game code
+static u8 * MapCode(size_t numPages)
+{
+	size_t len = numPages * getPageSize();
+
+	void * result = mmap(nullptr, len, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+	if(result == MAP_FAILED)
+		return nullptr;
+
+	memset(result, 0xCC, len);
+	mprotect(result, len, PROT_READ | PROT_EXEC);
+
+	return (u8 *)result;
+}
+
+static void TestDirectWrite()
+{
+	u8 * code = MapCode(1);
+	CHECK(code);
+
+	s_numProtects = 0;
+
+	safeWrite32(uintptr_t(code + 16), 0x12345678);
+
+	u32 value;
+	memcpy(&value, code + 16, sizeof(value));
+
+	CHECK_EQ(value, 0x12345678);
+	CHECK_EQ(code[15], 0xCC);
+	CHECK_EQ(code[20], 0xCC);
+	CHECK_EQ(s_numProtects, 2);
+	CHECK_EQ(GetProtection(code), PROT_READ | PROT_EXEC);
+
+	CHECK(safeWriteJump(uintptr_t(code + 32), uintptr_t(code + 64)));
+	CHECK_EQ(code[32], 0xE9);
+
+	s32 displ;
+	memcpy(&displ, code + 33, sizeof(displ));
+	CHECK_EQ(displ, 64 - 37);
+
+	CHECK(safeWriteCall(uintptr_t(code + 64), uintptr_t(code + 32)));
+	CHECK_EQ(code[64], 0xE8);
+	memcpy(&displ, code + 65, sizeof(displ));
+	CHECK_EQ(displ, 32 - 69);
+
+	munmap(code, getPageSize());
+}
+
+static void TestTransaction()
+{
+	size_t pageSize = getPageSize();
+
+	u8 * code = MapCode(4);
+	CHECK(code);
+
+	s_numProtects = 0;
+
+	{
+		PatchTransaction patches;
+
+		CHECK(PatchTransaction::active() == &patches);
+
+		// pages 0 and 1 are touched by several writes, one of them straddling the boundary. page 3 once, page 2 never
+		for(u32 i = 0; i < 16; i++)
+			safeWrite8(uintptr_t(code + (i * 64)), u8(i));
+
+		safeWrite64(uintptr_t(code + pageSize - 4), 0x1122334455667788);
+		safeWrite16(uintptr_t(code + (pageSize * 3) + 8), 0xBEEF);
+
+		// later writes to the same bytes win
+		safeWrite8(uintptr_t(code + 64), 0x55);
+
+		CHECK_EQ(patches.numWrites(), 19);
+
+		// nothing happens before commit
+		CHECK_EQ(code[0], 0xCC);
+		CHECK_EQ(code[64], 0xCC);
+		CHECK_EQ(s_numProtects, 0);
+
+		patches.commit();
+
+		CHECK(PatchTransaction::active() == nullptr);
+	}
+
+	CHECK_EQ(code[0], 0);
+	CHECK_EQ(code[64], 0x55);
+	CHECK_EQ(code[128], 2);
+
+	u64 straddling;
+	memcpy(&straddling, code + pageSize - 4, sizeof(straddling));
+	CHECK_EQ(straddling, 0x1122334455667788);
+
+	CHECK_EQ(code[(pageSize * 3) + 8], 0xEF);
+	CHECK_EQ(code[(pageSize * 3) + 9], 0xBE);
+	CHECK_EQ(code[pageSize * 2], 0xCC);
+
+	// pages 0-1 and page 3 are separate spans, one change and one restore each
+	CHECK_EQ(s_numProtects, 4);
+
+	for(u32 i = 0; i < 4; i++)
+		CHECK_EQ(GetProtection(code + (pageSize * i)), PROT_READ | PROT_EXEC);
+
+	munmap(code, pageSize * 4);
+}
+
+static void TestMixedProtection()
+{
+	size_t pageSize = getPageSize();
+
+	u8 * code = MapCode(2);
+	CHECK(code);
+
+	// second page is read only data, each part goes back to what it was
+	mprotect(code + pageSize, pageSize, PROT_READ);
+
+	{
+		PatchTransaction patches;
+
+		safeWrite64(uintptr_t(code + pageSize - 4), 0);
+	}
+
+	CHECK_EQ(code[pageSize - 4], 0);
+	CHECK_EQ(code[pageSize + 3], 0);
+	CHECK_EQ(code[pageSize + 4], 0xCC);
+	CHECK_EQ(GetProtection(code), PROT_READ | PROT_EXEC);
+	CHECK_EQ(GetProtection(code + pageSize), PROT_READ);
+
+	munmap(code, pageSize * 2);
+}
+
+static void TestCancelAndNesting()
+{
+	u8 * code = MapCode(1);
+	CHECK(code);
+
+	{
+		PatchTransaction patches;
+
+		safeWrite8(uintptr_t(code), 1);
+
+		patches.cancel();
+
+		CHECK(PatchTransaction::active() == nullptr);
+
+		// closed, goes straight to memory
+		safeWrite8(uintptr_t(code + 1), 2);
+	}
+
+	CHECK_EQ(code[0], 0xCC);
+	CHECK_EQ(code[1], 2);
+
+	{
+		PatchTransaction outer;
+
+		safeWrite8(uintptr_t(code + 2), 3);
+
+		{
+			PatchTransaction inner;
+
+			CHECK(PatchTransaction::active() == &inner);
+
+			safeWrite8(uintptr_t(code + 3), 4);
+		}
+
+		// the inner one committed on its own
+		CHECK(PatchTransaction::active() == &outer);
+		CHECK_EQ(code[2], 0xCC);
+		CHECK_EQ(code[3], 4);
+	}
+
+	CHECK_EQ(code[2], 3);
+
+	munmap(code, getPageSize());
+}
+
+static void TestRecording()
+{
+	u8 * code = MapCode(1);
+	CHECK(code);
+
+	s_recorded.clear();
+
+	safeWrite8(uintptr_t(code), 1);
+
+	CHECK_EQ(s_recorded.size(), 1);
+	CHECK_EQ(s_recorded[0].original, 0xCC);
+
+	// cancelled writes never happened, so they aren't recorded
+	{
+		PatchTransaction patches;
+
+		safeWrite8(uintptr_t(code + 1), 2);
+		patches.cancel();
+	}
+
+	CHECK_EQ(s_recorded.size(), 1);
+
+	// recorded on commit, one write at a time, with the owner from when the write was made
+	{
+		PatchTransaction patches;
+
+		s_currentOwner = 5;
+		safeWrite8(uintptr_t(code + 2), 3);
+		s_currentOwner = 6;
+		safeWrite8(uintptr_t(code + 2), 4);
+		s_currentOwner = PatchRegistry::kOwner_OBSE;
+
+		CHECK_EQ(s_recorded.size(), 1);
+	}
+
+	CHECK_EQ(s_recorded.size(), 3);
+	CHECK_EQ(s_recorded[1].owner, 5);
+	CHECK_EQ(s_recorded[1].original, 0xCC);
+	CHECK_EQ(s_recorded[2].owner, 6);
+	CHECK_EQ(s_recorded[2].original, 3);
+	CHECK_EQ(code[2], 4);
+
+	munmap(code, getPageSize());
+}
+
+// a write that can't be made is skipped instead of faulting. a transaction drops everything
+static void TestUnprotectFailure()
+{
+	size_t pageSize = getPageSize();
+
+	u8 * code = MapCode(2);
+	CHECK(code);
+
+	s_recorded.clear();
+	s_failProtect = code + pageSize;
+
+	safeWrite8(uintptr_t(code + pageSize), 1);
+
+	CHECK_EQ(code[pageSize], 0xCC);
+
+	{
+		PatchTransaction patches;
+
+		safeWrite8(uintptr_t(code), 2);
+		safeWrite8(uintptr_t(code + pageSize + 8), 3);
+	}
+
+	CHECK_EQ(code[0], 0xCC);
+	CHECK_EQ(code[pageSize + 8], 0xCC);
+	CHECK_EQ(s_recorded.size(), 0);
+	CHECK_EQ(GetProtection(code), PROT_READ | PROT_EXEC);
+	CHECK_EQ(GetProtection(code + pageSize), PROT_READ | PROT_EXEC);
+
+	s_failProtect = nullptr;
+
+	// writes go through again once the page can be unprotected
+	safeWrite8(uintptr_t(code), 4);
+	CHECK_EQ(code[0], 4);
+
+	munmap(code, pageSize * 2);
+}
+
+// a plugin's copy of SafeWrite forwarding everything to OBSE
+struct RedirectLog
+{
+	u32					numBegin;
+	u32					numCommit;
+	u32					numCancel;
+	std::vector <u8>	written;
+	u32					owner;
+};
+
+static RedirectLog s_redirectLog;
+
+static void RedirectedWrite(u32 owner, uintptr_t addr, const void * data, size_t len)
+{
+	s_redirectLog.owner = owner;
+	s_redirectLog.written.insert(s_redirectLog.written.end(), (const u8 *)data, (const u8 *)data + len);
+}
+
+static void RedirectedBegin()
+{
+	s_redirectLog.numBegin++;
+}
+
+static void RedirectedCommit()
+{
+	s_redirectLog.numCommit++;
+}
+
+static void RedirectedCancel()
+{
+	s_redirectLog.numCancel++;
+}
+
+static void TestRedirect()
+{
+	u8 * code = MapCode(1);
+	CHECK(code);
+
+	SafeWriteRedirect redirect = { 7, RedirectedWrite, RedirectedBegin, RedirectedCommit, RedirectedCancel };
+	redirectSafeWrite(redirect);
+
+	safeWrite8(uintptr_t(code), 1);
+
+	{
+		PatchTransaction patches;
+
+		// the open transaction is OBSE's
+		CHECK(PatchTransaction::active() == nullptr);
+
+		safeWrite8(uintptr_t(code), 2);
+		patches.write(uintptr_t(code), "\x03", 1);
+	}
+
+	{
+		PatchTransaction patches;
+		patches.cancel();
+	}
+
+	CHECK_EQ(s_redirectLog.owner, 7);
+	CHECK_EQ(s_redirectLog.written.size(), 3);
+	CHECK_EQ(s_redirectLog.numBegin, 2);
+	CHECK_EQ(s_redirectLog.numCommit, 1);
+	CHECK_EQ(s_redirectLog.numCancel, 1);
+
+	// nothing written locally
+	CHECK_EQ(code[0], 0xCC);
+
+	SafeWriteRedirect none = { 0 };
+	redirectSafeWrite(none);
+
+	munmap(code, getPageSize());
+}
+
+int main()
+{
+	TestDirectWrite();
+	TestTransaction();
+	TestMixedProtection();
+	TestCancelAndNesting();
+	TestRecording();
+	TestUnprotectFailure();
+	TestRedirect();
+
+	return testResult();
+}
@@ -0,0 +1,107 @@
+#include "obse64_common/TaskPool.h"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+// throughput of the task pool, not run by ctest
+// usage: TaskPoolBenchmark [max workers]
+
+typedef std::chrono::steady_clock Clock;
+
+static double SecondsSince(Clock::time_point start)
+{
+	return std::chrono::duration <double>(Clock::now() - start).count();
+}
+
+static void Nothing(void * ctx)
+{
+	//
+}
+
+// submit, wait and release lots of empty tasks, so only the scheduling is measured
+static void BenchSubmit(u32 numWorkers)
+{
+	const u32 kNumTasks = 200000;
+	const u32 kBatchSize = 1000;
+
+	TaskPool pool(numWorkers);
+	std::vector <TaskPool::Task *> tasks(kBatchSize);
+
+	auto start = Clock::now();
+
+	for(u32 i = 0; i < kNumTasks; i += kBatchSize)
+	{
+		for(auto & task : tasks)
+			task = pool.submit(Nothing, nullptr);
+
+		for(auto * task : tasks)
+		{
+			pool.wait(task);
+			pool.release(task);
+		}
+	}
+
+	double elapsed = SecondsSince(start);
+
+	printf("submit       %2u workers: %8.0f tasks/ms\n", numWorkers, kNumTasks / (elapsed * 1000.0));
+}
+
+struct SumState
+{
+	const float		* data;
+	double			* partials;	// one per chunk, by chunk start
+	u64				grain;
+};
+
+static void SumRange(void * ctx, u64 begin, u64 end)
+{
+	auto * state = (SumState *)ctx;
+
+	double sum = 0;
+	for(u64 i = begin; i < end; i++)
+		sum += state->data[i] * state->data[i];
+
+	state->partials[begin / state->grain] = sum;
+}
+
+// a memory bound loop split with parallelFor
+static void BenchParallelFor(u32 numWorkers, const std::vector <float> & data, u64 grain)
+{
+	const u32 kNumRuns = 20;
+
+	TaskPool pool(numWorkers);
+	std::vector <double> partials(size_t((data.size() + grain - 1) / grain));
+
+	SumState state = { data.data(), partials.data(), grain };
+
+	auto start = Clock::now();
+
+	for(u32 i = 0; i < kNumRuns; i++)
+		pool.parallelFor(0, data.size(), grain, SumRange, &state);
+
+	double elapsed = SecondsSince(start);
+
+	printf("parallelFor  %2u workers: %8.1f Mitems/s (grain %llu)\n", numWorkers,
+		(double(data.size()) * kNumRuns) / (elapsed * 1000000.0), (unsigned long long)grain);
+}
+
+int main(int argc, char ** argv)
+{
+	u32 maxWorkers = std::thread::hardware_concurrency();
+	if(argc > 1)
+		maxWorkers = u32(atoi(argv[1]));
+
+	std::vector <float> data(16 * 1024 * 1024);
+	for(size_t i = 0; i < data.size(); i++)
+		data[i] = float(i & 0xFF);
+
+	for(u32 numWorkers = 0; numWorkers <= maxWorkers; numWorkers = numWorkers ? numWorkers * 2 : 1)
+	{
+		BenchSubmit(numWorkers);
+		BenchParallelFor(numWorkers, data, 64 * 1024);
+		BenchParallelFor(numWorkers, data, 1024);
+	}
+
+	return 0;
+}
@@ -0,0 +1,297 @@
+#include "Test.h"
+#include "obse64_common/TaskPool.h"
+#include <atomic>
+#include <vector>
+
+// every test runs with no workers (the caller does all the work in wait/parallelFor) and with a few
+
+static void Increment(void * ctx)
+{
+	((std::atomic <u32> *)ctx)->fetch_add(1);
+}
+
+static void TestSubmit(u32 numWorkers)
+{
+	TaskPool pool(numWorkers);
+
+	CHECK_EQ(pool.numWorkers(), numWorkers);
+
+	std::atomic <u32> counter(0);
+	std::vector <TaskPool::Task *> tasks;
+
+	for(u32 i = 0; i < 100; i++)
+		tasks.push_back(pool.submit(Increment, &counter));
+
+	for(auto * task : tasks)
+	{
+		pool.wait(task);
+		CHECK(pool.isDone(task));
+		pool.release(task);
+	}
+
+	CHECK_EQ(counter.load(), 100);
+}
+
+// continuations see everything their predecessors wrote
+struct ChainStep
+{
+	u32				* value;
+	u32				expected;
+	bool			ok;
+};
+
+static void RunChainStep(void * ctx)
+{
+	auto * step = (ChainStep *)ctx;
+
+	step->ok = (*step->value == step->expected);
+	(*step->value)++;
+}
+
+static void TestThen(u32 numWorkers)
+{
+	TaskPool pool(numWorkers);
+
+	u32 value = 0;
+	ChainStep steps[8];
+
+	TaskPool::Task * prev = nullptr;
+	std::vector <TaskPool::Task *> tasks;
+
+	for(u32 i = 0; i < 8; i++)
+	{
+		steps[i] = { &value, i, false };
+
+		prev = prev ? pool.then(prev, RunChainStep, &steps[i]) : pool.submit(RunChainStep, &steps[i]);
+		tasks.push_back(prev);
+	}
+
+	pool.wait(prev);
+
+	CHECK_EQ(value, 8);
+	for(auto & step : steps)
+		CHECK(step.ok);
+
+	// then on a task that has already finished runs right away
+	std::atomic <u32> counter(0);
+
+	TaskPool::Task * late = pool.then(prev, Increment, &counter);
+	pool.wait(late);
+	pool.release(late);
+
+	CHECK_EQ(counter.load(), 1);
+
+	for(auto * task : tasks)
+		pool.release(task);
+}
+
+struct SumState
+{
+	std::atomic <u32>	parts;
+	u32					total;
+};
+
+static void AddPart(void * ctx)
+{
+	((SumState *)ctx)->parts.fetch_add(1);
+}
+
+static void Total(void * ctx)
+{
+	auto * state = (SumState *)ctx;
+
+	state->total = state->parts.load();
+}
+
+static void TestWhenAll(u32 numWorkers)
+{
+	TaskPool pool(numWorkers);
+
+	SumState state;
+	state.parts = 0;
+	state.total = 0;
+
+	std::vector <TaskPool::Task *> parts;
+	for(u32 i = 0; i < 32; i++)
+		parts.push_back(pool.submit(AddPart, &state));
+
+	TaskPool::Task * total = pool.whenAll(parts.data(), u32(parts.size()), Total, &state);
+
+	pool.wait(total);
+
+	CHECK_EQ(state.total, 32);
+
+	pool.release(total);
+	for(auto * task : parts)
+		pool.release(task);
+
+	// nothing to wait for
+	std::atomic <u32> counter(0);
+
+	TaskPool::Task * empty = pool.whenAll(nullptr, 0, Increment, &counter);
+	pool.wait(empty);
+	pool.release(empty);
+
+	CHECK_EQ(counter.load(), 1);
+}
+
+// waiting inside a task runs other tasks instead of blocking the worker
+struct NestedState
+{
+	TaskPool			* pool;
+	std::atomic <u32>	counter;
+};
+
+static void SubmitAndWait(void * ctx)
+{
+	auto * state = (NestedState *)ctx;
+
+	TaskPool::Task * inner = state->pool->submit(Increment, &state->counter);
+	state->pool->wait(inner);
+	state->pool->release(inner);
+}
+
+static void TestNestedWait(u32 numWorkers)
+{
+	TaskPool pool(numWorkers);
+
+	NestedState state;
+	state.pool = &pool;
+	state.counter = 0;
+
+	std::vector <TaskPool::Task *> tasks;
+	for(u32 i = 0; i < 16; i++)
+		tasks.push_back(pool.submit(SubmitAndWait, &state));
+
+	for(auto * task : tasks)
+	{
+		pool.wait(task);
+		pool.release(task);
+	}
+
+	CHECK_EQ(state.counter.load(), 16);
+}
+
+static void TestDestructorRunsQueued()
+{
+	std::atomic <u32> counter(0);
+
+	{
+		TaskPool pool(0);
+
+		for(u32 i = 0; i < 10; i++)
+			pool.release(pool.submit(Increment, &counter));
+	}
+
+	CHECK_EQ(counter.load(), 10);
+}
+
+// ---- parallelFor ----
+
+struct RangeState
+{
+	u64					begin;
+	u64					grain;
+	std::vector <u8>	hits;	// per item, relative to begin
+	std::atomic <u32>	calls;
+	std::atomic <bool>	bad;	// a chunk was empty, reversed, out of range or bigger than grain
+	std::mutex			lock;
+};
+
+static void MarkRange(void * ctx, u64 begin, u64 end)
+{
+	auto * state = (RangeState *)ctx;
+
+	state->calls++;
+
+	if((end <= begin) || (begin < state->begin) || ((end - state->begin) > state->hits.size()) ||
+		(state->grain && ((end - begin) > state->grain)))
+	{
+		state->bad = true;
+		return;
+	}
+
+	std::lock_guard <std::mutex> lock(state->lock);
+
+	for(u64 i = begin; i < end; i++)
+		state->hits[size_t(i - state->begin)]++;
+}
+
+// checks every item is visited once and returns the number of calls
+static u32 RunRange(TaskPool & pool, u64 begin, u64 end, u64 grain)
+{
+	RangeState state;
+
+	state.begin = begin;
+	state.grain = grain;
+	state.hits.resize(size_t(end - begin), 0);
+	state.calls = 0;
+	state.bad = false;
+
+	pool.parallelFor(begin, end, grain, MarkRange, &state);
+
+	CHECK(!state.bad);
+
+	for(auto hits : state.hits)
+		CHECK_EQ(hits, 1);
+
+	return state.calls.load();
+}
+
+static void TestParallelFor(u32 numWorkers)
+{
+	TaskPool pool(numWorkers);
+
+	// empty and reversed ranges don't call fn
+	CHECK_EQ(RunRange(pool, 0, 0, 1), 0);
+	CHECK_EQ(RunRange(pool, 5, 5, 0), 0);
+
+	{
+		RangeState state;
+		state.calls = 0;
+
+		pool.parallelFor(10, 5, 1, MarkRange, &state);
+
+		CHECK_EQ(state.calls.load(), 0);
+	}
+
+	CHECK_EQ(RunRange(pool, 0, 1, 0), 1);
+	CHECK_EQ(RunRange(pool, 0, 1, 1), 1);
+	CHECK_EQ(RunRange(pool, 0, 1, 100), 1);
+
+	// a grain bigger than the range is one call
+	CHECK_EQ(RunRange(pool, 0, 10, 11), 1);
+	CHECK_EQ(RunRange(pool, 0, 10, ~0ull), 1);
+	CHECK_EQ(RunRange(pool, 3, 13, ~0ull - 1), 1);
+
+	// last chunk is short
+	CHECK_EQ(RunRange(pool, 0, 10, 3), 4);
+	CHECK_EQ(RunRange(pool, 0, 10, 10), 1);
+	CHECK_EQ(RunRange(pool, 0, 1000, 1), 1000);
+	CHECK_EQ(RunRange(pool, 100, 1100, 7), 143);
+
+	// begin + grain would wrap around
+	CHECK_EQ(RunRange(pool, ~0ull - 10, ~0ull, 4), 3);
+	CHECK_EQ(RunRange(pool, ~0ull - 10, ~0ull, ~0ull), 1);
+
+	// picked grain
+	CHECK(RunRange(pool, 0, 10000, 0) >= 1);
+}
+
+int main()
+{
+	const u32 kNumWorkers[] = { 0, 1, 3 };
+
+	for(u32 numWorkers : kNumWorkers)
+	{
+		TestSubmit(numWorkers);
+		TestThen(numWorkers);
+		TestWhenAll(numWorkers);
+		TestNestedWait(numWorkers);
+		TestParallelFor(numWorkers);
+	}
+
+	TestDestructorRunsQueued();
+
+	return testResult();
+}
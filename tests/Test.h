@@ -0,0 +1,39 @@
+#pragma once
+
+#include <cstdio>
+
+// just enough to write the tests without pulling in a framework
+// failed checks are printed and counted, main returns testResult() so ctest sees the failure
+
+inline int & testFailures()
+{
+	static int s_failures = 0;
+	return s_failures;
+}
+
+inline int testResult()
+{
+	if(testFailures())
+		fprintf(stderr, "%d check(s) failed\n", testFailures());
+
+	return testFailures() ? 1 : 0;
+}
+
+#define CHECK(a)																\
+	do {																		\
+		if(!(a)) {																\
+			fprintf(stderr, "%s(%d): check failed: %s\n", __FILE__, __LINE__, #a);	\
+			testFailures()++;													\
+		}																		\
+	} while(0)
+
+#define CHECK_EQ(a, b)																					\
+	do {																								\
+		auto _a = (a);																					\
+		auto _b = (b);																					\
+		if(!(_a == _b)) {																				\
+			fprintf(stderr, "%s(%d): check failed: %s == %s (%llX != %llX)\n", __FILE__, __LINE__, #a, #b,	\
+				(unsigned long long)_a, (unsigned long long)_b);										\
+			testFailures()++;																			\
+		}																								\
+	} while(0)
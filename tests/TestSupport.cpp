@@ -0,0 +1,32 @@
+#include "obse64_common/Log.h"
+#include "obse64_common/Errors.h"
+#include "obse64_common/Relocation.h"
+#include <cstdlib>
+
+// stand ins for the windows only parts of obse64_common the tested code links against
+
+uintptr_t RelocationManager::s_baseAddr = 0;
+
+void DebugLog::log(LogLevel level, const char * fmt, va_list args)
+{
+	vfprintf(stderr, fmt, args);
+	fputc('\n', stderr);
+}
+
+void _AssertionFailed(const char * file, unsigned long line, const char * desc)
+{
+	fprintf(stderr, "%s(%lu): assertion failed: %s\n", file, line, desc);
+	abort();
+}
+
+void _AssertionFailed_ErrCode(const char * file, unsigned long line, const char * desc, unsigned long long code)
+{
+	fprintf(stderr, "%s(%lu): assertion failed: %s (%llX)\n", file, line, desc, code);
+	abort();
+}
+
+void _AssertionFailed_ErrCode(const char * file, unsigned long line, const char * desc, const char * code)
+{
+	fprintf(stderr, "%s(%lu): assertion failed: %s (%s)\n", file, line, desc, code);
+	abort();
+}
@@ -0,0 +1,84 @@
+#!/usr/bin/env python3
+# regenerates x64_corpus.txt from objdump's disassembly of some 64 bit binaries
+# usage: gen_x64_corpus.py binary... > x64_corpus.txt
+#
+# one instruction per distinct mnemonic, length, operand shape and kind is kept, so the corpus covers every
+# encoding objdump saw without being millions of lines
+
+import re
+import subprocess
+import sys
+
+BRANCHES = re.compile(r'^(j[a-z]+|callq?|loop[a-z]*|jrcxz|jecxz|xbegin[lqw]?)$')
+TARGET = re.compile(r'^([0-9a-f]+)(\s+<.*>)?$')
+RIP_COMMENT = re.compile(r'#\s*([0-9a-f]+)')
+# objdump prints redundant prefixes as words in front of the mnemonic
+PREFIX_WORDS = re.compile(r'^((data16|addr32|rex(\.[WRXB]+)?|[c-gs]s|bnd|notrack)\s+)+')
+
+def instructions(path):
+	out = subprocess.run(['objdump', '-d', '-w', path], capture_output=True, text=True, check=True).stdout
+
+	for line in out.splitlines():
+		parts = line.split('\t')
+		if len(parts) < 3 or not parts[0].strip().endswith(':'):
+			continue
+
+		addr = int(parts[0].strip()[:-1], 16)
+		code = bytes.fromhex(parts[1].replace(' ', ''))
+		text = ' '.join(parts[2].split())
+
+		yield addr, code, text
+
+def classify(addr, code, text):
+	mnemonic, _, operands = PREFIX_WORDS.sub('', text).partition(' ')
+	end = addr + len(code)
+
+	if '(%rip)' in operands:
+		match = RIP_COMMENT.search(operands)
+		if not match:
+			return None
+		return 'rip', int(match.group(1), 16) - end
+
+	if BRANCHES.match(mnemonic) and not operands.startswith('*'):
+		match = TARGET.match(operands)
+		if not match:
+			return None
+		return 'rel', int(match.group(1), 16) - end
+
+	return '-', 0
+
+def shape(text):
+	# register classes stay, numbers and register names don't
+	text = re.sub(r'<.*?>|#.*', '', text)
+	text = re.sub(r'%(r[0-9]+|[re]?[a-d]x|[re]?[sd]il?|[re]?[sb]pl?|[a-d][lh])\b', '%G', text)
+	text = re.sub(r'%([xyz]mm|k|mm|st)[0-9()]+', r'%\1', text)
+	return re.sub(r'0x[0-9a-f]+|\b[0-9a-f]+\b', 'N', text)
+
+def main():
+	seen = set()
+
+	print('# x86-64 instructions and what InstructionDecoderTest expects from decodeInstruction')
+	print('# bytes, length, kind (rip: disp32 is rip relative, rel: branch displacement, -: neither), displacement, objdump text')
+	print('# generated by gen_x64_corpus.py from: ' + ' '.join(p.split('/')[-1] for p in sys.argv[1:]))
+
+	for path in sys.argv[1:]:
+		for addr, code, text in instructions(path):
+			if '(bad)' in text or len(code) > 15 or ' ' not in text and text.startswith(('rex', 'data16', 'addr32')):
+				continue
+
+			# fstcw and friends are printed as one instruction, but the leading fwait is an instruction of its own
+			if code[0] == 0x9b and len(code) > 1:
+				continue
+
+			kind = classify(addr, code, text)
+			if not kind:
+				continue
+
+			key = (len(code), kind[0], shape(text), code[0])
+			if key in seen:
+				continue
+			seen.add(key)
+
+			print('%s\t%d\t%s\t%d\t%s' % (code.hex(), len(code), kind[0], kind[1], text))
+
+main()
@@ -0,0 +1,100 @@
+#pragma once
+
+#include <sys/mman.h>
+#include <unistd.h>
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+
+// the few Win32 memory calls BranchTrampoline.cpp makes, on top of mmap/mprotect
+// pools in the tests use setBase on memory they mapped themselves, so there is no address space search:
+// VirtualQuery fails and VirtualAlloc only maps where the kernel likes
+
+// msvc's limits.h, which Windows.h pulls in
+#define _I32_MIN	INT32_MIN
+#define _I32_MAX	INT32_MAX
+
+typedef std::uint32_t	DWORD;
+typedef void *			HMODULE;
+typedef void *			HANDLE;
+
+enum
+{
+	MEM_COMMIT =	0x1000,
+	MEM_RESERVE =	0x2000,
+	MEM_RELEASE =	0x8000,
+	MEM_FREE =		0x10000,
+
+	PAGE_EXECUTE_READ =			0x20,
+	PAGE_EXECUTE_READWRITE =	0x40,
+};
+
+struct SYSTEM_INFO
+{
+	DWORD	dwPageSize;
+	DWORD	dwAllocationGranularity;
+};
+
+struct MEMORY_BASIC_INFORMATION
+{
+	void	* BaseAddress;
+	size_t	RegionSize;
+	DWORD	State;
+};
+
+inline DWORD GetLastError()
+{
+	return DWORD(errno);
+}
+
+inline void GetSystemInfo(SYSTEM_INFO * info)
+{
+	info->dwPageSize = DWORD(sysconf(_SC_PAGESIZE));
+	info->dwAllocationGranularity = 0x10000;
+}
+
+inline HMODULE GetModuleHandle(const char * name)
+{
+	return nullptr;
+}
+
+inline HANDLE GetCurrentProcess()
+{
+	return nullptr;
+}
+
+inline bool FlushInstructionCache(HANDLE process, const void * base, size_t len)
+{
+	return true;
+}
+
+inline int ProtectFlags(DWORD protect)
+{
+	return (protect == PAGE_EXECUTE_READWRITE) ? (PROT_READ | PROT_WRITE | PROT_EXEC) : (PROT_READ | PROT_EXEC);
+}
+
+inline size_t VirtualQuery(const void * addr, MEMORY_BASIC_INFORMATION * info, size_t len)
+{
+	errno = ENOSYS;
+	return 0;
+}
+
+inline void * VirtualAlloc(void * addr, size_t len, DWORD type, DWORD protect)
+{
+	void * result = mmap(addr, len, ProtectFlags(protect), MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+	return (result == MAP_FAILED) ? nullptr : result;
+}
+
+inline bool VirtualFree(void * addr, size_t len, DWORD type)
+{
+	// only used to release whole regions, which the tests never do
+	return false;
+}
+
+inline bool VirtualProtect(void * addr, size_t len, DWORD protect, DWORD * oldProtect)
+{
+	*oldProtect = PAGE_EXECUTE_READWRITE;
+
+	return mprotect(addr, len, ProtectFlags(protect)) == 0;
+}